@@ -0,0 +1,168 @@
+#include <memory>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include "Entity.h"
+#include "ComponentController.h"
+#include "Prefab.h"
+#include "BenchmarkTools.h"
+
+using namespace engine;
+using namespace benchmarkTool;
+
+namespace
+{
+
+std::vector<Entity> createEntities(u32 p_size)
+{
+	std::vector<Entity> l_entities;
+	l_entities.reserve(p_size);
+
+	for (auto i = 1u; i <= p_size; i++)
+		l_entities.emplace_back(i);
+
+	return l_entities;
+}
+
+ComponentIndicators createIndicators(std::initializer_list<ComponentType> p_types)
+{
+	ComponentIndicators l_indicators;
+
+	for (auto l_type : p_types)
+		l_indicators.set(l_type);
+
+	return l_indicators;
+}
+
+void componentAttachAndDetach(benchmark::State& p_state)
+{
+	const auto l_size = static_cast<u32>(p_state.range(0));
+	auto l_entities = createEntities(l_size);
+	ComponentController l_controller(std::make_unique<PreallocatedComponentProvider>(l_size));
+	const auto l_components = createIndicators({ ComponentType::POSITION, ComponentType::MOVABLE, ComponentType::VISIBLE });
+	AllocationScope l_allocations;
+
+	for (auto _ : p_state)
+	{
+		for (auto& l_entity : l_entities)
+			l_controller.attachMultipleComponents(l_entity, l_components);
+
+		for (auto& l_entity : l_entities)
+			l_controller.detachComponent(l_entity, ComponentType::MOVABLE);
+
+		for (auto& l_entity : l_entities)
+			l_controller.detachMultipleComponents(l_entity, l_components);
+	}
+
+	reportAllocations(p_state, l_allocations);
+	reportOperations(p_state, 3u * l_size);
+}
+
+//the same components attached per entity and from prefab in batches - both detached one by one
+void componentMultipleAttach(benchmark::State& p_state)
+{
+	const auto l_size = static_cast<u32>(p_state.range(0));
+	auto l_entities = createEntities(l_size);
+	ComponentController l_controller(std::make_unique<PreallocatedComponentProvider>(l_size));
+	const auto l_components = createIndicators({ ComponentType::POSITION, ComponentType::MOVABLE, ComponentType::VISIBLE });
+
+	for (auto _ : p_state)
+	{
+		for (auto& l_entity : l_entities)
+			l_controller.attachMultipleComponents(l_entity, l_components);
+
+		for (auto& l_entity : l_entities)
+			l_controller.detachMultipleComponents(l_entity, l_components);
+	}
+
+	reportOperations(p_state, 2u * l_size);
+}
+
+void componentPrefabAttach(benchmark::State& p_state)
+{
+	const auto l_size = static_cast<u32>(p_state.range(0));
+	auto l_entities = createEntities(l_size);
+	ComponentController l_controller(std::make_unique<PreallocatedComponentProvider>(l_size));
+	const auto l_components = createIndicators({ ComponentType::POSITION, ComponentType::MOVABLE, ComponentType::VISIBLE });
+
+	Prefab l_prefab;
+	l_prefab.addComponent(ComponentType::POSITION);
+	l_prefab.addComponent(ComponentType::MOVABLE);
+	l_prefab.addComponent(ComponentType::VISIBLE);
+
+	for (auto _ : p_state)
+	{
+		l_controller.attachPrefab(l_entities.data(), l_size, l_prefab);
+
+		for (auto& l_entity : l_entities)
+			l_controller.detachMultipleComponents(l_entity, l_components);
+	}
+
+	reportOperations(p_state, 2u * l_size);
+}
+
+//every entity gets a different mix of components, query matches about quarter of them
+void componentMaskQuery(benchmark::State& p_state)
+{
+	const auto l_size = static_cast<u32>(p_state.range(0));
+	auto l_entities = createEntities(l_size);
+	const auto l_query = createIndicators({ ComponentType::POSITION, ComponentType::MOVABLE });
+
+	for (auto& l_entity : l_entities)
+	{
+		for (auto l_index = 0u; l_index <= LAST_VALID_COMPONENT_INDEX; l_index++)
+		{
+			if ((l_entity.id >> l_index) & 1u)
+				l_entity.attachedComponents.set(static_cast<ComponentType>(l_index));
+		}
+	}
+
+	for (auto _ : p_state)
+	{
+		u32 l_nrOfMatches = 0u;
+		for (const auto& l_entity : l_entities)
+		{
+			if ((l_entity.attachedComponents & l_query) == l_query)
+				l_nrOfMatches++;
+		}
+
+		benchmark::DoNotOptimize(l_nrOfMatches);
+	}
+
+	reportOperations(p_state, l_size);
+}
+
+void componentChainIteration(benchmark::State& p_state)
+{
+	const auto l_size = static_cast<u32>(p_state.range(0));
+	auto l_entities = createEntities(l_size);
+	ComponentController l_controller(std::make_unique<PreallocatedComponentProvider>(l_size));
+	const auto l_components = createIndicators({ ComponentType::POSITION, ComponentType::MOVABLE, ComponentType::VISIBLE });
+
+	for (auto& l_entity : l_entities)
+		l_controller.attachMultipleComponents(l_entity, l_components);
+
+	for (auto _ : p_state)
+	{
+		u32 l_nrOfMovables = 0u;
+		for (const auto& l_entity : l_entities)
+		{
+			for (auto l_component = l_entity.components; l_component != nullptr; l_component = l_component->nextComponent)
+			{
+				if (l_component->type == ComponentType::MOVABLE)
+					l_nrOfMovables++;
+			}
+		}
+
+		benchmark::DoNotOptimize(l_nrOfMovables);
+	}
+
+	reportOperations(p_state, l_size);
+}
+
+}
+
+BENCHMARK(componentAttachAndDetach)->Apply(applyScales);
+BENCHMARK(componentMultipleAttach)->Apply(applyScales);
+BENCHMARK(componentPrefabAttach)->Apply(applyScales);
+BENCHMARK(componentMaskQuery)->Apply(applyScales);
+BENCHMARK(componentChainIteration)->Apply(applyScales);
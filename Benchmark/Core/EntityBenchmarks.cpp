@@ -0,0 +1,122 @@
+#include <memory>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include "EntityPool.h"
+#include "IdGuard.h"
+#include "BenchmarkTools.h"
+
+using namespace engine;
+using namespace benchmarkTool;
+
+namespace
+{
+
+const u32 NR_OF_LOOKUPS = 1000u;
+const u32 CHURN_RATIO = 10u; //1 of 10 entities removed and created again every iteration
+
+EntityPool createFilledEntityPool(u32 p_size)
+{
+	EntityPool l_pool(p_size, std::make_unique<IdGuard>(p_size));
+
+	for (auto i = 0u; i < p_size; i++)
+		l_pool.create();
+
+	return l_pool;
+}
+
+//ids spread evenly over the pool, so average lookup position does not depend on loop order
+std::vector<EntityId> createLookupIds(u32 p_size)
+{
+	std::vector<EntityId> l_ids(NR_OF_LOOKUPS);
+	u64 l_id = 1u;
+
+	for (auto& l_lookupId : l_ids)
+	{
+		l_id = (l_id * 7919u) % p_size;
+		l_lookupId = static_cast<EntityId>(l_id + 1u);
+	}
+
+	return l_ids;
+}
+
+void entityPoolGetEntity(benchmark::State& p_state)
+{
+	const auto l_size = static_cast<u32>(p_state.range(0));
+	auto l_pool = createFilledEntityPool(l_size);
+	const auto l_ids = createLookupIds(l_size);
+
+	for (auto _ : p_state)
+	{
+		for (auto l_id : l_ids)
+			benchmark::DoNotOptimize(&l_pool.getEntity(l_id));
+	}
+
+	reportOperations(p_state, NR_OF_LOOKUPS);
+}
+
+void entityPoolCreate(benchmark::State& p_state)
+{
+	const auto l_size = static_cast<u32>(p_state.range(0));
+	EntityPool l_pool(l_size, std::make_unique<IdGuard>(l_size));
+	AllocationScope l_allocations;
+
+	for (auto _ : p_state)
+	{
+		for (auto i = 0u; i < l_size; i++)
+			benchmark::DoNotOptimize(&l_pool.create());
+
+		p_state.PauseTiming();
+		l_pool.clear();
+		p_state.ResumeTiming();
+	}
+
+	reportAllocations(p_state, l_allocations);
+	reportOperations(p_state, l_size);
+}
+
+void entityPoolCreateAndRemove(benchmark::State& p_state)
+{
+	const auto l_size = static_cast<u32>(p_state.range(0));
+	auto l_pool = createFilledEntityPool(l_size);
+	const auto l_nrOfChurnedEntities = l_size / CHURN_RATIO;
+	AllocationScope l_allocations;
+
+	for (auto _ : p_state)
+	{
+		for (auto i = 1u; i <= l_nrOfChurnedEntities; i++)
+			l_pool.removeEntity(i * CHURN_RATIO);
+
+		for (auto i = 1u; i <= l_nrOfChurnedEntities; i++)
+			l_pool.create();
+	}
+
+	reportAllocations(p_state, l_allocations);
+	reportOperations(p_state, 2u * l_nrOfChurnedEntities);
+}
+
+void idGuardChurn(benchmark::State& p_state)
+{
+	const auto l_size = static_cast<u32>(p_state.range(0));
+	IdGuard l_guard(l_size);
+	std::vector<Id> l_ids(l_size);
+	AllocationScope l_allocations;
+
+	for (auto _ : p_state)
+	{
+		for (auto& l_id : l_ids)
+			l_id = l_guard.getNextId();
+
+		for (auto l_id : l_ids)
+			l_guard.freeId(l_id);
+	}
+
+	reportAllocations(p_state, l_allocations);
+	reportOperations(p_state, 2u * l_size);
+}
+
+}
+
+BENCHMARK(entityPoolGetEntity)->Apply(applyScales);
+BENCHMARK(entityPoolCreate)->Apply(applyScales);
+BENCHMARK(entityPoolCreateAndRemove)->Apply(applyScales);
+BENCHMARK(idGuardChurn)->Apply(applyScales);
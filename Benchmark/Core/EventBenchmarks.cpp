@@ -0,0 +1,43 @@
+#include <benchmark/benchmark.h>
+#include "EventBus.h"
+#include "BenchmarkTools.h"
+
+using namespace engine;
+using namespace benchmarkTool;
+
+namespace
+{
+
+struct DamageEvent
+{
+	EntityId target;
+	f32 amount;
+};
+
+//one frame: p_state.range(0) events published, buffers swapped and all events read back
+void eventBusPublishAndRead(benchmark::State& p_state)
+{
+	const auto l_size = static_cast<u32>(p_state.range(0));
+	EventBus l_bus;
+	l_bus.registerEvent<DamageEvent>(l_size);
+	AllocationScope l_allocations;
+
+	for (auto _ : p_state)
+	{
+		for (auto i = 0u; i < l_size; i++)
+			l_bus.publish(DamageEvent{i, 1.0f});
+
+		l_bus.swapBuffers();
+
+		f32 l_damage = 0.0f;
+		l_bus.forEach<DamageEvent>([&l_damage](const DamageEvent& p_event){ l_damage += p_event.amount; });
+		benchmark::DoNotOptimize(l_damage);
+	}
+
+	reportAllocations(p_state, l_allocations);
+	reportOperations(p_state, l_size);
+}
+
+}
+
+BENCHMARK(eventBusPublishAndRead)->Apply(applyScales);
@@ -0,0 +1,91 @@
+#include <algorithm>
+#include <random>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include "TransformHierarchy.h"
+#include "ThreadPool.h"
+#include "BenchmarkTools.h"
+
+using namespace engine;
+using namespace benchmarkTool;
+
+namespace
+{
+
+const u32 CHILDREN_PER_NODE = 4u;
+const u32 NR_OF_THREADS = 4u;
+
+//every node gets CHILDREN_PER_NODE children - attached in shuffled order, so storage does not follow ids
+void buildTree(TransformHierarchy& p_hierarchy, u32 p_size)
+{
+	std::vector<EntityId> l_ids(p_size);
+	std::mt19937 l_random(1u);
+
+	for (auto i = 0u; i < p_size; i++)
+	{
+		l_ids[i] = i + 1u;
+		p_hierarchy.add(l_ids[i], Transform2D{1.0f, 0.5f, 0.01f});
+	}
+
+	std::shuffle(l_ids.begin() + 1, l_ids.end(), l_random);
+
+	for (auto i = 1u; i < p_size; i++)
+		p_hierarchy.setParent(l_ids[i], l_ids[(i - 1u) / CHILDREN_PER_NODE]);
+}
+
+void hierarchyPropagate(benchmark::State& p_state)
+{
+	const auto l_size = static_cast<u32>(p_state.range(0));
+	TransformHierarchy l_hierarchy(l_size);
+	buildTree(l_hierarchy, l_size);
+
+	for (auto _ : p_state)
+	{
+		l_hierarchy.propagate();
+		benchmark::DoNotOptimize(l_hierarchy.getWorld(l_size).x);
+	}
+
+	reportOperations(p_state, l_size);
+}
+
+void hierarchyPropagateParallel(benchmark::State& p_state)
+{
+	const auto l_size = static_cast<u32>(p_state.range(0));
+	TransformHierarchy l_hierarchy(l_size);
+	buildTree(l_hierarchy, l_size);
+	ThreadPool l_threadPool(NR_OF_THREADS - 1u);
+
+	for (auto _ : p_state)
+	{
+		l_hierarchy.propagateParallel(l_threadPool);
+		benchmark::DoNotOptimize(l_hierarchy.getWorld(l_size).x);
+	}
+
+	reportOperations(p_state, l_size);
+}
+
+void hierarchyReparent(benchmark::State& p_state)
+{
+	const auto l_size = static_cast<u32>(p_state.range(0));
+	TransformHierarchy l_hierarchy(l_size);
+	buildTree(l_hierarchy, l_size);
+
+	//moves node (with its subtree) between root and its original parent - node changes level every time
+	const auto l_node = static_cast<EntityId>(l_size);
+	const auto l_firstParent = l_hierarchy.getParent(l_node);
+	const auto l_secondParent = static_cast<EntityId>(1u);
+
+	for (auto _ : p_state)
+	{
+		l_hierarchy.setParent(l_node, l_secondParent);
+		l_hierarchy.setParent(l_node, l_firstParent);
+	}
+
+	reportOperations(p_state, 2u);
+}
+
+}
+
+BENCHMARK(hierarchyPropagate)->Apply(applyScales);
+BENCHMARK(hierarchyPropagateParallel)->Apply(applyScales)->UseRealTime();
+BENCHMARK(hierarchyReparent)->Apply(applyScales);
@@ -0,0 +1,110 @@
+#include <memory>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include "Pool.h"
+#include "TestEnities.h"
+#include "BenchmarkTools.h"
+
+using namespace engine;
+using namespace benchmarkTool;
+using namespace testEntity;
+
+namespace
+{
+
+template<typename ElementType>
+void poolAllocateAndClear(benchmark::State& p_state)
+{
+	const auto l_size = static_cast<PoolSize>(p_state.range(0));
+	ContinuousPool<ElementType> l_pool(l_size);
+	AllocationScope l_allocations;
+
+	for (auto _ : p_state)
+	{
+		for (auto i = 0u; i < l_size; i++)
+			benchmark::DoNotOptimize(&l_pool.allocate());
+
+		l_pool.clear();
+	}
+
+	reportAllocations(p_state, l_allocations);
+	reportOperations(p_state, l_size);
+}
+
+template<typename ElementType>
+void poolAllocateAndTakeBack(benchmark::State& p_state)
+{
+	const auto l_size = static_cast<PoolSize>(p_state.range(0));
+	ContinuousPool<ElementType> l_pool(l_size);
+	AllocationScope l_allocations;
+
+	for (auto _ : p_state)
+	{
+		for (auto i = 0u; i < l_size; i++)
+			l_pool.allocate();
+
+		//first element every time - worst case, last element is moved into the gap
+		while (not l_pool.isEmpty())
+			l_pool.takeBack(*l_pool.begin());
+	}
+
+	reportAllocations(p_state, l_allocations);
+	reportOperations(p_state, 2u * l_size);
+}
+
+template<typename ElementType>
+void uniquePtrAllocateAndFree(benchmark::State& p_state)
+{
+	const auto l_size = static_cast<u32>(p_state.range(0));
+	std::vector<std::unique_ptr<ElementType>> l_elements(l_size);
+	AllocationScope l_allocations;
+
+	for (auto _ : p_state)
+	{
+		for (auto& l_element : l_elements)
+			l_element = std::make_unique<ElementType>();
+
+		for (auto& l_element : l_elements)
+			l_element.reset();
+	}
+
+	reportAllocations(p_state, l_allocations);
+	reportOperations(p_state, 2u * l_size);
+}
+
+template<typename ElementType>
+void poolIteration(benchmark::State& p_state)
+{
+	const auto l_size = static_cast<PoolSize>(p_state.range(0));
+	ContinuousPool<ElementType> l_pool(l_size);
+
+	for (auto i = 0u; i < l_size; i++)
+		l_pool.allocate().content[0] = static_cast<Byte>(i);
+
+	for (auto _ : p_state)
+	{
+		u32 l_sum = 0u;
+		for (const auto& l_element : l_pool)
+			l_sum += static_cast<u8>(l_element.content[0]);
+
+		benchmark::DoNotOptimize(l_sum);
+	}
+
+	p_state.SetBytesProcessed(static_cast<int64_t>(p_state.iterations() * l_size * sizeof(ElementType)));
+	reportOperations(p_state, l_size);
+}
+
+}
+
+BENCHMARK_TEMPLATE(poolAllocateAndClear, Entity8)->Apply(applyScales);
+BENCHMARK_TEMPLATE(poolAllocateAndClear, Entity64)->Apply(applyScales);
+BENCHMARK_TEMPLATE(poolAllocateAndClear, Entity512)->Apply(applyScales);
+
+BENCHMARK_TEMPLATE(poolAllocateAndTakeBack, Entity8)->Apply(applyScales);
+BENCHMARK_TEMPLATE(poolAllocateAndTakeBack, Entity64)->Apply(applyScales);
+
+BENCHMARK_TEMPLATE(uniquePtrAllocateAndFree, Entity8)->Apply(applyScales);
+BENCHMARK_TEMPLATE(uniquePtrAllocateAndFree, Entity64)->Apply(applyScales);
+
+BENCHMARK_TEMPLATE(poolIteration, Entity8)->Apply(applyScales);
+BENCHMARK_TEMPLATE(poolIteration, Entity64)->Apply(applyScales);
@@ -0,0 +1,35 @@
+#include <memory>
+#include <benchmark/benchmark.h>
+#include "World.h"
+#include "ComponentProvider.h"
+#include "BenchmarkTools.h"
+
+using namespace engine;
+using namespace benchmarkTool;
+
+namespace
+{
+
+//whole lifetime of one match: world sized for p_state.range(0) entities, filled and destroyed
+void worldCreateFillAndDestroy(benchmark::State& p_state)
+{
+	const auto l_size = static_cast<u32>(p_state.range(0));
+	WorldSettings l_settings;
+	l_settings.maxNrOfEntities = l_size;
+
+	for (auto _ : p_state)
+	{
+		World l_world(std::make_unique<ComponentProvider>(), l_settings);
+
+		for (auto i = 0u; i < l_size; i++)
+			l_world.getEntityController().createEntity();
+
+		benchmark::DoNotOptimize(l_world.getEntityPool().size());
+	}
+
+	reportOperations(p_state, l_size);
+}
+
+}
+
+BENCHMARK(worldCreateFillAndDestroy)->Apply(applyScales);
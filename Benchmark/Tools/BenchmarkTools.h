@@ -0,0 +1,44 @@
+#pragma once
+#include <benchmark/benchmark.h>
+#include "Types.h"
+#include "Constants.h"
+#include "AllocationHook.h"
+#include "PreallocatedComponentProvider.h"
+
+namespace benchmarkTool
+{
+
+using namespace engine;
+using testTool::AllocationScope;
+using testTool::PreallocatedComponentProvider;
+
+//scales used by most benchmarks - number of elements processed in one iteration
+constexpr s32 SMALL_SCALE = 1000;
+constexpr s32 MEDIUM_SCALE = 10000;
+constexpr s32 LARGE_SCALE = 100000;
+
+inline void applyScales(benchmark::internal::Benchmark* p_benchmark)
+{
+	p_benchmark->Arg(SMALL_SCALE)->Arg(MEDIUM_SCALE)->Arg(LARGE_SCALE);
+}
+
+//items/s plus time of single operation ("time/op", printed with SI prefix, e.g. 12.3ns)
+inline void reportOperations(benchmark::State& p_state, u64 p_operationsPerIteration)
+{
+	p_state.SetItemsProcessed(static_cast<int64_t>(p_state.iterations() * p_operationsPerIteration));
+	p_state.counters["time/op"] = benchmark::Counter(static_cast<double>(p_operationsPerIteration),
+		benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert);
+}
+
+//allocations and allocated bytes per iteration ("allocs/iter", "bytes/iter") of the benchmark thread
+inline void reportAllocations(benchmark::State& p_state, const AllocationScope& p_allocations)
+{
+	//read before counters are inserted - insertion allocates on this thread
+	const auto l_nrOfAllocations = p_allocations.getNumOfAllocations();
+	const auto l_allocatedBytes = p_allocations.getAllocatedBytes();
+
+	p_state.counters["allocs/iter"] = benchmark::Counter(static_cast<double>(l_nrOfAllocations), benchmark::Counter::kAvgIterations);
+	p_state.counters["bytes/iter"] = benchmark::Counter(static_cast<double>(l_allocatedBytes), benchmark::Counter::kAvgIterations);
+}
+
+}
@@ -0,0 +1,260 @@
+#!/usr/bin/env python3
+"""
+Performance regression gate.
+
+Runs the benchmarks binary with repetitions, reduces every benchmark to median and MAD
+(median absolute deviation) of its real time and compares them with a checked-in baseline.
+A benchmark regresses when its median is slower than the baseline median by more than
+the threshold (percent) AND the difference is above the noise level of both runs
+(NOISE_FACTOR robust standard deviations estimated from MAD) - single noisy repetitions
+do not fail the gate. Repetitions are interleaved randomly, so a slow period of the machine
+spreads over all benchmarks. Regressed benchmarks are then run again in new processes (--confirmations)
+and fail the gate only if every run on its own regresses - a fresh process gets a fresh placement
+of stack and heap, so a slowdown caused by unlucky alignment of one run does not fail the gate,
+while a slowdown of the code itself shows up in every run.
+
+Usage:
+    benchmark_gate.py --benchmarks <binary> --baseline <json> [--threshold 10] [--update]
+
+--update runs the same set of benchmarks and writes the baseline instead of comparing.
+Baselines are machine specific, regenerate them on the machine which runs the gate.
+Uses only the standard library, nothing leaves the local machine.
+"""
+
+import argparse
+import json
+import os
+import platform
+import re
+import statistics
+import subprocess
+import sys
+import tempfile
+
+BASELINE_VERSION = 1
+
+# hot paths guarded by default: EntityPool::create, ContinuousPool::takeBack, queries and iteration
+DEFAULT_FILTER = "^(entityPoolCreate|poolAllocateAndTakeBack|componentMaskQuery|componentChainIteration|poolIteration)"
+DEFAULT_THRESHOLD = 10.0
+DEFAULT_REPETITIONS = 10
+DEFAULT_MIN_TIME = 0.05
+DEFAULT_CONFIRMATIONS = 2
+
+NOISE_FACTOR = 3.0
+MAD_TO_SIGMA = 1.4826
+
+TIME_UNIT_TO_NS = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+
+def parse_arguments():
+    parser = argparse.ArgumentParser(description="Compare benchmark results with stored baseline")
+    parser.add_argument("--benchmarks", help="path to benchmarks binary")
+    parser.add_argument("--results", help="use existing JSON results (with repetitions) instead of running benchmarks")
+    parser.add_argument("--baseline", required=True, help="baseline JSON file")
+    parser.add_argument("--threshold", type=float, default=DEFAULT_THRESHOLD, help="allowed slowdown in percent")
+    parser.add_argument("--filter", default=DEFAULT_FILTER, help="regex of benchmarks guarded by the gate")
+    parser.add_argument("--repetitions", type=int, default=DEFAULT_REPETITIONS)
+    parser.add_argument("--min-time", type=float, default=DEFAULT_MIN_TIME, help="minimal time of one repetition [s]")
+    parser.add_argument("--confirmations", type=int, default=DEFAULT_CONFIRMATIONS,
+                        help="number of additional runs a regression has to be repeated in")
+    parser.add_argument("--build-type", default="", help="build type of benchmarks, stored in baseline and checked")
+    parser.add_argument("--update", action="store_true", help="write baseline instead of comparing")
+
+    arguments = parser.parse_args()
+    if not arguments.benchmarks and not arguments.results:
+        parser.error("--benchmarks or --results is required")
+
+    return arguments
+
+
+def run_benchmarks(arguments, name_filter):
+    handle, output_path = tempfile.mkstemp(suffix=".json")
+    os.close(handle)
+
+    command = [arguments.benchmarks,
+               "--benchmark_filter=" + name_filter,
+               "--benchmark_enable_random_interleaving=true",
+               "--benchmark_repetitions=%d" % arguments.repetitions,
+               "--benchmark_min_time=%g" % arguments.min_time,
+               "--benchmark_out=" + output_path,
+               "--benchmark_out_format=json"]
+
+    print("Running: " + " ".join(command), flush=True)
+
+    try:
+        subprocess.run(command, check=True, stdout=subprocess.DEVNULL)
+        with open(output_path) as results_file:
+            return json.load(results_file)
+    finally:
+        os.remove(output_path)
+
+
+def load_json(path):
+    with open(path) as json_file:
+        return json.load(json_file)
+
+
+def collect_times(results, name_filter):
+    """Real time of every repetition in ns, grouped by benchmark name. Aggregates are skipped."""
+    pattern = re.compile(name_filter)
+    times = {}
+
+    for benchmark in results.get("benchmarks", []):
+        if benchmark.get("run_type", "iteration") != "iteration" or "error_occurred" in benchmark:
+            continue
+
+        name = benchmark.get("run_name", benchmark["name"])
+        if not pattern.search(name):
+            continue
+
+        scale = TIME_UNIT_TO_NS[benchmark.get("time_unit", "ns")]
+        times.setdefault(name, []).append(benchmark["real_time"] * scale)
+
+    return times
+
+
+def summarize(samples):
+    median = statistics.median(samples)
+    mad = statistics.median([abs(sample - median) for sample in samples])
+
+    return {"median_ns": median, "mad_ns": mad, "repetitions": len(samples)}
+
+
+def describe_context(results, build_type):
+    context = results.get("context", {})
+
+    return {"host": context.get("host_name", platform.node()),
+            "num_cpus": context.get("num_cpus"),
+            "mhz_per_cpu": context.get("mhz_per_cpu"),
+            "build_type": build_type}
+
+
+def write_baseline(path, summaries, context, arguments):
+    baseline = {"version": BASELINE_VERSION,
+                "context": context,
+                "filter": arguments.filter,
+                "benchmarks": dict(sorted(summaries.items()))}
+
+    with open(path, "w") as baseline_file:
+        json.dump(baseline, baseline_file, indent=2)
+        baseline_file.write("\n")
+
+    print("Baseline with %d benchmarks written to %s" % (len(summaries), path))
+
+
+def warn_about_context(baseline_context, current_context):
+    for key in ("host", "num_cpus", "build_type"):
+        if baseline_context.get(key) != current_context.get(key):
+            print("WARNING: %s differs from baseline (%s vs %s), results may not be comparable"
+                  % (key, current_context.get(key), baseline_context.get(key)))
+
+
+def get_noise(expected, current):
+    return NOISE_FACTOR * MAD_TO_SIGMA * max(expected["mad_ns"], current["mad_ns"])
+
+
+def is_regression(expected, current, threshold):
+    difference = current["median_ns"] - expected["median_ns"]
+    return 100.0 * difference / expected["median_ns"] > threshold and difference > get_noise(expected, current)
+
+
+def compare(baseline, summaries, threshold, name_filter):
+    regressions = []
+    missing = []
+    pattern = re.compile(name_filter)
+
+    print("%-50s %12s %12s %9s  %s" % ("benchmark", "baseline", "current", "change", "status"))
+
+    for name, expected in sorted(baseline["benchmarks"].items()):
+        if not pattern.search(name):
+            continue
+
+        current = summaries.get(name)
+        if current is None:
+            missing.append(name)
+            print("%-50s %12.1f %12s %9s  MISSING" % (name, expected["median_ns"], "-", "-"))
+            continue
+
+        difference = current["median_ns"] - expected["median_ns"]
+        change = 100.0 * difference / expected["median_ns"]
+
+        if is_regression(expected, current, threshold):
+            status = "REGRESSION"
+            regressions.append(name)
+        elif change < -threshold and -difference > get_noise(expected, current):
+            status = "improved"
+        else:
+            status = "ok"
+
+        print("%-50s %12.1f %12.1f %+8.1f%%  %s" % (name, expected["median_ns"], current["median_ns"], change, status))
+
+    return regressions, missing
+
+
+def confirm_regressions(arguments, baseline, regressions):
+    """Runs regressed benchmarks again, each run in a new process judged on its own samples."""
+    if arguments.results:
+        return regressions
+
+    for run in range(arguments.confirmations):
+        if not regressions:
+            break
+
+        print("\nConfirming %d regressions (run %d of %d)..." % (len(regressions), run + 1, arguments.confirmations))
+        name_filter = "^(" + "|".join(re.escape(name) for name in regressions) + ")$"
+        times = collect_times(run_benchmarks(arguments, name_filter), name_filter)
+
+        confirmed = []
+        for name in regressions:
+            samples = times.get(name)
+            if samples and not is_regression(baseline["benchmarks"][name], summarize(samples), arguments.threshold):
+                print("%s is within threshold in confirmation run (%.1f ns)" % (name, summarize(samples)["median_ns"]))
+            else:
+                confirmed.append(name)
+
+        regressions = confirmed
+
+    return regressions
+
+
+def main():
+    arguments = parse_arguments()
+
+    results = load_json(arguments.results) if arguments.results else run_benchmarks(arguments, arguments.filter)
+    times = collect_times(results, arguments.filter)
+    summaries = {name: summarize(samples) for name, samples in times.items()}
+    context = describe_context(results, arguments.build_type)
+
+    if not summaries:
+        print("No benchmark matched filter: " + arguments.filter)
+        return 2
+
+    if arguments.update:
+        write_baseline(arguments.baseline, summaries, context, arguments)
+        return 0
+
+    baseline = load_json(arguments.baseline)
+    if baseline.get("version") != BASELINE_VERSION:
+        print("Unsupported baseline version: %s" % baseline.get("version"))
+        return 2
+
+    warn_about_context(baseline.get("context", {}), context)
+    regressions, missing = compare(baseline, summaries, arguments.threshold, arguments.filter)
+
+    if regressions:
+        regressions = confirm_regressions(arguments, baseline, regressions)
+
+    if missing:
+        print("\n%d baseline benchmarks were not run (renamed or removed?) - update the baseline" % len(missing))
+    if regressions:
+        print("\n%d benchmarks regressed by more than %.1f%%: %s" % (len(regressions), arguments.threshold, ", ".join(regressions)))
+
+    if regressions or missing:
+        return 1
+
+    print("\nNo regressions above %.1f%%" % arguments.threshold)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
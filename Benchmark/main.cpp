@@ -0,0 +1,9 @@
+#include <benchmark/benchmark.h>
+
+/*
+	Machine-readable results:
+	benchmarks --benchmark_out=results.json --benchmark_out_format=json
+	(or build target run_benchmarks which writes benchmarks.json to the build directory)
+*/
+
+BENCHMARK_MAIN();
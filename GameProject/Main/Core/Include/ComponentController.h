@@ -1,6 +1,8 @@
 #pragma once
+#include <memory>
 #include "IComponentController.h"
 #include "IComponentProvider.h"
+#include "ComponentObservers.h"
 
 namespace engine
 {
@@ -16,7 +18,15 @@ public:
 	bool detachComponent(Entity&, ComponentType) override;
 	bool detachMultipleComponents(Entity&, const ComponentIndicators&) override;
 
+	bool attachPrefab(Entity* p_entities, u32 p_count, const Prefab&) override;
+
+	//attached store is notified about every attach and detach
+	void attachObservers(ComponentObservers&);
+
 private:
+	//components of prefab are requested from provider in batches of this size
+	static constexpr u32 PREFAB_BATCH_SIZE = 256u;
+
 	bool isComponentAlreadyAttached(Entity&, ComponentType) const;
 	void attachComponentToEntity(Entity&, ComponentType);
 	void attachToNextFreePosition(Entity&, ComponentBase&);
@@ -33,8 +43,12 @@ private:
 	void detachMultipleComponentsFromEntity(Entity&, const ComponentIndicators&);
 	void detachRequestedComponentsFromEntity(Entity&, const ComponentIndicators&);
 	ComponentType convertIndexToComponentType(ComponentIndex) const;
+	void attachPrefabToEntities(Entity* p_entities, u32 p_count, const Prefab&);
+	void notifyPrefabAttached(Entity* p_entities, u32 p_count, const ComponentIndicators&);
+	void notifyAdd(Entity&, ComponentType, const ComponentIndicators& p_componentsBefore);
 
 	std::unique_ptr<IComponentProvider> m_componentProvider;
+	ComponentObservers* m_observers = nullptr;
 };
 
 }
@@ -41,6 +41,12 @@ public:
 		m_componentFlags.reset();
 	}
 
+	//flags of first 32 component types as number, e.g. index of lookup table
+	u32 toNumber() const
+	{
+		return static_cast<u32>((m_componentFlags & ComponentFlags(~0u)).to_ulong());
+	}
+
 	u32 getNumOfSetComponents() const
 	{
 		return static_cast<u32>(m_componentFlags.count());
@@ -0,0 +1,92 @@
+#pragma once
+#include <array>
+#include <memory_resource>
+#include <vector>
+#include "Types.h"
+#include "Constants.h"
+#include "ComponentTypes.h"
+#include "ComponentIndicators.h"
+#include "IComponentObserver.h"
+
+namespace engine
+{
+
+/*
+	Observers of component transitions, evaluated by ComponentController on attach and detach:
+	- onAdd(type, required) - type was attached and entity has all required components,
+	- onRemove(type, required) - type is going to be detached (component is still linked) from entity with required components,
+	- onMatch(mask) - attach made entity have all components of mask.
+	Subscriptions are compiled into table indexed by (transition, component type, mask before transition),
+	every entry keeps observers to notify - transition costs one lookup, no matter how many observers exist.
+	Table is rebuilt on subscribe/unsubscribe, which must not happen during notification.
+	Observers are notified in order of subscription.
+*/
+
+class ComponentObservers
+{
+public:
+	ComponentObservers(std::pmr::memory_resource& = *std::pmr::get_default_resource());
+	ComponentObservers(const ComponentObservers&) = delete;
+
+	void onAdd(ComponentType, IComponentObserver&, const ComponentIndicators& p_required = ComponentIndicators());
+	void onRemove(ComponentType, IComponentObserver&, const ComponentIndicators& p_required = ComponentIndicators());
+	void onMatch(const ComponentIndicators& p_mask, IComponentObserver&);
+
+	template<typename ComponentStruct>
+	void onAdd(IComponentObserver& p_observer, const ComponentIndicators& p_required = ComponentIndicators())
+	{
+		onAdd(ComponentStruct::TYPE, p_observer, p_required);
+	}
+
+	template<typename ComponentStruct>
+	void onRemove(IComponentObserver& p_observer, const ComponentIndicators& p_required = ComponentIndicators())
+	{
+		onRemove(ComponentStruct::TYPE, p_observer, p_required);
+	}
+
+	//drops all subscriptions of observer
+	void unsubscribe(IComponentObserver&);
+	bool empty() const;
+
+	//p_componentsBefore - entity components before transition
+	void notifyAdd(Entity&, ComponentType, const ComponentIndicators& p_componentsBefore) const;
+	void notifyRemove(Entity&, ComponentType, const ComponentIndicators& p_componentsBefore) const;
+
+private:
+	static constexpr u32 NR_OF_TYPES = LAST_VALID_COMPONENT_INDEX + 1u;
+	static constexpr u32 NR_OF_MASKS = 1u << NR_OF_TYPES;
+	static_assert(NR_OF_TYPES <= 16u, "Transition table grows as 2^(number of component types)");
+
+	enum class Transition : u32
+	{
+		ADD = 0,
+		REMOVE = 1,
+		MATCH = 2
+	};
+
+	struct Subscription
+	{
+		Transition transition;
+		ComponentType type;
+		ComponentIndicators mask;
+		IComponentObserver* observer;
+	};
+
+	struct Range
+	{
+		u32 begin = 0u;
+		u32 end = 0u;
+	};
+
+	void subscribe(const Subscription&);
+	void rebuildTable();
+	bool shouldNotify(const Subscription&, bool p_isAdd, ComponentType, const ComponentIndicators& p_before) const;
+	u32 getTableIndex(bool p_isAdd, ComponentType, const ComponentIndicators& p_before) const;
+	void notify(u32 p_tableIndex, Entity&, ComponentType) const;
+
+	std::pmr::vector<Subscription> m_subscriptions;
+	std::pmr::vector<IComponentObserver*> m_observers;
+	std::pmr::vector<Range> m_table;
+};
+
+}
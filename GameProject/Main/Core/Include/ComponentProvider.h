@@ -8,6 +8,7 @@ class ComponentProvider : public IComponentProvider
 {
 public:
 	ComponentBase& createComponent(ComponentType) override;
+	void createComponents(ComponentType, u32 p_count, ComponentBase** p_components) override;
 	bool removeComponent(ComponentBase&) override;
 };
 
@@ -1,5 +1,9 @@
 #pragma once
+#include <string>
+#include <vector>
+#include <memory_resource>
 #include "IEntityChangeDistributor.h"
+#include "MetricsRegistry.h"
 
 namespace engine
 {
@@ -7,9 +11,23 @@ namespace engine
 class EntityChangeDistributor : public IEntityChangeDistributor
 {
 public:
+	EntityChangeDistributor(std::pmr::memory_resource& = *std::pmr::get_default_resource());
 
 	void distributeEntityChange(EntityId p_id) override;
 
+	void registerListener(IEntityChangeListener&) override;
+	void deregisterListener(IEntityChangeListener&) override;
+
+	//"<prefix>.changes" counter (distributed changes) and ".listeners" gauge
+	void attachMetrics(MetricsRegistry&, const std::string& p_prefix);
+
+private:
+	bool isRegistered(const IEntityChangeListener&) const;
+	void updateListenersMetric();
+
+	std::pmr::vector<IEntityChangeListener*> m_listeners;
+	metrics::Counter* m_changesMetric = nullptr;
+	metrics::Gauge* m_listenersMetric = nullptr;
 };
 
-}
\ No newline at end of file
+}
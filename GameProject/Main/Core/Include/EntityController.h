@@ -1,10 +1,14 @@
 #pragma once
 #include <memory>
+#include <string>
 #include "IEntityController.h"
 #include "EntityChangeDistributor.h"
 #include "IdGuard.h"
 #include "IEntityPool.h"
 #include "IComponentController.h"
+#include "MetricsRegistry.h"
+#include "RelationStore.h"
+#include "TransformHierarchy.h"
 
 namespace engine
 {
@@ -18,6 +22,8 @@ public:
 
 	EntityId createEntity() override;
 	EntityId createEntityWithComponents(const ComponentIndicators&) override;
+	EntityId createEntityFromPrefab(const Prefab&) override;
+	void createEntitiesFromPrefab(const Prefab&, u32 p_count, EntityId* p_ids = nullptr) override;
 
 	bool removeEntity(EntityId) override;
 
@@ -30,14 +36,35 @@ public:
 	bool connectMultipleComponentsToEntity(EntityId, const ComponentIndicators&) override;
 	bool disconnectMultipleComponentsFromEntity(EntityId, const ComponentIndicators&) override;
 
+	//"<prefix>.creates", ".removes", ".attaches", ".detaches" counters - attach/detach count successful operations
+	void attachMetrics(MetricsRegistry&, const std::string& p_prefix);
+	//relations of removed entities are dropped from attached store
+	void attachRelations(RelationStore&);
+	//removed entities are removed from attached hierarchy, their children become roots
+	void attachHierarchy(TransformHierarchy&);
+
 private:
+	struct Metrics
+	{
+		metrics::Counter* creates = nullptr;
+		metrics::Counter* removes = nullptr;
+		metrics::Counter* attaches = nullptr;
+		metrics::Counter* detaches = nullptr;
+	};
+
+	static void increment(metrics::Counter*, u64 p_value = 1u);
+
 	void disconnectAllComponentsFromEntity(EntityId);
 	bool connectMultipleComponents(Entity&, const ComponentIndicators&);
 	bool disconnectMultipleComponents(Entity&, const ComponentIndicators&);
+	void connectPrefab(Entity* p_entities, u32 p_count, const Prefab&);
 
 	std::unique_ptr<IEntityPool> m_pool;
 	std::unique_ptr<IComponentController> m_componentController;
 	IEntityChangeDistributor& m_changeDistributor;
+	Metrics m_metrics;
+	RelationStore* m_relations = nullptr;
+	TransformHierarchy* m_hierarchy = nullptr;
 
 };
 
@@ -0,0 +1,126 @@
+#pragma once
+#include <memory>
+#include <memory_resource>
+#include <utility>
+#include <vector>
+#include "Types.h"
+#include "EventQueue.h"
+#include "TypeIndex.h"
+#include "assert.h"
+
+namespace engine
+{
+
+/*
+	Typed messaging between systems - one EventQueue per event type, found by type index in O(1).
+	Event types have to be registered before use (buffers are allocated there, never on publish).
+	Events published in frame N are read in frame N + 1, swapBuffers() is called once at frame boundary
+	by owner of the loop. Type indices are shared by all buses, queues are not. Queues and their
+	buffers are allocated from memory resource of the bus.
+*/
+
+class EventBus
+{
+public:
+	EventBus(u32 p_nrOfThreads = 1u, std::pmr::memory_resource& = *std::pmr::get_default_resource());
+	EventBus(const EventBus&) = delete;
+
+	template<typename Event>
+	bool registerEvent(u32 p_capacityPerThread)
+	{
+		const auto l_index = getEventTypeIndex<Event>();
+
+		if (l_index < m_queues.size() and m_queues[l_index])
+		{
+			return false;
+		}
+
+		if (l_index >= m_queues.size())
+		{
+			m_queues.resize(l_index + 1u);
+		}
+
+		std::pmr::polymorphic_allocator<EventQueue<Event>> l_allocator(m_queues.get_allocator());
+		auto l_queue = l_allocator.allocate(1u);
+		l_allocator.construct(l_queue, p_capacityPerThread, m_nrOfThreads, *l_allocator.resource());
+
+		m_queues[l_index] = QueuePtr(l_queue, QueueDeleter{&destroy<Event>, l_allocator.resource()});
+		return true;
+	}
+
+	template<typename Event>
+	bool isRegistered() const
+	{
+		const auto l_index = getEventTypeIndex<Event>();
+		return l_index < m_queues.size() and m_queues[l_index] != nullptr;
+	}
+
+	template<typename Event>
+	EventQueue<Event>& getQueue()
+	{
+		assert(isRegistered<Event>());
+		return static_cast<EventQueue<Event>&>(*m_queues[getEventTypeIndex<Event>()]);
+	}
+
+	template<typename Event>
+	const EventQueue<Event>& getQueue() const
+	{
+		assert(isRegistered<Event>());
+		return static_cast<const EventQueue<Event>&>(*m_queues[getEventTypeIndex<Event>()]);
+	}
+
+	template<typename Event>
+	bool publish(const Event& p_event, u32 p_threadIndex = 0u)
+	{
+		return getQueue<Event>().push(p_event, p_threadIndex);
+	}
+
+	//events of previous frame
+	template<typename Event>
+	EventSpan<Event> getEvents(u32 p_threadIndex) const
+	{
+		return getQueue<Event>().getEvents(p_threadIndex);
+	}
+
+	template<typename Event, typename Function>
+	void forEach(Function&& p_function) const
+	{
+		getQueue<Event>().forEach(std::forward<Function>(p_function));
+	}
+
+	void swapBuffers();
+	u32 getNumOfThreads() const;
+
+private:
+	struct QueueDeleter
+	{
+		void (*destroy)(IEventQueue*, std::pmr::memory_resource&) = nullptr;
+		std::pmr::memory_resource* memoryResource = nullptr;
+
+		void operator()(IEventQueue* p_queue) const
+		{
+			destroy(p_queue, *memoryResource);
+		}
+	};
+
+	using QueuePtr = std::unique_ptr<IEventQueue, QueueDeleter>;
+
+	template<typename Event>
+	static u32 getEventTypeIndex()
+	{
+		return TypeIndex<EventBus>::get<Event>();
+	}
+
+	template<typename Event>
+	static void destroy(IEventQueue* p_queue, std::pmr::memory_resource& p_memoryResource)
+	{
+		auto l_queue = static_cast<EventQueue<Event>*>(p_queue);
+		l_queue->~EventQueue<Event>();
+		std::pmr::polymorphic_allocator<EventQueue<Event>>(&p_memoryResource).deallocate(l_queue, 1u);
+	}
+
+	const u32 m_nrOfThreads;
+	std::pmr::vector<QueuePtr> m_queues;
+};
+
+}
@@ -0,0 +1,207 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <type_traits>
+#include <vector>
+#include "Types.h"
+#include "FrameArena.h"
+#include "assert.h"
+
+namespace engine
+{
+
+class IEventQueue
+{
+public:
+	IEventQueue() = default;
+	virtual ~IEventQueue() = default;
+
+	virtual void swapBuffers() = 0;
+};
+
+template<typename Event>
+class EventSpan
+{
+public:
+	EventSpan(const Event* p_begin, const Event* p_end)
+		:m_begin(p_begin),
+		 m_end(p_end)
+	{
+	}
+
+	const Event* begin() const { return m_begin; }
+	const Event* end() const { return m_end; }
+	u32 size() const { return static_cast<u32>(m_end - m_begin); }
+	bool empty() const { return m_begin == m_end; }
+
+private:
+	const Event* m_begin;
+	const Event* m_end;
+};
+
+/*
+	Double buffered queue of one event type. Every producer thread writes into its own pair of buffers
+	which starts on a cache line and is padded to whole lines (thread index passed explicitly, like in
+	FrameArena), so push is a bounds check and a copy - no lock, no virtual call, no allocation.
+	Buffers are allocated once, from given memory resource.
+	Consumers read events pushed in previous frame in bulk, per producer or all at once. swapBuffers()
+	at frame boundary flips buffers without copying and must not run concurrently with push. Buffers have fixed capacity - push into full one fails
+	and the event is counted as dropped.
+*/
+
+template<typename Event>
+class EventQueue : public IEventQueue
+{
+public:
+	static_assert(std::is_trivially_copyable_v<Event>, "Events have to be plain data");
+	static_assert(alignof(Event) <= core::CACHE_LINE_SIZE, "Events can not be aligned stricter than cache line");
+
+	EventQueue(u32 p_capacityPerThread, u32 p_nrOfThreads = 1u,
+			   std::pmr::memory_resource& p_memoryResource = *std::pmr::get_default_resource())
+		:m_capacityPerThread(p_capacityPerThread),
+		 m_bytesPerProducer(getBytesPerProducer(p_capacityPerThread)),
+		 m_memoryResource(p_memoryResource),
+		 m_producers(p_nrOfThreads, &p_memoryResource)
+	{
+		assert(m_bytesPerProducer <= std::numeric_limits<std::size_t>::max() / std::max(p_nrOfThreads, 1u));
+
+		m_memory = static_cast<u8*>(m_memoryResource.allocate(getNumOfBytes(), core::CACHE_LINE_SIZE));
+		auto l_producerMemory = m_memory;
+
+		for (auto& l_producer : m_producers)
+		{
+			l_producer.buffers[0] = reinterpret_cast<Event*>(l_producerMemory);
+			l_producer.buffers[1] = l_producer.buffers[0] + p_capacityPerThread;
+			std::uninitialized_default_construct_n(l_producer.buffers[0], 2u * std::size_t(p_capacityPerThread));
+			l_producerMemory += m_bytesPerProducer;
+		}
+	}
+
+	EventQueue(const EventQueue&) = delete;
+
+	~EventQueue() override
+	{
+		//events are trivially destructible - buffers are just given back
+		m_memoryResource.deallocate(m_memory, getNumOfBytes(), core::CACHE_LINE_SIZE);
+	}
+
+	bool push(const Event& p_event, u32 p_threadIndex = 0u)
+	{
+		assert(p_threadIndex < m_producers.size());
+
+		auto& l_producer = m_producers[p_threadIndex];
+		auto& l_size = l_producer.sizes[m_writeBuffer];
+
+		if (l_size == m_capacityPerThread)
+		{
+			++l_producer.nrOfDroppedEvents;
+			return false;
+		}
+
+		l_producer.buffers[m_writeBuffer][l_size++] = p_event;
+		return true;
+	}
+
+	void swapBuffers() override
+	{
+		m_writeBuffer ^= 1u;
+		m_nrOfDroppedEvents = 0u;
+
+		for (auto& l_producer : m_producers)
+		{
+			l_producer.sizes[m_writeBuffer] = 0u;
+			m_nrOfDroppedEvents += l_producer.nrOfDroppedEvents;
+			l_producer.nrOfDroppedEvents = 0u;
+		}
+	}
+
+	//events pushed by one producer in previous frame
+	EventSpan<Event> getEvents(u32 p_threadIndex) const
+	{
+		const auto& l_producer = m_producers[p_threadIndex];
+		const auto l_readBuffer = m_writeBuffer ^ 1u;
+
+		return EventSpan<Event>(l_producer.buffers[l_readBuffer], l_producer.buffers[l_readBuffer] + l_producer.sizes[l_readBuffer]);
+	}
+
+	//all events of previous frame, producer after producer
+	template<typename Function>
+	void forEach(Function&& p_function) const
+	{
+		for (auto i = 0u; i < getNumOfThreads(); i++)
+		{
+			for (const auto& l_event : getEvents(i))
+			{
+				p_function(l_event);
+			}
+		}
+	}
+
+	u32 size() const
+	{
+		auto l_size = 0u;
+
+		for (auto i = 0u; i < getNumOfThreads(); i++)
+		{
+			l_size += getEvents(i).size();
+		}
+
+		return l_size;
+	}
+
+	//events which did not fit into buffers in previous frame
+	u32 getNumOfDroppedEvents() const
+	{
+		return m_nrOfDroppedEvents;
+	}
+
+	u32 getNumOfThreads() const
+	{
+		return static_cast<u32>(m_producers.size());
+	}
+
+	u32 getCapacityPerThread() const
+	{
+		return m_capacityPerThread;
+	}
+
+private:
+	static std::size_t alignUp(std::size_t p_value)
+	{
+		return (p_value + core::CACHE_LINE_SIZE - 1u) & ~(core::CACHE_LINE_SIZE - 1u);
+	}
+
+	//size computed in std::size_t - 2 * capacity * sizeof(Event) overflows u32 for big queues
+	static std::size_t getBytesPerProducer(u32 p_capacityPerThread)
+	{
+		const auto l_bytes = 2u * std::size_t(p_capacityPerThread) * sizeof(Event);
+
+		assert(l_bytes / sizeof(Event) / 2u == p_capacityPerThread);
+		return alignUp(l_bytes);
+	}
+
+	std::size_t getNumOfBytes() const
+	{
+		return m_bytesPerProducer * m_producers.size();
+	}
+
+	struct alignas(core::CACHE_LINE_SIZE) Producer
+	{
+		Event* buffers[2] = {nullptr, nullptr};
+		u32 sizes[2] = {0u, 0u};
+		u32 nrOfDroppedEvents = 0u;
+	};
+
+	const u32 m_capacityPerThread;
+	const std::size_t m_bytesPerProducer;
+	std::pmr::memory_resource& m_memoryResource;
+	u8* m_memory = nullptr;
+	std::pmr::vector<Producer> m_producers;
+	u32 m_writeBuffer = 0u;
+	u32 m_nrOfDroppedEvents = 0u;
+};
+
+}
@@ -0,0 +1,87 @@
+#pragma once
+#include <atomic>
+#include "Types.h"
+#include "ISystemController.h"
+
+namespace engine
+{
+
+struct FixedTimestepSettings
+{
+	f32 fixedTimeStep = 1.0f / 60.0f;
+	u32 maxTicksPerAdvance = 5u;  //catch-up cap, 0 - no cap
+	bool dropExcessTime = true;   //spiral-of-death protection - time which did not fit into the cap is dropped
+	f32 maxElapsedTime = 0.25f;   //longer frames (hitches, breakpoints) are clamped to it, 0 - no clamp
+};
+
+/*
+	Tick times in milliseconds. Wall time includes preemption and page fault stalls of the machine,
+	CPU time is time of the ticking thread only - compare both to tell slow code from busy host.
+	Work which systems hand over to other threads (ThreadPool) is counted only in wall time.
+*/
+struct TickStats
+{
+	u64 nrOfTicks = 0u;
+	u64 nrOfDroppedTicks = 0u;
+
+	f64 lastTickTime = 0.0;
+	f64 minTickTime = 0.0;
+	f64 maxTickTime = 0.0;
+	f64 totalTickTime = 0.0;
+
+	f64 lastTickCpuTime = 0.0;
+	f64 maxTickCpuTime = 0.0;
+	f64 totalTickCpuTime = 0.0;
+
+	f64 getAverageTickTime() const
+	{
+		return nrOfTicks == 0u ? 0.0 : totalTickTime / static_cast<f64>(nrOfTicks);
+	}
+
+	f64 getAverageTickCpuTime() const
+	{
+		return nrOfTicks == 0u ? 0.0 : totalTickCpuTime / static_cast<f64>(nrOfTicks);
+	}
+};
+
+/*
+	Drives ISystemController with constant time step: elapsed real time is accumulated and consumed
+	in fixed ticks, so simulation result does not depend on frame rate. Every tick is measured (wall and thread CPU time).
+	advance() is meant for loops which own the clock (e.g. render loop), run() is a headless loop
+	for dedicated server - either paced to real time or as fast as possible (load testing).
+	Leftover time can be used for interpolation - getInterpolationAlpha().
+*/
+
+class FixedTimestepLoop
+{
+public:
+	FixedTimestepLoop(ISystemController&, const FixedTimestepSettings& = FixedTimestepSettings());
+	FixedTimestepLoop(const FixedTimestepLoop&) = delete;
+
+	u32 advance(f32 p_elapsedTime);
+	void tick();
+
+	//p_nrOfTicks == 0 - runs until requestStop()
+	u64 run(u64 p_nrOfTicks, bool p_paceToRealTime);
+	//only sets atomic flag - can be called from other thread or signal handler
+	void requestStop();
+
+	f32 getInterpolationAlpha() const;
+	const TickStats& getStats() const;
+	void resetStats();
+
+	const FixedTimestepSettings& getSettings() const;
+
+private:
+	void dropExcessTime();
+	void registerTickTime(f64 p_tickTime, f64 p_cpuTime);
+
+	ISystemController& m_systems;
+	const FixedTimestepSettings m_settings;
+
+	f64 m_accumulator = 0.0;
+	TickStats m_stats;
+	std::atomic<bool> m_stopRequested = false;
+};
+
+}
@@ -5,6 +5,7 @@
 #include "ComponentTypes.h"
 #include "ComponentBase.h"
 #include "Entity.h"
+#include "Prefab.h"
 
 namespace engine
 {
@@ -20,6 +21,9 @@ public:
 
 	virtual bool detachComponent(Entity&, ComponentType) = 0;
 	virtual bool detachMultipleComponents(Entity&, const ComponentIndicators&) = 0;
+
+	//p_entities - p_count consecutive entities without any components
+	virtual bool attachPrefab(Entity* p_entities, u32 p_count, const Prefab&) = 0;
 };
 
 }
\ No newline at end of file
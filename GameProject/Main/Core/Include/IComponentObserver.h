@@ -0,0 +1,20 @@
+#pragma once
+#include "Types.h"
+#include "Constants.h"
+#include "ComponentTypes.h"
+#include "Entity.h"
+
+namespace engine
+{
+
+class IComponentObserver
+{
+public:
+	IComponentObserver() = default;
+	virtual ~IComponentObserver() = default;
+
+	//p_type - component which was attached or is going to be detached
+	virtual void onComponentChange(Entity& p_entity, ComponentType p_type) = 0;
+};
+
+}
@@ -15,6 +15,9 @@ public:
 	virtual ~IComponentProvider() = default;
 
 	virtual ComponentBase& createComponent(ComponentType) = 0;
+
+	//batch version for prefab instantiation - p_components has to fit p_count pointers
+	virtual void createComponents(ComponentType, u32 p_count, ComponentBase** p_components) = 0;
 	virtual bool removeComponent(ComponentBase&) = 0;
 };
 
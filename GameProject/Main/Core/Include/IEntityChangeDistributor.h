@@ -3,6 +3,7 @@
 #include "Constants.h"
 #include "Parameters.h"
 #include "Entity.h"
+#include "IEntityChangeListener.h"
 
 namespace engine
 {
@@ -14,6 +15,9 @@ public:
 	virtual ~IEntityChangeDistributor() = default;
 
 	virtual void distributeEntityChange(EntityId p_id) = 0;
+
+	virtual void registerListener(IEntityChangeListener& p_listener) = 0;
+	virtual void deregisterListener(IEntityChangeListener& p_listener) = 0;
 };
 
-}
\ No newline at end of file
+}
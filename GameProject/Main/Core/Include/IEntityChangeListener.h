@@ -0,0 +1,17 @@
+#pragma once
+#include "Types.h"
+#include "Constants.h"
+
+namespace engine
+{
+
+class IEntityChangeListener
+{
+public:
+	IEntityChangeListener() = default;
+	virtual ~IEntityChangeListener() = default;
+
+	virtual void onEntityChange(EntityId p_id) = 0;
+};
+
+}
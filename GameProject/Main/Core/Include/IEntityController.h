@@ -4,6 +4,7 @@
 #include "Parameters.h"
 #include "ComponentTypes.h"
 #include "Entity.h"
+#include "Prefab.h"
 
 namespace engine
 {
@@ -16,6 +17,9 @@ public:
 
 	virtual EntityId createEntity() = 0;
 	virtual EntityId createEntityWithComponents(const ComponentIndicators& p_components) = 0;
+	virtual EntityId createEntityFromPrefab(const Prefab& p_prefab) = 0;
+	//p_ids (optional) gets ids of created entities, has to fit p_count of them
+	virtual void createEntitiesFromPrefab(const Prefab& p_prefab, u32 p_count, EntityId* p_ids = nullptr) = 0;
 
 	virtual bool removeEntity(EntityId p_id) = 0;
 
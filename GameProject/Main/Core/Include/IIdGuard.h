@@ -5,6 +5,14 @@
 namespace engine
 {
 
+//plain copy of guard counters, freed ids are stored separately
+struct IdGuardState
+{
+	Id currentId = UNDEFINED_ID;
+	u32 nrOfFreedIds = 0u;
+	u32 overflowed = 0u;
+};
+
 class IIdGuard
 {
 public:
@@ -14,6 +22,9 @@ public:
 	virtual Id getNextId() = 0;
 	virtual void freeId(Id p_id) = 0;
 	virtual void reset() = 0;
+
+	virtual IdGuardState saveState(Id* p_freedIds, u32 p_capacity) const = 0;
+	virtual void restoreState(const IdGuardState&, const Id* p_freedIds) = 0;
 };
 
 }
\ No newline at end of file
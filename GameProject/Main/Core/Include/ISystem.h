@@ -1,6 +1,7 @@
 #pragma once
 #include "Types.h"
 #include "Constants.h"
+#include "ResourceAccess.h"
 
 namespace engine
 {
@@ -10,6 +11,15 @@ class ISystem
 public:
 	ISystem() = default;
 	virtual ~ISystem() = default;
+
+	virtual void update(f32 p_deltaTime) = 0;
+
+	//zone name in profiler, has to be a string with static lifetime
+	virtual const char* getName() const { return "System"; }
+
+	//resources used in update, systems with conflicting access are never run in parallel;
+	//system which does not declare its access runs alone
+	virtual ResourceAccess getResourceAccess() const { return ResourceAccess::exclusive(); }
 };
 
 }
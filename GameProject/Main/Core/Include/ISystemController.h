@@ -11,6 +11,11 @@ class ISystemController
 public:
 	ISystemController() = default;
 	virtual ~ISystemController() = default;
+
+	virtual void addSystem(ISystem&, s32 p_priority = 0) = 0;
+	virtual bool removeSystem(ISystem&) = 0;
+	virtual void update(f32 p_deltaTime) = 0;
+	virtual u32 getNumOfSystems() const = 0;
 };
 
 }
\ No newline at end of file
@@ -0,0 +1,23 @@
+#pragma once
+#include <functional>
+#include "Types.h"
+
+namespace engine
+{
+
+class ITaskExecutor
+{
+public:
+	using Task = std::function<void(u32 p_taskIndex)>;
+
+	ITaskExecutor() = default;
+	virtual ~ITaskExecutor() = default;
+
+	//calling thread included
+	virtual u32 getNrOfThreads() const = 0;
+
+	//p_nrOfTasks (up to getNrOfThreads()) run at the same time, returns after all of them finished
+	virtual void run(u32 p_nrOfTasks, const Task&) = 0;
+};
+
+}
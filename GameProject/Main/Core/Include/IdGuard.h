@@ -1,31 +1,60 @@
 #pragma once
 #include "IIdGuard.h"
-#include <set>
+#include <string>
+#include <vector>
+#include <memory_resource>
+#include "MetricsRegistry.h"
 
 namespace engine
 {
 
+/*
+	Freed ids are kept in min-heap (lowest id is reused first) on vector - once the heap has grown
+	to the number of ids freed at once, freeing and reusing ids does not allocate.
+	Flag per id marks ids waiting in the heap - freeing id which is already free (or was never given)
+	is ignored, so one id can not be handed out twice. Flags grow up to the highest freed id.
+*/
+
 class IdGuard : public IIdGuard
 {
 public:
-	IdGuard(Id p_maxId);
+	IdGuard(Id p_maxId, std::pmr::memory_resource& = *std::pmr::get_default_resource());
+	IdGuard(const IdGuard&) = delete;
+	~IdGuard() override;
 
 	Id getNextId() override;
 	void freeId(Id p_id) override;
 	void reset() override;
 
+	IdGuardState saveState(Id* p_freedIds, u32 p_capacity) const override;
+	void restoreState(const IdGuardState&, const Id* p_freedIds) override;
+
+	//"<prefix>.freedIds" (free-list length), ".currentId", ".overflowed" sampled gauges,
+	//".recycledIds" counter is updated per id only with ENGINE_METRICS - like pool counters
+	void attachMetrics(MetricsRegistry&, const std::string& p_prefix);
+
 private:
+	struct Metrics
+	{
+		MetricsRegistry* registry = nullptr;
+		metrics::Counter* recycledIds = nullptr;
+	};
+
 	const Id m_maxId;
 
 	Id m_currentId = engine::UNDEFINED_ID;
-	std::set<Id> m_freedIds;
+	std::pmr::vector<Id> m_freedIds;
+	std::pmr::vector<bool> m_isFreed;
 	bool m_overflowed = false;
+	Metrics m_metrics;
 
 	bool isIdCounterOverflowed();
 	bool hasFreedIds();
 	Id getNextFreeId();
 	Id getNewId();
 	Id getIdFromFreed();
+	bool canBeFreed(Id) const;
+	void markAsFreed(Id, bool p_isFreed);
 };
 
 }
@@ -0,0 +1,37 @@
+#pragma once
+#include "Types.h"
+
+namespace engine
+{
+
+enum class SimdLevel
+{
+	SCALAR,
+	SSE2,
+	AVX2
+};
+
+/*
+	Kinematic integration (position += velocity * dt) over SoA arrays.
+	All kernels perform a separate multiply and add (no FMA), so every level
+	produces bit-identical results - simulation stays deterministic regardless of host CPU.
+*/
+
+using IntegrationKernel = void(*)(f32* p_positionsX, f32* p_positionsY,
+								  const f32* p_velocitiesX, const f32* p_velocitiesY,
+								  u32 p_count, f32 p_deltaTime);
+
+namespace kernels
+{
+	SimdLevel detectSimdLevel();
+	bool isSimdLevelSupported(SimdLevel);
+
+	IntegrationKernel getIntegrationKernel(SimdLevel);
+	IntegrationKernel getBestIntegrationKernel();
+
+	void integrateScalar(f32*, f32*, const f32*, const f32*, u32, f32);
+	void integrateSse2(f32*, f32*, const f32*, const f32*, u32, f32);
+	void integrateAvx2(f32*, f32*, const f32*, const f32*, u32, f32);
+}
+
+}
@@ -0,0 +1,180 @@
+#pragma once
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "Types.h"
+
+namespace engine
+{
+
+namespace metrics
+{
+	//bucket i holds values with i significant bits: 0, 1, 2-3, 4-7, ...
+	constexpr u32 NR_OF_HISTOGRAM_BUCKETS = 65u;
+
+	enum class MetricType
+	{
+		COUNTER,
+		GAUGE,
+		HISTOGRAM
+	};
+
+	//monotonic number of events (creates, take backs, ...)
+	class Counter
+	{
+	public:
+		void add(u64 p_value = 1u)
+		{
+			m_value.fetch_add(p_value, std::memory_order_relaxed);
+		}
+
+		u64 get() const
+		{
+			return m_value.load(std::memory_order_relaxed);
+		}
+
+	private:
+		std::atomic<u64> m_value{ 0u };
+	};
+
+	//current level (pool size, free-list length, ...)
+	class Gauge
+	{
+	public:
+		void set(s64 p_value)
+		{
+			m_value.store(p_value, std::memory_order_relaxed);
+		}
+
+		void add(s64 p_value)
+		{
+			m_value.fetch_add(p_value, std::memory_order_relaxed);
+		}
+
+		//high water mark - value is written only when it grows
+		void setMax(s64 p_value)
+		{
+			auto l_current = m_value.load(std::memory_order_relaxed);
+
+			while (l_current < p_value and not m_value.compare_exchange_weak(l_current, p_value, std::memory_order_relaxed))
+			{
+			}
+		}
+
+		s64 get() const
+		{
+			return m_value.load(std::memory_order_relaxed);
+		}
+
+	private:
+		std::atomic<s64> m_value{ 0 };
+	};
+
+	//distribution of values in power of two buckets
+	class Histogram
+	{
+	public:
+		void record(u64 p_value);
+
+		u64 getCount() const;
+		u64 getSum() const;
+		u64 getBucket(u32 p_index) const;
+
+		//upper bound of bucket which contains given fraction (0.0 - 1.0) of recorded values
+		u64 getPercentile(f64 p_fraction) const;
+
+	private:
+		std::atomic<u64> m_buckets[NR_OF_HISTOGRAM_BUCKETS] = {};
+		std::atomic<u64> m_count{ 0u };
+		std::atomic<u64> m_sum{ 0u };
+	};
+
+	//value is counter/gauge value or number of recorded values for histogram
+	struct MetricSample
+	{
+		const char* name;
+		MetricType type;
+		s64 value;
+		u64 sum;
+		u64 p50;
+		u64 p99;
+	};
+
+	struct MetricsSnapshot
+	{
+		u64 timestamp = 0u; //steady clock, ns
+		std::vector<MetricSample> samples;
+
+		//nullptr if there is no sample with given name
+		const MetricSample* find(const std::string& p_name) const;
+	};
+}
+
+/*
+	Named runtime metrics of engine internals. Registration (getCounter/getGauge/getHistogram) takes a lock
+	and is meant for setup - returned references stay valid for the lifetime of the registry and updating
+	them is lock-free (relaxed atomics), so hot paths keep only pointers to their metrics.
+	Asking for already registered name returns the same metric, so several pools can share e.g. one counter.
+	takeSnapshot() reuses storage of given snapshot - polling does not allocate once sizes settle.
+	Snapshot values are read one by one, they are not consistent with each other under concurrent updates.
+	Sampled gauges are read from their owner only when snapshot is taken (e.g. pool size) - the owner does
+	no work per operation. They are read on the thread taking the snapshot, so snapshots of single-threaded
+	owners have to be taken on their thread (MetricsReporter as a system). Owner removes its sampled gauges
+	before it is destroyed, registry has to outlive every owner attached to it.
+*/
+
+class MetricsRegistry
+{
+public:
+	MetricsRegistry() = default;
+	MetricsRegistry(const MetricsRegistry&) = delete;
+
+	metrics::Counter& getCounter(const std::string& p_name);
+	metrics::Gauge& getGauge(const std::string& p_name);
+	metrics::Histogram& getHistogram(const std::string& p_name);
+
+	void addSampledGauge(const std::string& p_name, const void* p_owner, std::function<s64()> p_sample);
+	void removeSampledGauges(const void* p_owner);
+
+	u32 getNumOfMetrics() const;
+
+	void takeSnapshot(metrics::MetricsSnapshot&) const;
+
+	//one JSON object per snapshot: {"timestamp":ns,"metrics":{"name":value,"histogram":{"count":..},..}}
+	static bool writeSnapshot(std::ostream&, const metrics::MetricsSnapshot&);
+
+private:
+	template<typename Metric>
+	struct NamedMetric
+	{
+		NamedMetric(const std::string& p_name)
+			:name(p_name)
+		{
+		}
+
+		const std::string name;
+		Metric metric;
+	};
+
+	struct SampledGauge
+	{
+		std::string name;
+		const void* owner;
+		std::function<s64()> sample;
+	};
+
+	template<typename Metric>
+	Metric& getOrCreate(std::deque<NamedMetric<Metric>>&, const std::string& p_name);
+
+	mutable std::mutex m_mutex;
+	std::deque<NamedMetric<metrics::Counter>> m_counters;
+	std::deque<NamedMetric<metrics::Gauge>> m_gauges;
+	std::deque<NamedMetric<metrics::Histogram>> m_histograms;
+	std::vector<SampledGauge> m_sampledGauges;
+};
+
+}
@@ -0,0 +1,48 @@
+#pragma once
+#include <string>
+#include <vector>
+#include "System.h"
+#include "MetricsRegistry.h"
+
+namespace engine
+{
+
+/*
+	System which polls MetricsRegistry once per tick and appends snapshot (JSON line) to local file
+	every p_interval seconds of simulation time - register it with the lowest priority (highest value),
+	so the snapshot sees the whole tick. File is opened for every dump, so it can be rotated externally.
+	trackPerTick() turns counter into histogram of its increments per tick, e.g. structural changes per frame.
+*/
+
+class MetricsReporter : public System
+{
+public:
+	MetricsReporter(MetricsRegistry&, const std::string& p_filePath, f32 p_interval);
+
+	void update(f32 p_deltaTime) override;
+	const char* getName() const override;
+
+	//records "<name>.perTick" histogram
+	void trackPerTick(const std::string& p_counterName);
+
+	bool dump();
+	const metrics::MetricsSnapshot& getLastSnapshot() const;
+
+private:
+	struct TrackedCounter
+	{
+		const metrics::Counter* counter;
+		metrics::Histogram* histogram;
+		u64 lastValue;
+	};
+
+	MetricsRegistry& m_registry;
+	const std::string m_filePath;
+	const f32 m_interval;
+
+	f32 m_timeSinceDump = 0.0f;
+	std::vector<TrackedCounter> m_trackedCounters;
+	metrics::MetricsSnapshot m_snapshot;
+};
+
+}
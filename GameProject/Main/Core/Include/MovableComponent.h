@@ -0,0 +1,20 @@
+#pragma once
+#include "ComponentBase.h"
+
+namespace engine
+{
+
+struct MovableComponent : public ComponentBase
+{
+	static constexpr ComponentType TYPE = ComponentType::MOVABLE;
+
+	MovableComponent()
+		:ComponentBase(TYPE)
+	{
+	}
+
+	f32 velocityX = 0.0f;
+	f32 velocityY = 0.0f;
+};
+
+}
@@ -0,0 +1,20 @@
+#pragma once
+#include "ComponentBase.h"
+
+namespace engine
+{
+
+struct PositionComponent : public ComponentBase
+{
+	static constexpr ComponentType TYPE = ComponentType::POSITION;
+
+	PositionComponent()
+		:ComponentBase(TYPE)
+	{
+	}
+
+	f32 x = 0.0f;
+	f32 y = 0.0f;
+};
+
+}
@@ -0,0 +1,63 @@
+#pragma once
+#include <array>
+#include <vector>
+#include <type_traits>
+#include "Types.h"
+#include "Constants.h"
+#include "ComponentTypes.h"
+#include "ComponentBase.h"
+#include "ComponentIndicators.h"
+
+namespace engine
+{
+
+/*
+	Template of entity - set of components (precompiled mask) and blob with their default values.
+	Only data of component struct (bytes after ComponentBase part) is stored, so defaults can be
+	memcpy'd straight into components created by provider, without touching vtable, type or links.
+	Component structs used with defaults have to be plain data apart from ComponentBase.
+	Instantiated by IEntityController::createEntityFromPrefab / createEntitiesFromPrefab.
+*/
+
+class Prefab
+{
+public:
+	Prefab() = default;
+
+	//component created with values given by provider
+	bool addComponent(ComponentType);
+
+	template<typename ComponentStruct>
+	bool addComponent(const ComponentStruct& p_defaults)
+	{
+		static_assert(std::is_base_of_v<ComponentBase, ComponentStruct>, "Prefab accepts components only");
+		static_assert(sizeof(ComponentStruct) >= sizeof(ComponentBase), "Unexpected component layout");
+
+		const auto l_data = reinterpret_cast<const u8*>(&p_defaults) + sizeof(ComponentBase);
+		return addDefaults(p_defaults.type, l_data, sizeof(ComponentStruct) - sizeof(ComponentBase));
+	}
+
+	const ComponentIndicators& getComponents() const;
+	bool hasDefaults(ComponentType) const;
+
+	void applyDefaults(ComponentBase&) const;
+	void applyDefaults(ComponentBase* const* p_components, u32 p_count) const;
+
+private:
+	static constexpr u32 NR_OF_TYPES = LAST_VALID_COMPONENT_INDEX + 1u;
+
+	struct DefaultsRange
+	{
+		u32 offset = 0u;
+		u32 size = 0u;
+	};
+
+	bool addDefaults(ComponentType, const u8* p_data, u32 p_size);
+	bool isValid(ComponentType) const;
+
+	ComponentIndicators m_components;
+	std::array<DefaultsRange, NR_OF_TYPES> m_defaults;
+	std::vector<u8> m_data;
+};
+
+}
@@ -0,0 +1,86 @@
+#pragma once
+#include <chrono>
+#include <ostream>
+#include <vector>
+#include "Types.h"
+
+namespace engine
+{
+
+/*
+	In-engine frame profiler. Zones are RAII markers - constructor takes timestamp, destructor
+	writes one event (name, start, duration) into ring buffer of the calling thread. Every thread
+	gets its own single-producer ring, registered once on its first zone, so recording takes no lock
+	and shares no cache line with other threads. Ring keeps EVENTS_PER_THREAD newest events.
+	Rings of finished threads stay exportable until registry holds MAX_NR_OF_THREAD_BUFFERS rings,
+	then new threads take them over (their zones are dropped) - short-lived threads do not pile up memory.
+	Timestamps come from steady_clock in nanoseconds (monotonic, TSC based on common platforms).
+
+	Instrumentation goes through ENGINE_PROFILE_ZONE("name") which is compiled out entirely
+	(name is not even evaluated) unless ENGINE_PROFILING is defined - CMake option GAMEPROJECT_WITH_PROFILER.
+	Zone names have to outlive the profiler (string literals), only pointers are stored.
+
+	exportChromeTrace() writes Chrome trace JSON (chrome://tracing, Perfetto). Export does not stop
+	recording threads - events overwritten during export are dropped, so export between frames
+	or after the run gives complete picture.
+*/
+
+namespace profiler
+{
+	constexpr u32 EVENTS_PER_THREAD = 1u << 16;
+	constexpr u32 MAX_NR_OF_THREAD_BUFFERS = 16u;
+
+	struct RecordedZone
+	{
+		const char* name;
+		u64 start;    //ns
+		u64 duration; //ns
+		u32 threadId; //sequential, in order of first zone of the thread
+	};
+
+	inline u64 now()
+	{
+		return static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count());
+	}
+
+	void recordZone(const char* p_name, u64 p_start, u64 p_end);
+	void setThreadName(const char* p_name);
+
+	std::vector<RecordedZone> collectZones();
+	bool exportChromeTrace(std::ostream&);
+	void clear();
+
+	class Zone
+	{
+	public:
+		explicit Zone(const char* p_name)
+			:m_name(p_name),
+			 m_start(now())
+		{
+		}
+
+		~Zone()
+		{
+			recordZone(m_name, m_start, now());
+		}
+
+		Zone(const Zone&) = delete;
+		Zone& operator=(const Zone&) = delete;
+
+	private:
+		const char* m_name;
+		u64 m_start;
+	};
+}
+
+}
+
+#define ENGINE_PROFILE_CONCAT_IMPL(p_first, p_second) p_first##p_second
+#define ENGINE_PROFILE_CONCAT(p_first, p_second) ENGINE_PROFILE_CONCAT_IMPL(p_first, p_second)
+
+#if defined(ENGINE_PROFILING)
+	#define ENGINE_PROFILE_ZONE(p_name) ::engine::profiler::Zone ENGINE_PROFILE_CONCAT(l_profileZone, __LINE__)(p_name)
+#else
+	#define ENGINE_PROFILE_ZONE(p_name) ((void)0)
+#endif
@@ -0,0 +1,87 @@
+#pragma once
+#include <memory_resource>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "Types.h"
+#include "Constants.h"
+#include "RelationTypes.h"
+
+namespace engine
+{
+
+/*
+	Relations between entities, e.g. (TARGETS, X) or (MEMBER_OF, squad), stored as pairs with reverse index.
+	Every entity has list of targets and list of sources per relation type, each entry keeps slot
+	of its counterpart in the other list - both sides are swap-removed in O(1), so removing entity
+	costs O(degree) and queries just return prepared list (O(result)).
+	Relation of entity with itself is rejected. Attached to EntityController to be cleaned up on removeEntity.
+	Lists are kept in sparse map per relation type, created on first relation of entity and dropped
+	by removeEntity, so memory follows related entities, not capacity (which only limits valid ids).
+	All lists allocate from given memory resource (World passes its own pool resource).
+*/
+
+class RelationStore
+{
+public:
+	RelationStore(PoolSize p_capacity, std::pmr::memory_resource& = *std::pmr::get_default_resource());
+	RelationStore(const RelationStore&) = delete;
+
+	bool add(EntityId p_source, RelationType, EntityId p_target);
+	bool remove(EntityId p_source, RelationType, EntityId p_target);
+	bool has(EntityId p_source, RelationType, EntityId p_target) const;
+
+	//entities p_source is in relation with, e.g. everything it targets
+	const std::pmr::vector<EntityId>& getTargets(EntityId p_source, RelationType) const;
+	//entities in relation with p_target, e.g. everything targeting it
+	const std::pmr::vector<EntityId>& getSources(RelationType, EntityId p_target) const;
+
+	//drops all relations where entity is source or target
+	void removeEntity(EntityId);
+	u32 size() const;
+
+private:
+	static constexpr u32 INVALID_INDEX = ~0u;
+
+	//allocator aware - lists created by map get its memory resource
+	struct RelationList
+	{
+		using allocator_type = std::pmr::polymorphic_allocator<RelationList>;
+
+		RelationList(const allocator_type& p_allocator)
+			:entities(p_allocator),
+			 counterpartSlots(p_allocator)
+		{
+		}
+
+		RelationList(RelationList&& p_list, const allocator_type& p_allocator)
+			:entities(std::move(p_list.entities), p_allocator),
+			 counterpartSlots(std::move(p_list.counterpartSlots), p_allocator)
+		{
+		}
+
+		std::pmr::vector<EntityId> entities;
+		std::pmr::vector<u32> counterpartSlots;
+	};
+
+	using RelationLists = std::pmr::unordered_map<EntityId, RelationList>;
+
+	bool isIdInRange(EntityId) const;
+	//nullptr when entity has no list yet
+	const RelationList* findList(const RelationLists&, EntityId) const;
+	u32 findSlot(const RelationList&, EntityId) const;
+	void erase(RelationList&, u32 p_slot, RelationLists& p_counterpartLists);
+	void erase(RelationType, EntityId p_source, u32 p_targetSlot);
+	RelationLists& targets(RelationType);
+	RelationLists& sources(RelationType);
+
+	const PoolSize m_capacity;
+	u32 m_size = 0u;
+
+	//per relation type
+	std::pmr::vector<RelationLists> m_targets;
+	std::pmr::vector<RelationLists> m_sources;
+	const std::pmr::vector<EntityId> m_emptyList;
+};
+
+}
@@ -0,0 +1,16 @@
+#pragma once
+#include "Types.h"
+
+namespace engine
+{
+
+enum class RelationType : u8
+{
+	TARGETS = 0,
+	OWNED_BY = 1,
+	MEMBER_OF = 2
+};
+
+constexpr u32 NR_OF_RELATION_TYPES = 3u;
+
+}
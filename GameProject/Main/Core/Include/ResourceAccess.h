@@ -0,0 +1,89 @@
+#pragma once
+#include <bitset>
+#include "Types.h"
+#include "TypeIndex.h"
+#include "assert.h"
+
+namespace engine
+{
+
+class ResourceStore;
+
+constexpr u32 MAX_NR_OF_RESOURCE_TYPES = 64u;
+
+/*
+	Resources read and written by system, declared in ISystem::getResourceAccess.
+	Two systems conflict when one of them writes resource the other one reads or writes -
+	SystemController does not put such systems into the same parallel batch. Exclusive access
+	(default of systems which declare nothing) conflicts with every other access, empty access
+	with none - it has to be declared explicitly by systems which really touch no shared state.
+*/
+
+class ResourceAccess
+{
+public:
+	static ResourceAccess exclusive()
+	{
+		ResourceAccess l_access;
+		l_access.m_exclusive = true;
+
+		return l_access;
+	}
+
+	template<typename Resource>
+	static u32 getTypeIndex()
+	{
+		const auto l_index = TypeIndex<ResourceStore>::get<Resource>();
+		assert(l_index < MAX_NR_OF_RESOURCE_TYPES);
+
+		return l_index;
+	}
+
+	template<typename Resource>
+	ResourceAccess& read()
+	{
+		m_reads.set(getTypeIndex<Resource>());
+		return *this;
+	}
+
+	template<typename Resource>
+	ResourceAccess& write()
+	{
+		m_writes.set(getTypeIndex<Resource>());
+		return *this;
+	}
+
+	template<typename Resource>
+	bool reads() const
+	{
+		return m_reads.test(getTypeIndex<Resource>()) or writes<Resource>();
+	}
+
+	template<typename Resource>
+	bool writes() const
+	{
+		return m_writes.test(getTypeIndex<Resource>());
+	}
+
+	bool isExclusive() const
+	{
+		return m_exclusive;
+	}
+
+	bool conflictsWith(const ResourceAccess& p_access) const
+	{
+		if (m_exclusive or p_access.m_exclusive)
+		{
+			return true;
+		}
+
+		return (m_writes & (p_access.m_reads | p_access.m_writes)).any() or (p_access.m_writes & m_reads).any();
+	}
+
+private:
+	std::bitset<MAX_NR_OF_RESOURCE_TYPES> m_reads;
+	std::bitset<MAX_NR_OF_RESOURCE_TYPES> m_writes;
+	bool m_exclusive = false;
+};
+
+}
@@ -0,0 +1,118 @@
+#pragma once
+#include <memory>
+#include <memory_resource>
+#include <utility>
+#include <vector>
+#include "Types.h"
+#include "ResourceAccess.h"
+#include "assert.h"
+
+namespace engine
+{
+
+/*
+	Global per-world data (time, input snapshot, physics settings, RNG...) - at most one object of every type.
+	Resources are found by type index in O(1), no entity scan. Type indices are shared by all stores
+	and by ResourceAccess declarations of systems, objects are owned by the store and allocated
+	from its memory resource.
+*/
+
+class ResourceStore
+{
+public:
+	ResourceStore(std::pmr::memory_resource& = *std::pmr::get_default_resource());
+	ResourceStore(const ResourceStore&) = delete;
+
+	//replaces resource of the same type if it already exists
+	template<typename Resource, typename... Args>
+	Resource& emplace(Args&&... p_args)
+	{
+		const auto l_index = ResourceAccess::getTypeIndex<Resource>();
+
+		if (l_index >= m_resources.size())
+		{
+			m_resources.resize(l_index + 1u);
+		}
+
+		std::pmr::polymorphic_allocator<Resource> l_allocator(m_resources.get_allocator());
+		auto l_resource = l_allocator.allocate(1u);
+		l_allocator.construct(l_resource, std::forward<Args>(p_args)...);
+
+		m_resources[l_index] = ResourcePtr(l_resource, ResourceDeleter{&destroy<Resource>, l_allocator.resource()});
+
+		return *l_resource;
+	}
+
+	template<typename Resource>
+	bool has() const
+	{
+		return tryGet<Resource>() != nullptr;
+	}
+
+	template<typename Resource>
+	Resource* tryGet()
+	{
+		const auto l_index = ResourceAccess::getTypeIndex<Resource>();
+		return l_index < m_resources.size() ? static_cast<Resource*>(m_resources[l_index].get()) : nullptr;
+	}
+
+	template<typename Resource>
+	const Resource* tryGet() const
+	{
+		return const_cast<ResourceStore*>(this)->tryGet<Resource>();
+	}
+
+	template<typename Resource>
+	Resource& get()
+	{
+		assert(has<Resource>());
+		return *tryGet<Resource>();
+	}
+
+	template<typename Resource>
+	const Resource& get() const
+	{
+		assert(has<Resource>());
+		return *tryGet<Resource>();
+	}
+
+	template<typename Resource>
+	bool remove()
+	{
+		if (not has<Resource>())
+		{
+			return false;
+		}
+
+		m_resources[ResourceAccess::getTypeIndex<Resource>()].reset();
+		return true;
+	}
+
+	u32 size() const;
+
+private:
+	struct ResourceDeleter
+	{
+		void (*destroy)(void*, std::pmr::memory_resource&) = nullptr;
+		std::pmr::memory_resource* memoryResource = nullptr;
+
+		void operator()(void* p_resource) const
+		{
+			destroy(p_resource, *memoryResource);
+		}
+	};
+
+	using ResourcePtr = std::unique_ptr<void, ResourceDeleter>;
+
+	template<typename Resource>
+	static void destroy(void* p_resource, std::pmr::memory_resource& p_memoryResource)
+	{
+		auto l_resource = static_cast<Resource*>(p_resource);
+		l_resource->~Resource();
+		std::pmr::polymorphic_allocator<Resource>(&p_memoryResource).deallocate(l_resource, 1u);
+	}
+
+	std::pmr::vector<ResourcePtr> m_resources;
+};
+
+}
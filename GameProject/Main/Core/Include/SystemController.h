@@ -0,0 +1,40 @@
+#pragma once
+#include <vector>
+#include "ISystemController.h"
+
+namespace engine
+{
+
+/*
+	Runs registered systems one after another in stable order: lower priority first,
+	systems with equal priority in order of registration. Order does not depend on addresses
+	or containers with unspecified iteration order, so every run of the simulation updates systems
+	the same way (required by rollback and lockstep).
+	getParallelBatches() splits that order into batches of systems without conflicting resource access -
+	systems of one batch could run concurrently, batches have to run one after another.
+*/
+
+class SystemController : public ISystemController
+{
+public:
+	SystemController() = default;
+	SystemController(const SystemController&) = delete;
+
+	void addSystem(ISystem&, s32 p_priority = 0) override;
+	bool removeSystem(ISystem&) override;
+	void update(f32 p_deltaTime) override;
+	u32 getNumOfSystems() const override;
+
+	std::vector<std::vector<ISystem*>> getParallelBatches() const;
+
+private:
+	struct ScheduledSystem
+	{
+		ISystem* system;
+		s32 priority;
+	};
+
+	std::vector<ScheduledSystem> m_systems;
+};
+
+}
@@ -0,0 +1,47 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "Types.h"
+#include "ITaskExecutor.h"
+
+namespace engine
+{
+
+/*
+	Worker threads started once and reused by every run(). Task 0 runs on the calling thread, others
+	on workers - all tasks of one run execute at the same time, so they may wait for each other
+	(e.g. barrier between hierarchy levels). Workers spin for a while after a run before they go
+	to sleep, so runs issued back to back within a frame do not pay for waking threads up.
+	run() is meant to be called from one thread at a time.
+*/
+
+class ThreadPool : public ITaskExecutor
+{
+public:
+	ThreadPool(u32 p_nrOfWorkers);
+	ThreadPool(const ThreadPool&) = delete;
+	~ThreadPool() override;
+
+	u32 getNrOfThreads() const override;
+	void run(u32 p_nrOfTasks, const Task&) override;
+
+private:
+	void work(u32 p_taskIndex);
+	bool waitForRun(u64& p_generation, const Task*& p_task, u32& p_nrOfTasks);
+
+	std::vector<std::thread> m_workers;
+
+	std::mutex m_mutex;
+	std::condition_variable m_wakeUp;
+	const Task* m_task = nullptr;
+	u32 m_nrOfTasks = 0u;
+	bool m_stopRequested = false;
+
+	std::atomic<u64> m_generation{ 0u };
+	std::atomic<u32> m_nrOfPendingTasks{ 0u };
+};
+
+}
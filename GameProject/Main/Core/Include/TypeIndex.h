@@ -0,0 +1,28 @@
+#pragma once
+#include <atomic>
+#include "Types.h"
+
+namespace engine
+{
+
+/*
+	Dense index of type, assigned on first use. Every Family has own sequence starting from 0,
+	so indices of e.g. event types and resource types stay small and can address vectors directly.
+*/
+
+template<typename Family>
+class TypeIndex
+{
+public:
+	template<typename Type>
+	static u32 get()
+	{
+		static const u32 s_index = s_nextIndex.fetch_add(1u);
+		return s_index;
+	}
+
+private:
+	static inline std::atomic<u32> s_nextIndex{0u};
+};
+
+}
@@ -0,0 +1,84 @@
+#pragma once
+#include <memory>
+#include <memory_resource>
+#include "Types.h"
+#include "Parameters.h"
+#include "IComponentProvider.h"
+#include "EntityController.h"
+#include "EntityChangeDistributor.h"
+#include "ComponentObservers.h"
+#include "RelationStore.h"
+#include "ResourceStore.h"
+#include "EventBus.h"
+#include "SystemController.h"
+#include "EntityPool.h"
+#include "IdGuard.h"
+#include "MetricsRegistry.h"
+
+namespace engine
+{
+
+struct WorldSettings
+{
+	//capacity of entity pool, also highest id given by id guard
+	PoolSize maxNrOfEntities = MAX_NR_OF_ENTITIES;
+	//threads allowed to publish events concurrently inside the world
+	u32 nrOfEventThreads = 1u;
+};
+
+/*
+	One independent simulation (e.g. one match on server) - owns entity pool with its id guard,
+	controllers, relations, resources, events and system schedule, sized by runtime settings.
+	Worlds do not share any mutable state, so every world can be stepped on its own thread without locking.
+	Pools, id guard, change lists, relations, resources, event buffers and observer tables allocate from
+	world's own unsynchronized pool resource: worlds do not contend on global heap, and destroying world
+	hands memory back to upstream in few big blocks. Only the controller objects created in constructor
+	and the system schedule (filled once at setup) use global heap.
+	Systems and observers are owned by caller and have to outlive the world.
+*/
+
+class World
+{
+public:
+	World(std::unique_ptr<IComponentProvider>,
+		  const WorldSettings& = WorldSettings(),
+		  std::pmr::memory_resource& p_upstream = *std::pmr::get_default_resource());
+	World(const World&) = delete;
+
+	EntityController& getEntityController();
+	//for WorldSnapshot and WorldHistory, pool is owned by entity controller
+	EntityPool& getEntityPool();
+	EntityChangeDistributor& getChangeDistributor();
+	ComponentObservers& getObservers();
+	RelationStore& getRelations();
+	ResourceStore& getResources();
+	EventBus& getEvents();
+	SystemController& getSystems();
+
+	const WorldSettings& getSettings() const;
+
+	//"<prefix>.entityPool.*", ".ids.*", ".entities.*" and ".changes.*" metrics, registry has to outlive the world
+	void attachMetrics(MetricsRegistry&, const std::string& p_prefix);
+
+	//updates systems and swaps event buffers - events published in this step are visible in the next one
+	void step(f32 p_deltaTime);
+
+private:
+	const WorldSettings m_settings;
+
+	//declared first - destroyed after everything allocated from it
+	std::pmr::unsynchronized_pool_resource m_memoryResource;
+
+	EntityChangeDistributor m_changeDistributor;
+	ComponentObservers m_observers;
+	RelationStore m_relations;
+	ResourceStore m_resources;
+	EventBus m_events;
+	SystemController m_systems;
+
+	EntityPool* m_entityPool;
+	IdGuard* m_idGuard;
+	EntityController m_entityController;
+};
+
+}
@@ -1,5 +1,8 @@
 #pragma once
+#include <memory_resource>
+#include <new>
 #include "Types.h"
+#include "Pool.h"
 #include "IComponentPool.h"
 
 namespace engine
@@ -9,8 +12,8 @@ template<typename ComponentStruct>
 class ComponentPool : public IComponentPool
 {
 public:
-	ComponentPool(PoolSize p_size)
-		:m_pool(p_size)
+	ComponentPool(PoolSize p_size, std::pmr::memory_resource& p_memoryResource = *std::pmr::get_default_resource())
+		:m_pool(p_size, p_memoryResource)
 	{
 
 	}
@@ -22,6 +25,17 @@ public:
 		return m_pool.getNext();
 	}
 
+	//p_count components constructed in one consecutive block of pool
+	void getComponents(u32 p_count, ComponentBase** p_components) override
+	{
+		auto l_components = m_pool.getNextBlock(p_count);
+
+		for (auto i = 0u; i < p_count; i++)
+		{
+			p_components[i] = new (&l_components[i]) ComponentStruct();
+		}
+	}
+
 	void returnComponent(ComponentBase& p_component)
 	{
 		m_pool.takeBack(static_cast<ComponentStruct&>(p_component));
@@ -32,6 +46,12 @@ public:
 		return m_pool.size();
 	}
 
+	//raw access for state saving and restoring (WorldSnapshot, WorldHistory)
+	ContinuousPool<ComponentStruct>& getPool()
+	{
+		return m_pool;
+	}
+
 private:
 	ContinuousPool<ComponentStruct> m_pool;
 };
@@ -0,0 +1,118 @@
+#pragma once
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <vector>
+#include "Types.h"
+#include "Pool.h"
+#include "TransformStore.h"
+
+namespace engine
+{
+
+namespace delta
+{
+	constexpr u32 CHUNK_SIZE = 256u;
+	constexpr u32 DEFAULT_HISTORY_SIZE = 60u;
+	constexpr u32 MAGIC = 0x544C4447u; //"GDLT"
+
+	struct DeltaHeader
+	{
+		u32 magic = MAGIC;
+		u32 frame = 0u;
+		u32 nrOfRecords = 0u;
+		u32 nrOfRegions = 0u;
+		//snapshotter which captured the delta, only that one can apply it
+		u64 origin = 0u;
+	};
+
+	//followed by RLE encoded XOR of the chunk: pairs of (nr of zero bytes, nr of literal bytes) + literal bytes
+	struct RecordHeader
+	{
+		u32 region = 0u;
+		u32 chunk = 0u;
+		u32 encodedSize = 0u;
+	};
+}
+
+/*
+	Delta encoding of world state kept in registered memory regions (pool storage, TransformStore arrays, ...).
+	Regions are compared with baseline (state from previous capture) chunk by chunk, every changed chunk
+	is written as XOR with baseline compressed with zero-run RLE. Records address region and chunk only,
+	they carry no entity ids.
+	XOR delta is its own inverse: applying it to the state it was made from gives the next state (redo),
+	applying it to the next state gives the previous one (rollback). Both work in place.
+	Deltas are raw bytes of regions, including ComponentPtr links and vtable pointers of components -
+	they are meaningful only for the regions they were captured from, in the same process. This is
+	in-process rollback storage only, not a replication format: applyDelta() accepts only own delta
+	of the frame following the current one (redo after rewind()) and puts it back into history.
+	Last captured deltas are kept in a ring buffer (60 by default - one second of ticks) and rewind() walks
+	back through them. Buffers are reused, so steady state capturing does not allocate.
+	Regions have to stay at the same address and size for the whole lifetime of the snapshotter.
+*/
+
+class DeltaSnapshotter
+{
+public:
+	using Hook = std::function<void()>;
+
+	DeltaSnapshotter(u32 p_historySize = delta::DEFAULT_HISTORY_SIZE);
+	DeltaSnapshotter(const DeltaSnapshotter&) = delete;
+
+	//p_beforeCapture lets region refresh its content, p_afterApply lets owner rebuild state from it
+	u32 registerRegion(void* p_data, std::size_t p_size, Hook p_beforeCapture = Hook(), Hook p_afterApply = Hook());
+
+	template<typename ElementType>
+	void registerPool(ContinuousPool<ElementType>& p_pool)
+	{
+		auto& l_size = m_sizeMirrors.emplace_back(0u);
+
+		registerRegion(p_pool.data(), static_cast<std::size_t>(p_pool.maxSize()) * sizeof(ElementType));
+		registerRegion(&l_size, sizeof(l_size),
+			[&p_pool, &l_size]() { l_size = p_pool.size(); },
+			[&p_pool, &l_size]() { p_pool.reset(); p_pool.getNextBlock(l_size); });
+	}
+
+	void registerTransformStore(TransformStore&);
+
+	void captureBaseline();
+	const std::vector<u8>& captureDelta();
+
+	//redo of frame dropped by rewind() - own delta of frame getFrame() + 1 only
+	bool applyDelta(const u8* p_delta, std::size_t p_size);
+	bool rewind(u32 p_nrOfFrames);
+
+	u32 getNumOfStoredDeltas() const;
+	const std::vector<u8>& getDelta(u32 p_framesAgo) const;
+	u32 getFrame() const;
+
+private:
+	struct Region
+	{
+		u8* data;
+		std::size_t size;
+		std::size_t baselineOffset;
+		Hook beforeCapture;
+		Hook afterApply;
+	};
+
+	bool applyRecords(const u8* p_delta, std::size_t p_size);
+	void restoreBaseline();
+	void runBeforeCaptureHooks();
+	void runAfterApplyHooks();
+	void encodeChunk(std::vector<u8>& p_output, const u8* p_current, const u8* p_baseline, u32 p_size) const;
+	bool decodeChunk(const u8* p_encoded, u32 p_encodedSize, u8* p_current, u8* p_baseline, u32 p_size) const;
+
+	const u64 m_origin;
+	std::vector<Region> m_regions;
+	std::vector<u8> m_baseline;
+	std::deque<u32> m_sizeMirrors;
+	std::deque<std::vector<EntityId>> m_idMirrors;
+
+	std::vector<std::vector<u8>> m_history;
+	u32 m_newestDelta = 0u;
+	u32 m_nrOfStoredDeltas = 0u;
+	u32 m_frame = 0u;
+};
+
+}
@@ -1,19 +1,21 @@
 #pragma once
 #include "IEntityPool.h"
-#include <set>
+#include <vector>
 #include <memory>
+#include <memory_resource>
 #include "Pool.h"
 #include "IIdGuard.h"
 
 namespace engine
 {
 
-class EntityPool : IEntityPool
+class EntityPool : public IEntityPool
 {
 public:
-	EntityPool(PoolSize, std::unique_ptr<IIdGuard>);
+	EntityPool(PoolSize, std::unique_ptr<IIdGuard>, std::pmr::memory_resource& = *std::pmr::get_default_resource());
 
 	Entity& create() override;
+	Entity* createMultiple(u32 p_count) override;
 	bool removeEntity(EntityId) override;
 	Entity& getEntity(EntityId) override;
 
@@ -22,10 +24,19 @@ public:
 
 	void clear() override;
 
+	//raw access for state restoring (WorldHistory), call rebuildStoredIds() after entities were changed in place
+	ContinuousPool<Entity>& getEntities();
+	IIdGuard& getIdGuard();
+	void rebuildStoredIds();
+
 protected:
+	void markAsStored(EntityId);
+
 	ContinuousPool<Entity> m_pool;
 	std::unique_ptr<IIdGuard> m_idGuard;
-	std::set<EntityId> m_storedIds;
+
+	//flag per id - grows up to highest id given by guard, then create/remove do not allocate
+	std::pmr::vector<bool> m_storedIds;
 };
 
 }
\ No newline at end of file
@@ -0,0 +1,141 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <vector>
+#include "Types.h"
+
+namespace engine
+{
+
+namespace core
+{
+	constexpr std::size_t CACHE_LINE_SIZE = 64u;
+}
+
+struct FrameArenaStats
+{
+	std::size_t capacity = 0u;
+	std::size_t usedBytes = 0u;
+	std::size_t highWaterMark = 0u;
+	u32 nrOfFailedAllocations = 0u;
+};
+
+/*
+	Linear allocator for transient data living no longer than one frame (query results, command buffers, event lists).
+	Memory is reserved once and split into cache line aligned sub-arenas, one per worker thread,
+	so threads bump their own offsets without synchronization. Thread index is passed explicitly by the caller.
+	There is no per-allocation free - reset() releases everything at once in O(1) by advancing the frame number;
+	each sub-arena rewinds itself lazily on its next use. reset() must not run concurrently with allocations.
+	When sub-arena runs out of space allocate() returns nullptr. High-water mark keeps the peak number of bytes
+	requested within a frame (including failed requests), so it tells directly how big the sub-arena should be.
+*/
+
+class FrameArena
+{
+public:
+	static constexpr std::size_t DEFAULT_ALIGNMENT = alignof(std::max_align_t);
+
+	FrameArena(std::size_t p_bytesPerThread, u32 p_nrOfThreads = 1u);
+	FrameArena(const FrameArena&) = delete;
+
+	void* allocate(std::size_t p_size, std::size_t p_alignment = DEFAULT_ALIGNMENT, u32 p_threadIndex = 0u);
+
+	template<typename Type>
+	Type* allocateArray(std::size_t p_count, u32 p_threadIndex = 0u)
+	{
+		return static_cast<Type*>(allocate(p_count * sizeof(Type), alignof(Type), p_threadIndex));
+	}
+
+	void reset();
+
+	u32 getFrameNumber() const;
+	u32 getNumOfThreads() const;
+	std::size_t getCapacityPerThread() const;
+
+	FrameArenaStats getStats(u32 p_threadIndex) const;
+	std::size_t getHighWaterMark() const;
+	void resetStats();
+
+private:
+	struct alignas(core::CACHE_LINE_SIZE) SubArena
+	{
+		u8* memory = nullptr;
+		std::size_t offset = 0u;
+		std::size_t highWaterMark = 0u;
+		u32 frameNumber = 0u;
+		u32 nrOfFailedAllocations = 0u;
+	};
+
+	std::size_t getUsedBytes(const SubArena&) const;
+
+	const std::size_t m_capacityPerThread;
+	std::unique_ptr<u8[]> m_memory;
+	std::vector<SubArena> m_subArenas;
+	u32 m_frameNumber = 0u;
+};
+
+/*
+	STL compatible adapter, e.g. std::vector<T, FrameAllocator<T>> for per-frame scratch containers.
+	deallocate() is a no-op, memory comes back on FrameArena::reset(). Container has to be gone before reset.
+*/
+
+template<typename Type>
+class FrameAllocator
+{
+public:
+	using value_type = Type;
+
+	FrameAllocator(FrameArena& p_arena, u32 p_threadIndex = 0u)
+		:m_arena(&p_arena),
+		 m_threadIndex(p_threadIndex)
+	{
+	}
+
+	template<typename OtherType>
+	FrameAllocator(const FrameAllocator<OtherType>& p_allocator)
+		:m_arena(p_allocator.m_arena),
+		 m_threadIndex(p_allocator.m_threadIndex)
+	{
+	}
+
+	Type* allocate(std::size_t p_count)
+	{
+		auto l_memory = m_arena->allocateArray<Type>(p_count, m_threadIndex);
+
+		if (l_memory == nullptr)
+		{
+			throw std::bad_alloc();
+		}
+
+		return l_memory;
+	}
+
+	void deallocate(Type*, std::size_t)
+	{
+	}
+
+	template<typename OtherType>
+	bool operator==(const FrameAllocator<OtherType>& p_allocator) const
+	{
+		return m_arena == p_allocator.m_arena and m_threadIndex == p_allocator.m_threadIndex;
+	}
+
+	template<typename OtherType>
+	bool operator!=(const FrameAllocator<OtherType>& p_allocator) const
+	{
+		return not (*this == p_allocator);
+	}
+
+private:
+	template<typename>
+	friend class FrameAllocator;
+
+	FrameArena* m_arena;
+	u32 m_threadIndex;
+};
+
+template<typename Type>
+using FrameVector = std::vector<Type, FrameAllocator<Type>>;
+
+}
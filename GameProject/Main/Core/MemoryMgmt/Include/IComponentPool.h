@@ -11,6 +11,7 @@ public:
 	virtual ~IComponentPool() = default;
 
 	virtual ComponentBase& getComponent() = 0;
+	virtual void getComponents(u32 p_count, ComponentBase** p_components) = 0;
 	virtual void returnComponent(ComponentBase&) = 0;
 
 	virtual u32 size() const = 0;
@@ -11,6 +11,8 @@ public:
 	virtual ~IEntityPool() = default;
 
 	virtual Entity& create() = 0;
+	//p_count entities stored next to each other, returns first of them
+	virtual Entity* createMultiple(u32 p_count) = 0;
 	virtual bool removeEntity(EntityId) = 0;
 	virtual Entity& getEntity(EntityId) = 0;
 
@@ -0,0 +1,35 @@
+#pragma once
+#include <cstddef>
+#include <string>
+#include "Types.h"
+
+namespace engine
+{
+
+/*
+	Read-only file mapped copy-on-write (MAP_PRIVATE / FILE_MAP_COPY):
+	content can be modified in memory, changes are private to the process and never reach the file.
+	Only touched pages are loaded (and copied on first write), so opening is cheap regardless of file size.
+*/
+
+class MappedFile
+{
+public:
+	MappedFile() = default;
+	MappedFile(const MappedFile&) = delete;
+	~MappedFile();
+
+	bool open(const std::string& p_path);
+	void close();
+
+	bool isOpen() const;
+	u8* data();
+	const u8* data() const;
+	std::size_t size() const;
+
+private:
+	u8* m_data = nullptr;
+	std::size_t m_size = 0u;
+};
+
+}
@@ -0,0 +1,81 @@
+#pragma once
+#include <cstddef>
+#include <memory_resource>
+#include "Types.h"
+
+namespace engine
+{
+
+enum class PageSize
+{
+	STANDARD,
+	LARGE
+};
+
+enum class PageBacking
+{
+	STANDARD_PAGES,
+	TRANSPARENT_HUGE_PAGES,
+	EXPLICIT_HUGE_PAGES
+};
+
+constexpr s32 ANY_NUMA_NODE = -1;
+
+struct PageBackingSettings
+{
+	PageSize pageSize = PageSize::LARGE;
+	s32 numaNode = ANY_NUMA_NODE;
+};
+
+struct PageBackingStats
+{
+	u32 nrOfStandardPageAllocations = 0u;
+	u32 nrOfTransparentHugePageAllocations = 0u;
+	u32 nrOfExplicitHugePageAllocations = 0u;
+	u32 nrOfFailedNumaBindings = 0u;
+};
+
+/*
+	Memory resource mapping every allocation directly from the OS, intended for big pools:
+		ContinuousPool<T> l_pool(size, l_pageBackedResource);
+	With PageSize::LARGE it asks for explicit huge pages first (MAP_HUGETLB / MEM_LARGE_PAGES),
+	then falls back to 2MB aligned mapping advised with MADV_HUGEPAGE (transparent huge pages, Linux only)
+	and finally to standard pages. Which backing was used is visible in stats.
+	numaNode binds mapped memory to given node before first touch, so create the resource with the node
+	of worker threads which iterate the pool (see getCurrentNumaNode()). Binding failure is not fatal.
+	Each allocation is rounded up to the page size, so use it for few large blocks only.
+*/
+
+class PageBackedMemoryResource : public std::pmr::memory_resource
+{
+public:
+	static constexpr std::size_t STANDARD_PAGE_SIZE = 4u * 1024u;
+	static constexpr std::size_t HUGE_PAGE_SIZE = 2u * 1024u * 1024u;
+
+	PageBackedMemoryResource(const PageBackingSettings& = PageBackingSettings());
+	PageBackedMemoryResource(const PageBackedMemoryResource&) = delete;
+
+	PageBacking getLastBacking() const;
+	PageBackingStats getStats() const;
+
+	static s32 getCurrentNumaNode();
+
+private:
+	void* do_allocate(std::size_t p_bytes, std::size_t p_alignment) override;
+	void do_deallocate(void* p_memory, std::size_t p_bytes, std::size_t p_alignment) override;
+	bool do_is_equal(const std::pmr::memory_resource&) const noexcept override;
+
+	std::size_t getMappingSize(std::size_t p_bytes) const;
+
+	void* mapExplicitHugePages(std::size_t p_size);
+	void* mapTransparentHugePages(std::size_t p_size);
+	void* mapStandardPages(std::size_t p_size);
+	void bindToNumaNode(void* p_memory, std::size_t p_size);
+	void registerAllocation(PageBacking);
+
+	const PageBackingSettings m_settings;
+	PageBacking m_lastBacking = PageBacking::STANDARD_PAGES;
+	PageBackingStats m_stats;
+};
+
+}
@@ -1,12 +1,16 @@
 #pragma once
 #include <vector>
 #include <memory>
+#include <memory_resource>
 #include <new>
+#include <cstring>
+#include <string>
 #include "assert.h"
 #include "Types.h"
 #include "Constants.h"
 #include "Entity.h"
 #include "Component.h"
+#include "MetricsRegistry.h"
 
 namespace engine
 {
@@ -14,7 +18,7 @@ namespace engine
 namespace core
 {
 	using MemoryAllocationUnit = std::uintptr_t;
-	using MemoryPool = std::vector<MemoryAllocationUnit>;
+	using MemoryPool = std::pmr::vector<MemoryAllocationUnit>;
 }
 
 template<typename>
@@ -24,7 +28,7 @@ template<typename ElementType>
 class ContinuousPoolIterator
 {
 private:
-	template<typename ElementType>
+	template<typename>
 	friend class ContinuousPool;
 
 public:
@@ -138,7 +142,7 @@ template<typename TypedContinuousPoolIterator>
 class ContinuousPoolConstIterator
 {
 private:
-	template<typename ElementType>
+	template<typename>
 	friend class ContinuousPool;
 
 public:
@@ -209,7 +213,7 @@ public:
 
 	CIter& operator=(const CIter& p_iter)
 	{
-		l_iter = p_iter;
+		m_iter = p_iter.m_iter;
 		return *this;
 	}
 
@@ -236,7 +240,7 @@ template<typename ElementType>
 class SafeIterator
 {
 private:
-	template<typename ElementType>
+	template<typename>
 	friend class ContinuousPool;
 
 	using TypedContinuousPool = ContinuousPool<ElementType>;
@@ -281,7 +285,7 @@ private:
 	Iter m_iter;
 	bool m_isValid = true;
 
-	SafeIterator(TypedContinuousPool& p_pool, Iter& p_iter)
+	SafeIterator(TypedContinuousPool& p_pool, const Iter& p_iter)
 		:m_parentPool(p_pool),
 		m_iter(p_iter)
 	{
@@ -313,7 +317,7 @@ public:
 	using CIter = ContinuousPoolConstIterator<ContinuousPoolIterator<ElementType>>;
 
 	using TypedSafeIter = SafeIterator<ElementType>;
-	using SafeItersContainer = std::vector<TypedSafeIter*>;
+	using SafeItersContainer = std::pmr::vector<TypedSafeIter*>;
 
 private:
 	template<typename T>
@@ -322,7 +326,15 @@ private:
 public:
 	template<typename ...Args>
 	ContinuousPool(PoolSize p_size, InitMode p_initMode = InitMode::NO_PRE_INIT, Args&&... args)
-		:MAX_NR_OF_ELEMENTS(p_size)
+		:ContinuousPool(p_size, *std::pmr::get_default_resource(), p_initMode, std::forward<Args>(args)...)
+	{
+	}
+
+	template<typename ...Args>
+	ContinuousPool(PoolSize p_size, std::pmr::memory_resource& p_memoryResource, InitMode p_initMode = InitMode::NO_PRE_INIT, Args&&... args)
+		:m_maxNrOfElements(p_size),
+		 m_memoryPool(&p_memoryResource),
+		 m_safeIters(&p_memoryResource)
 	{
 		assert(isElementSizeEnough());
 		initMemory();
@@ -337,12 +349,23 @@ public:
 		reset();
 	}
 
+	//pool working on memory owned by someone else (e.g. mapped file), see useExternalStorage()
+	ContinuousPool(ElementType* p_externalStorage, PoolSize p_size, u32 p_nrOfStoredElements = 0u)
+		:m_maxNrOfElements(p_size)
+	{
+		useExternalStorage(p_externalStorage, p_size, p_nrOfStoredElements);
+	}
+
 	ContinuousPool(const ContinuousPool<ElementType>&) = delete;
 	ContinuousPool(ContinuousPool<ElementType>&&) = default;
 
 	~ContinuousPool()
 	{
 		//clear() should not be called here - it will cause a crash if getNext was used earlier
+		if (m_metrics.registry)
+		{
+			m_metrics.registry->removeSampledGauges(m_metrics.owner);
+		}
 	}
 
 	template<typename ...Args>
@@ -362,14 +385,29 @@ public:
 
 	ElementType& getNext()
 	{
+		assert(m_nrOfStoredElements < m_maxNrOfElements);
 		ElementType* l_nextElement = m_positionAfterLastElement;
 
 		m_positionAfterLastElement++;
 		m_nrOfStoredElements++;
+		updateHighWaterMetric();
 
 		return *l_nextElement;
 	}
 
+	//reserves p_count consecutive elements at once, without constructing them (e.g. to fill them with raw data)
+	ElementType* getNextBlock(u32 p_count)
+	{
+		assert(m_nrOfStoredElements + p_count <= m_maxNrOfElements);
+		ElementType* l_firstElement = m_positionAfterLastElement;
+
+		m_positionAfterLastElement += p_count;
+		m_nrOfStoredElements += p_count;
+		updateHighWaterMetric();
+
+		return l_firstElement;
+	}
+
 	void takeBack(ElementType& p_element)
 	{
 		invalidateSafeIteratorsWhichPointToRemovedElement(p_element);
@@ -382,11 +420,70 @@ public:
 
 		m_positionAfterLastElement--;
 		m_nrOfStoredElements--;
+
+#if defined(ENGINE_METRICS)
+		if (m_metrics.takeBacks)
+		{
+			m_metrics.takeBacks->add();
+		}
+#endif
 	}
 
 	PoolSize maxSize() const
 	{
-		return MAX_NR_OF_ELEMENTS;
+		return m_maxNrOfElements;
+	}
+
+	/*
+		Releases own memory and starts working on given block, first p_nrOfStoredElements elements
+		are treated as already stored. Block has to outlive the pool (or next useExternalStorage call),
+		pool never frees it. Elements are not destroyed on switch - call clear() before if needed.
+	*/
+	void useExternalStorage(ElementType* p_storage, PoolSize p_size, u32 p_nrOfStoredElements)
+	{
+		assert(p_nrOfStoredElements <= p_size);
+
+		invalidateAllSafeIterators();
+		core::MemoryPool(m_memoryPool.get_allocator()).swap(m_memoryPool);
+
+		m_storage = p_storage;
+		m_hasExternalStorage = true;
+		m_maxNrOfElements = p_size;
+		m_positionAfterLastElement = m_storage + p_nrOfStoredElements;
+		m_nrOfStoredElements = p_nrOfStoredElements;
+		updateHighWaterMetric();
+
+		assert(isDataAligned());
+	}
+
+	bool hasExternalStorage() const
+	{
+		return m_hasExternalStorage;
+	}
+
+	/*
+		Publishes "<prefix>.size" and ".capacity" sampled gauges (read only when snapshot is taken),
+		plus ".highWater" gauge and ".takeBacks" counter. Pool operations take about a nanosecond, even
+		a null check per operation slows them down twice (loops stop collapsing) - the last two are updated
+		only with ENGINE_METRICS (GAMEPROJECT_WITH_METRICS). Attach after the pool reached its final place.
+	*/
+	void attachMetrics(MetricsRegistry& p_registry, const std::string& p_prefix)
+	{
+		m_metrics.registry = &p_registry;
+		m_metrics.owner = this;
+		p_registry.addSampledGauge(p_prefix + ".size", this, [this]() { return static_cast<s64>(m_nrOfStoredElements); });
+		p_registry.addSampledGauge(p_prefix + ".capacity", this, [this]() { return static_cast<s64>(m_maxNrOfElements); });
+
+#if defined(ENGINE_METRICS)
+		m_metrics.highWater = &p_registry.getGauge(p_prefix + ".highWater");
+		m_metrics.takeBacks = &p_registry.getCounter(p_prefix + ".takeBacks");
+		updateHighWaterMetric();
+#endif
+	}
+
+	std::pmr::memory_resource& getMemoryResource() const
+	{
+		return *m_memoryPool.get_allocator().resource();
 	}
 
 	u32 size() const
@@ -408,6 +505,7 @@ public:
 	{
 		m_positionAfterLastElement = getPtrToBeginning();
 		m_nrOfStoredElements = 0u;
+		updateHighWaterMetric();
 
 		invalidateAllSafeIterators();
 	}
@@ -417,6 +515,16 @@ public:
 		return m_nrOfStoredElements == 0u;
 	}
 
+	ElementType* data()
+	{
+		return getPtrToBeginning();
+	}
+
+	const ElementType* data() const
+	{
+		return getPtrToBeginning();
+	}
+
 	bool isMyObject(const ElementType& p_element) const
 	{
 		for (const auto& l_element : *this)
@@ -471,25 +579,48 @@ public:
 	}
 
 private:
+	struct Metrics
+	{
+		MetricsRegistry* registry = nullptr;
+		//passing this from destructor would let the pool escape in every user and stop its loops from being optimized
+		const void* owner = nullptr;
+		metrics::Gauge* highWater = nullptr;
+		metrics::Counter* takeBacks = nullptr;
+	};
+
 	static const int ELEMENT_SIZE = sizeof(ElementType);
-	const PoolSize MAX_NR_OF_ELEMENTS;
+	PoolSize m_maxNrOfElements;
 
-	std::unique_ptr<core::MemoryPool> m_memoryPool;
+	core::MemoryPool m_memoryPool;
+	ElementType* m_storage = nullptr;
+	bool m_hasExternalStorage = false;
 	u32 m_nrOfStoredElements = 0u;
 
 	ElementType* m_positionAfterLastElement = nullptr;
 	SafeItersContainer m_safeIters;
+	Metrics m_metrics;
+
+	void updateHighWaterMetric()
+	{
+#if defined(ENGINE_METRICS)
+		if (m_metrics.highWater)
+		{
+			m_metrics.highWater->setMax(m_nrOfStoredElements);
+		}
+#endif
+	}
 
 	void initMemory()
 	{
-		m_memoryPool = std::make_unique<core::MemoryPool>();
-		m_memoryPool->resize(MAX_NR_OF_ELEMENTS * (ELEMENT_SIZE / sizeof(core::MemoryAllocationUnit)));
+		constexpr auto UNIT_SIZE = sizeof(core::MemoryAllocationUnit);
+		m_memoryPool.resize((m_maxNrOfElements * ELEMENT_SIZE + UNIT_SIZE - 1u) / UNIT_SIZE);
+		m_storage = reinterpret_cast<ElementType*>(m_memoryPool.data());
 	}
 
 	template<typename ...Args>
 	void preInitPoolElements(Args&&... args)
 	{
-		for (auto i = 0u; i < MAX_NR_OF_ELEMENTS; i++)
+		for (auto i = 0u; i < m_maxNrOfElements; i++)
 		{
 			allocate(std::forward<Args>(args)...);
 		}
@@ -497,7 +628,7 @@ private:
 	
 	ElementType* getPtrToBeginning() const
 	{
-		return reinterpret_cast<ElementType*>(&(m_memoryPool->at(0)));
+		return m_storage;
 	}
 
 	bool isElementSizeEnough()
@@ -0,0 +1,48 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <memory_resource>
+#include "Types.h"
+
+namespace engine
+{
+
+struct MemoryUsageStats
+{
+	std::size_t currentBytes = 0u;
+	std::size_t peakBytes = 0u;
+	std::size_t totalAllocatedBytes = 0u;
+	u32 nrOfAllocations = 0u;
+	u32 nrOfDeallocations = 0u;
+};
+
+/*
+	Memory resource forwarding to upstream resource and counting what goes through it.
+	Give each subsystem (entity pool, id guard, component pools...) its own instance on top of shared arena
+	to see how much memory it uses. Counters are atomic, so one instance can be shared between threads.
+*/
+
+class TrackingMemoryResource : public std::pmr::memory_resource
+{
+public:
+	TrackingMemoryResource(std::pmr::memory_resource& p_upstream = *std::pmr::get_default_resource());
+	TrackingMemoryResource(const TrackingMemoryResource&) = delete;
+
+	MemoryUsageStats getStats() const;
+	std::pmr::memory_resource& getUpstream() const;
+
+private:
+	void* do_allocate(std::size_t p_bytes, std::size_t p_alignment) override;
+	void do_deallocate(void* p_memory, std::size_t p_bytes, std::size_t p_alignment) override;
+	bool do_is_equal(const std::pmr::memory_resource&) const noexcept override;
+
+	std::pmr::memory_resource& m_upstream;
+
+	std::atomic<std::size_t> m_currentBytes{ 0u };
+	std::atomic<std::size_t> m_peakBytes{ 0u };
+	std::atomic<std::size_t> m_totalAllocatedBytes{ 0u };
+	std::atomic<u32> m_nrOfAllocations{ 0u };
+	std::atomic<u32> m_nrOfDeallocations{ 0u };
+};
+
+}
@@ -0,0 +1,108 @@
+#pragma once
+#include <vector>
+#include "Types.h"
+#include "Constants.h"
+#include "ITaskExecutor.h"
+
+namespace engine
+{
+
+struct Transform2D
+{
+	f32 x = 0.0f;
+	f32 y = 0.0f;
+	f32 rotation = 0.0f;
+};
+
+//links between attached entities, kept as handles so they stay valid when nodes are moved in storage
+struct HierarchyComponent
+{
+	EntityId parent = UNDEFINED_ENTITY_ID;
+	EntityId firstChild = UNDEFINED_ENTITY_ID;
+	EntityId nextSibling = UNDEFINED_ENTITY_ID;
+};
+
+/*
+	Parent/child relations (turret on tank, item in hand) with local and world 2D transforms.
+	Nodes are stored densely and sorted by depth - every depth level is one contiguous range
+	and parent always lies in lower level than its children, so world transforms are propagated
+	in one linear pass over arrays, reading parent through stored index instead of recursion.
+	Parenting changes re-sort only moved subtree: each node is swapped out of its level range
+	and inserted at the end of new one, shifting one boundary element per level in between.
+	Entity ids are mapped to dense indices through a sparse lookup table sized by max entity id.
+*/
+
+class TransformHierarchy
+{
+public:
+	static constexpr u32 INVALID_INDEX = ~0u;
+
+	TransformHierarchy(PoolSize p_capacity);
+	TransformHierarchy(const TransformHierarchy&) = delete;
+
+	//entity is added as root
+	bool add(EntityId, const Transform2D& p_local = Transform2D());
+	//children of removed entity become roots
+	bool remove(EntityId);
+	bool has(EntityId) const;
+
+	//UNDEFINED_ENTITY_ID as parent detaches entity, cycles are rejected
+	bool setParent(EntityId p_child, EntityId p_parent);
+	EntityId getParent(EntityId) const;
+	const HierarchyComponent& getLinks(EntityId) const;
+	u32 getDepth(EntityId) const;
+
+	void setLocal(EntityId, const Transform2D&);
+	const Transform2D& getLocal(EntityId) const;
+	//valid after propagate
+	const Transform2D& getWorld(EntityId) const;
+
+	u32 size() const;
+	u32 getNrOfLevels() const;
+	u32 getIndex(EntityId) const;
+	EntityId getEntityId(u32 p_index) const;
+
+	void propagate();
+	/*
+		Levels are processed one after another, every level is split between all threads of executor.
+		Nodes of one level are roots of independent subtrees at that point, so no locking is needed,
+		only barrier between levels - worth it for big hierarchies only.
+	*/
+	void propagateParallel(ITaskExecutor&);
+
+private:
+	bool isIdInRange(EntityId) const;
+	bool isDescendant(EntityId p_id, EntityId p_ancestor) const;
+	void unlinkFromParent(EntityId);
+	void changeDepth(EntityId p_root, u32 p_newDepth);
+	void relocate(u32 p_index, u32 p_newDepth);
+
+	u32 levelBegin(u32 p_level) const;
+	u32 insertSlot(u32 p_level);
+	void removeSlot(u32 p_index, u32 p_level);
+	void moveElement(u32 p_from, u32 p_to);
+	void updateChildrenParentIndex(u32 p_index);
+	void propagateRange(u32 p_begin, u32 p_end);
+
+	const PoolSize m_capacity;
+	//extra element after last valid one, holds node while it is moved between levels
+	const u32 m_scratchIndex;
+	u32 m_size = 0u;
+
+	std::vector<EntityId> m_entityIds;
+	std::vector<HierarchyComponent> m_links;
+	std::vector<u32> m_parentIndices;
+	std::vector<u32> m_depths;
+	std::vector<Transform2D> m_locals;
+	std::vector<Transform2D> m_worlds;
+	//cos/sin of world rotation, computed once per node and reused by all its children
+	std::vector<f32> m_worldCos;
+	std::vector<f32> m_worldSin;
+
+	//end of every depth level range, level d occupies [m_levelEnds[d - 1], m_levelEnds[d])
+	std::vector<u32> m_levelEnds;
+	std::vector<EntityId> m_subtree;
+	std::vector<u32> m_sparseIndices;
+};
+
+}
@@ -0,0 +1,71 @@
+#pragma once
+#include <vector>
+#include "Types.h"
+#include "Constants.h"
+#include "IntegrationKernels.h"
+
+namespace engine
+{
+
+/*
+	Position/velocity storage for POSITION + MOVABLE entities laid out as structure of arrays.
+	Elements are kept densely packed (swap with last on remove, like ContinuousPool),
+	so systems can run SIMD kernels straight over the arrays.
+	Entity ids are mapped to dense indices through a sparse lookup table sized by max entity id.
+*/
+
+class TransformStore
+{
+public:
+	static constexpr u32 INVALID_INDEX = ~0u;
+
+	TransformStore(PoolSize p_capacity);
+	TransformStore(const TransformStore&) = delete;
+
+	bool add(EntityId, f32 p_positionX, f32 p_positionY, f32 p_velocityX = 0.0f, f32 p_velocityY = 0.0f);
+	bool remove(EntityId);
+	bool has(EntityId) const;
+	void clear();
+
+	u32 size() const;
+	PoolSize capacity() const;
+
+	u32 getIndex(EntityId) const;
+	EntityId getEntityId(u32 p_index) const;
+
+	void setPosition(EntityId, f32 p_x, f32 p_y);
+	void setVelocity(EntityId, f32 p_x, f32 p_y);
+
+	f32* positionsX();
+	f32* positionsY();
+	f32* velocitiesX();
+	f32* velocitiesY();
+
+	const f32* positionsX() const;
+	const f32* positionsY() const;
+	const f32* velocitiesX() const;
+	const f32* velocitiesY() const;
+	const EntityId* entityIds() const;
+
+	bool restoreEntityIds(const EntityId* p_ids, u32 p_size);
+
+	void integrate(f32 p_deltaTime);
+	void integrate(f32 p_deltaTime, IntegrationKernel p_kernel);
+
+private:
+	bool isIdInRange(EntityId) const;
+	void moveElement(u32 p_from, u32 p_to);
+
+	const PoolSize m_capacity;
+	u32 m_size = 0u;
+
+	std::vector<f32> m_positionsX;
+	std::vector<f32> m_positionsY;
+	std::vector<f32> m_velocitiesX;
+	std::vector<f32> m_velocitiesY;
+
+	std::vector<EntityId> m_entityIds;
+	std::vector<u32> m_sparseIndices;
+};
+
+}
@@ -0,0 +1,64 @@
+#pragma once
+#include <vector>
+#include "Types.h"
+#include "IIdGuard.h"
+#include "EntityPool.h"
+#include "Pool.h"
+#include "ComponentPool.h"
+#include "TransformStore.h"
+#include "DeltaSnapshotter.h"
+
+namespace engine
+{
+
+/*
+	Keeps last frames of the world for rollback: entities with EntityPool and IdGuard state,
+	registered component pools and TransformStore. Built on DeltaSnapshotter - saveFrame() stores
+	only chunks which changed since previous frame (dirty chunks found by comparison with baseline),
+	restoreFrame(n) applies last n deltas backwards in place. All buffers are allocated on registration
+	and reused, so saving frames does not allocate memory (restoring rebuilds id sets of EntityPool and IdGuard).
+	Pools do not move during rollback, ComponentPtr links between restored elements stay valid.
+	Typical loop: saveFrame() after every tick; on late input restoreFrame(n), apply input, resimulate n ticks
+	calling saveFrame() after each of them.
+	Everything has to be registered before first saveFrame().
+*/
+
+class WorldHistory
+{
+public:
+	WorldHistory(EntityPool&, u32 p_nrOfFrames = delta::DEFAULT_HISTORY_SIZE);
+	WorldHistory(const WorldHistory&) = delete;
+
+	template<typename ComponentStruct>
+	void registerComponentPool(ContinuousPool<ComponentStruct>& p_pool)
+	{
+		m_snapshotter.registerPool(p_pool);
+	}
+
+	template<typename ComponentStruct>
+	void registerComponentPool(ComponentPool<ComponentStruct>& p_pool)
+	{
+		registerComponentPool(p_pool.getPool());
+	}
+
+	void registerTransformStore(TransformStore&);
+
+	void saveFrame();
+	bool restoreFrame(u32 p_framesAgo);
+
+	u32 getNumOfStoredFrames() const;
+	u32 getCurrentFrame() const;
+
+private:
+	void saveIdGuardState();
+	void restoreEntityPoolState();
+
+	EntityPool& m_entityPool;
+	DeltaSnapshotter m_snapshotter;
+
+	IdGuardState m_idGuardState;
+	std::vector<Id> m_freedIds;
+	bool m_hasBaseline = false;
+};
+
+}
@@ -0,0 +1,250 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <type_traits>
+#include <vector>
+#include "Types.h"
+#include "Entity.h"
+#include "ComponentBase.h"
+#include "Pool.h"
+#include "ComponentPool.h"
+#include "EntityPool.h"
+#include "IIdGuard.h"
+#include "TransformStore.h"
+#include "MappedFile.h"
+
+namespace engine
+{
+
+namespace snapshot
+{
+	constexpr u32 MAGIC = 0x4E535047u; //"GPSN"
+	constexpr u32 VERSION = 4u;
+	constexpr u32 BLOCK_ALIGNMENT = 16u; //block data is padded to it, so mapped blocks can be used in place
+
+	constexpr u32 ENTITY_BLOCK = 0x10000u;
+	constexpr u32 TRANSFORM_BLOCK = 0x10001u;
+	//IdGuardState followed by freed ids, element is one Id
+	constexpr u32 ID_GUARD_BLOCK = 0x10002u;
+	constexpr u32 ID_GUARD_STATE_SIZE = sizeof(IdGuardState) / sizeof(Id);
+	static_assert(sizeof(IdGuardState) % sizeof(Id) == 0u, "IdGuardState has to be stored as whole ids");
+	//component blocks use ComponentType value as type id
+
+	struct FileHeader
+	{
+		u32 magic = MAGIC;
+		u32 version = VERSION;
+		u32 nrOfBlocks = 0u;
+		u32 reserved = 0u;
+	};
+
+	struct BlockHeader
+	{
+		u32 typeId = 0u;
+		u32 elementSize = 0u;
+		u32 count = 0u;
+		u32 version = VERSION;
+		//elements the saved pool could hold - space for them is reserved in the file after stored ones
+		u32 capacity = 0u;
+		u32 reserved[3] = {};
+	};
+	static_assert(sizeof(BlockHeader) % BLOCK_ALIGNMENT == 0u, "block data has to start aligned");
+
+	//ComponentPtr stored in file: 0 - nullptr, otherwise 1 + element index counted across all component blocks
+	using EncodedPtr = std::uintptr_t;
+}
+
+/*
+	Saves/loads whole world state as flat binary: file header followed by one block per pool,
+	each block is a BlockHeader and raw contiguous memory of the pool. Entity and component blocks are
+	zero-filled up to capacity of the saved pool, so the file is as big as the pools, not as their content.
+	Blocks: entities (with ComponentIndicators), every registered component pool, TransformStore arrays
+	and state of IdGuard of the EntityPool - after loading, stored ids of the pool are rebuilt, so hasEntity()
+	answers for restored entities and new entities do not get ids of restored ones.
+	ComponentPtr links (Entity::components, ComponentBase::nextComponent) are written as indices and
+	turned back into addresses after all blocks are read, so loading is few big reads plus one linear fix-up pass.
+	Raw layout is platform specific (sizes are checked, endianness is not) - snapshot is meant for
+	the same build, e.g. server save/restore, not as an exchange format.
+	Unknown block types are skipped. When load() fails, content of pools is unspecified.
+
+	map() is zero-copy variant of load(): entity and component pools are switched to external storage
+	pointing straight into MappedFile (which has to outlive them), with capacity of the saved pools,
+	so new entities and components are created in the reserved part of the mapping.
+	Writes go to private copies of touched pages only (MAP_PRIVATE). It is not faster than load():
+	links and vtable pointers of every element are fixed up, which touches every page anyway,
+	it only saves second copy of pool memory. TransformStore arrays are still copied.
+*/
+
+class WorldSnapshot
+{
+public:
+	WorldSnapshot(EntityPool&, TransformStore&);
+	WorldSnapshot(const WorldSnapshot&) = delete;
+
+	template<typename ComponentStruct>
+	void registerComponentPool(ContinuousPool<ComponentStruct>& p_pool)
+	{
+		m_componentBlocks.push_back(std::make_unique<ComponentBlock<ComponentStruct>>(p_pool));
+	}
+
+	template<typename ComponentStruct>
+	void registerComponentPool(ComponentPool<ComponentStruct>& p_pool)
+	{
+		registerComponentPool(p_pool.getPool());
+	}
+
+	bool save(std::ostream&) const;
+	bool load(std::istream&);
+	bool map(MappedFile&);
+
+private:
+	class IComponentBlock
+	{
+	public:
+		IComponentBlock() = default;
+		virtual ~IComponentBlock() = default;
+
+		virtual u32 getTypeId() const = 0;
+		virtual u32 getElementSize() const = 0;
+		virtual u32 size() const = 0;
+		virtual PoolSize maxSize() const = 0;
+
+		virtual u8* data() = 0;
+		virtual const u8* data() const = 0;
+		virtual u8* prepareForLoad(u32 p_count) = 0;
+		virtual void useExternalStorage(u8* p_data, PoolSize p_capacity, u32 p_count) = 0;
+		virtual void restoreTypeInfo() = 0;
+
+		virtual ComponentBase& getComponent(u32 p_index) = 0;
+		virtual const ComponentBase& getComponent(u32 p_index) const = 0;
+	};
+
+	template<typename ComponentStruct>
+	class ComponentBlock : public IComponentBlock
+	{
+	public:
+		ComponentBlock(ContinuousPool<ComponentStruct>& p_pool)
+			:m_pool(p_pool)
+		{
+		}
+
+		u32 getTypeId() const override
+		{
+			return static_cast<u32>(ComponentStruct().type);
+		}
+
+		u32 getElementSize() const override
+		{
+			return sizeof(ComponentStruct);
+		}
+
+		u32 size() const override
+		{
+			return m_pool.size();
+		}
+
+		PoolSize maxSize() const override
+		{
+			return m_pool.maxSize();
+		}
+
+		u8* data() override
+		{
+			return reinterpret_cast<u8*>(m_pool.data());
+		}
+
+		const u8* data() const override
+		{
+			return reinterpret_cast<const u8*>(m_pool.data());
+		}
+
+		u8* prepareForLoad(u32 p_count) override
+		{
+			m_pool.clear();
+			return reinterpret_cast<u8*>(m_pool.getNextBlock(p_count));
+		}
+
+		void useExternalStorage(u8* p_data, PoolSize p_capacity, u32 p_count) override
+		{
+			m_pool.clear();
+			m_pool.useExternalStorage(reinterpret_cast<ComponentStruct*>(p_data), p_capacity, p_count);
+		}
+
+		/*
+			Loaded bytes contain pointer to virtual table of the process which saved them.
+			Copy valid one from freshly constructed object (vptr sits at the beginning of the object
+			for single inheritance on MSVC and Itanium ABI). Already valid pointers are not written,
+			so pages of mapped snapshot saved by the same non-relocated binary stay shared.
+		*/
+		void restoreTypeInfo() override
+		{
+			if constexpr (std::is_polymorphic_v<ComponentStruct>)
+			{
+				const ComponentStruct l_prototype;
+
+				for (auto& l_component : m_pool)
+				{
+					if (std::memcmp(static_cast<const void*>(&l_component), static_cast<const void*>(&l_prototype), sizeof(void*)) != 0)
+					{
+						std::memcpy(static_cast<void*>(&l_component), static_cast<const void*>(&l_prototype), sizeof(void*));
+					}
+				}
+			}
+		}
+
+		ComponentBase& getComponent(u32 p_index) override
+		{
+			return m_pool.data()[p_index];
+		}
+
+		const ComponentBase& getComponent(u32 p_index) const override
+		{
+			return m_pool.data()[p_index];
+		}
+
+	private:
+		ContinuousPool<ComponentStruct>& m_pool;
+	};
+
+	struct LoadedBlock
+	{
+		IComponentBlock* block;
+		u32 firstIndex;
+		u32 count;
+	};
+
+	snapshot::EncodedPtr encode(ComponentPtr) const;
+	ComponentPtr decode(snapshot::EncodedPtr, const std::vector<LoadedBlock>&) const;
+
+	void writeEntities(std::ostream&) const;
+	void writeComponents(std::ostream&, const IComponentBlock&) const;
+	void writeTransforms(std::ostream&) const;
+	void writeIdGuard(std::ostream&) const;
+
+	bool readEntities(std::istream&, const snapshot::BlockHeader&);
+	bool readComponents(std::istream&, const snapshot::BlockHeader&, IComponentBlock&);
+	bool readTransforms(std::istream&, const snapshot::BlockHeader&);
+	bool readIdGuard(std::istream&, const snapshot::BlockHeader&);
+	bool restoreIdGuard(const snapshot::BlockHeader&);
+	bool skipBlock(std::istream&, const snapshot::BlockHeader&);
+
+	bool mapEntities(u8* p_data, const snapshot::BlockHeader&);
+	bool mapComponents(u8* p_data, const snapshot::BlockHeader&, IComponentBlock&);
+	bool copyTransforms(const u8* p_data, const snapshot::BlockHeader&);
+	bool copyIdGuard(const u8* p_data, const snapshot::BlockHeader&);
+
+	IComponentBlock* findComponentBlock(u32 p_typeId);
+	void relinkComponents(const std::vector<LoadedBlock>&);
+
+	EntityPool& m_entityPool;
+	ContinuousPool<Entity>& m_entities;
+	TransformStore& m_transforms;
+	//IdGuardState followed by freed ids, sized for every id of the pool
+	mutable std::vector<Id> m_idGuardData;
+	std::vector<std::unique_ptr<IComponentBlock>> m_componentBlocks;
+};
+
+}
@@ -1,3 +1,12 @@
 #pragma once
 #include "Pool.h"
-#include "ComponentPool.h"
\ No newline at end of file
+#include "ComponentPool.h"
+#include "TransformStore.h"
+#include "TransformHierarchy.h"
+#include "FrameArena.h"
+#include "TrackingMemoryResource.h"
+#include "PageBackedMemoryResource.h"
+#include "MappedFile.h"
+#include "WorldSnapshot.h"
+#include "DeltaSnapshotter.h"
+#include "WorldHistory.h"
@@ -0,0 +1,387 @@
+#include "DeltaSnapshotter.h"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <random>
+#include "assert.h"
+
+namespace engine
+{
+
+namespace
+{
+	constexpr u32 MAX_RUN = 255u;
+
+	template<typename Type>
+	void append(std::vector<u8>& p_output, const Type& p_value)
+	{
+		const auto l_position = p_output.size();
+		p_output.resize(l_position + sizeof(Type));
+		std::memcpy(p_output.data() + l_position, &p_value, sizeof(Type));
+	}
+
+	template<typename Type>
+	bool read(const u8*& p_position, const u8* p_end, Type& p_value)
+	{
+		if (static_cast<std::size_t>(p_end - p_position) < sizeof(Type))
+		{
+			return false;
+		}
+
+		std::memcpy(&p_value, p_position, sizeof(Type));
+		p_position += sizeof(Type);
+
+		return true;
+	}
+
+	//random part differs between processes, counter between snapshotters of one process
+	u64 createOrigin()
+	{
+		static const u64 s_processTag = static_cast<u64>(std::random_device()()) << 32u;
+		static std::atomic<u64> s_nextSnapshotter{1u};
+
+		return s_processTag + s_nextSnapshotter.fetch_add(1u);
+	}
+}
+
+DeltaSnapshotter::DeltaSnapshotter(u32 p_historySize)
+	:m_origin(createOrigin()),
+	 m_history(p_historySize)
+{
+	assert(p_historySize > 0u);
+}
+
+u32 DeltaSnapshotter::registerRegion(void* p_data, std::size_t p_size, Hook p_beforeCapture, Hook p_afterApply)
+{
+	m_regions.push_back({ static_cast<u8*>(p_data), p_size, m_baseline.size(), std::move(p_beforeCapture), std::move(p_afterApply) });
+	m_baseline.resize(m_baseline.size() + p_size);
+
+	return static_cast<u32>(m_regions.size() - 1u);
+}
+
+void DeltaSnapshotter::registerTransformStore(TransformStore& p_store)
+{
+	const auto l_capacity = static_cast<std::size_t>(p_store.capacity());
+
+	registerRegion(p_store.positionsX(), l_capacity * sizeof(f32));
+	registerRegion(p_store.positionsY(), l_capacity * sizeof(f32));
+	registerRegion(p_store.velocitiesX(), l_capacity * sizeof(f32));
+	registerRegion(p_store.velocitiesY(), l_capacity * sizeof(f32));
+
+	//dense ids and size go through mirrors, store rebuilds its sparse index from them after apply
+	auto& l_ids = m_idMirrors.emplace_back(l_capacity, UNDEFINED_ENTITY_ID);
+	auto& l_size = m_sizeMirrors.emplace_back(0u);
+
+	registerRegion(l_ids.data(), l_capacity * sizeof(EntityId),
+		[&p_store, &l_ids, &l_size]()
+		{
+			const TransformStore& l_store = p_store;
+			l_size = l_store.size();
+			std::copy(l_store.entityIds(), l_store.entityIds() + l_size, l_ids.begin());
+		});
+
+	registerRegion(&l_size, sizeof(l_size), Hook(),
+		[&p_store, &l_ids, &l_size]()
+		{
+			p_store.restoreEntityIds(l_ids.data(), l_size);
+		});
+}
+
+void DeltaSnapshotter::captureBaseline()
+{
+	runBeforeCaptureHooks();
+
+	for (const auto& l_region : m_regions)
+	{
+		std::memcpy(m_baseline.data() + l_region.baselineOffset, l_region.data, l_region.size);
+	}
+
+	m_nrOfStoredDeltas = 0u;
+}
+
+const std::vector<u8>& DeltaSnapshotter::captureDelta()
+{
+	runBeforeCaptureHooks();
+
+	m_newestDelta = (m_newestDelta + 1u) % m_history.size();
+	m_nrOfStoredDeltas = std::min(m_nrOfStoredDeltas + 1u, static_cast<u32>(m_history.size()));
+
+	auto& l_output = m_history[m_newestDelta];
+	l_output.clear();
+
+	delta::DeltaHeader l_header;
+	l_header.frame = ++m_frame;
+	l_header.origin = m_origin;
+	l_header.nrOfRegions = static_cast<u32>(m_regions.size());
+	append(l_output, l_header);
+
+	for (auto l_regionIndex = 0u; l_regionIndex < m_regions.size(); l_regionIndex++)
+	{
+		const auto& l_region = m_regions[l_regionIndex];
+		auto l_baseline = m_baseline.data() + l_region.baselineOffset;
+
+		for (std::size_t l_offset = 0u; l_offset < l_region.size; l_offset += delta::CHUNK_SIZE)
+		{
+			const auto l_chunkSize = static_cast<u32>(std::min<std::size_t>(delta::CHUNK_SIZE, l_region.size - l_offset));
+
+			if (std::memcmp(l_region.data + l_offset, l_baseline + l_offset, l_chunkSize) == 0)
+			{
+				continue;
+			}
+
+			const auto l_recordPosition = l_output.size();
+			append(l_output, delta::RecordHeader());
+
+			encodeChunk(l_output, l_region.data + l_offset, l_baseline + l_offset, l_chunkSize);
+			std::memcpy(l_baseline + l_offset, l_region.data + l_offset, l_chunkSize);
+
+			delta::RecordHeader l_record;
+			l_record.region = l_regionIndex;
+			l_record.chunk = static_cast<u32>(l_offset / delta::CHUNK_SIZE);
+			l_record.encodedSize = static_cast<u32>(l_output.size() - l_recordPosition - sizeof(l_record));
+			std::memcpy(l_output.data() + l_recordPosition, &l_record, sizeof(l_record));
+
+			l_header.nrOfRecords++;
+		}
+	}
+
+	std::memcpy(l_output.data(), &l_header, sizeof(l_header));
+	return l_output;
+}
+
+void DeltaSnapshotter::encodeChunk(std::vector<u8>& p_output, const u8* p_current, const u8* p_baseline, u32 p_size) const
+{
+	u32 l_position = 0u;
+
+	while (l_position < p_size)
+	{
+		u32 l_zeros = 0u;
+		while (l_position + l_zeros < p_size and l_zeros < MAX_RUN and p_current[l_position + l_zeros] == p_baseline[l_position + l_zeros])
+		{
+			l_zeros++;
+		}
+
+		l_position += l_zeros;
+
+		u32 l_literals = 0u;
+		while (l_position + l_literals < p_size and l_literals < MAX_RUN and p_current[l_position + l_literals] != p_baseline[l_position + l_literals])
+		{
+			l_literals++;
+		}
+
+		p_output.push_back(static_cast<u8>(l_zeros));
+		p_output.push_back(static_cast<u8>(l_literals));
+
+		for (auto i = 0u; i < l_literals; i++)
+		{
+			p_output.push_back(p_current[l_position + i] ^ p_baseline[l_position + i]);
+		}
+
+		l_position += l_literals;
+	}
+}
+
+/*
+	Redo - delta goes back into history, so next rewind() steps over it like over a captured one.
+	Only the delta of the frame right after the current one fits between its neighbours in history.
+*/
+
+bool DeltaSnapshotter::applyDelta(const u8* p_delta, std::size_t p_size)
+{
+	delta::DeltaHeader l_header;
+
+	if (p_size < sizeof(l_header))
+	{
+		return false;
+	}
+
+	std::memcpy(&l_header, p_delta, sizeof(l_header));
+
+	if (l_header.origin != m_origin or l_header.frame != m_frame + 1u)
+	{
+		return false;
+	}
+
+	restoreBaseline();
+
+	if (not applyRecords(p_delta, p_size))
+	{
+		return false;
+	}
+
+	m_newestDelta = (m_newestDelta + 1u) % m_history.size();
+	m_nrOfStoredDeltas = std::min(m_nrOfStoredDeltas + 1u, static_cast<u32>(m_history.size()));
+	m_frame++;
+
+	auto& l_stored = m_history[m_newestDelta];
+	if (l_stored.data() != p_delta)
+	{
+		l_stored.assign(p_delta, p_delta + p_size);
+	}
+
+	runAfterApplyHooks();
+	return true;
+}
+
+bool DeltaSnapshotter::applyRecords(const u8* p_delta, std::size_t p_size)
+{
+	const auto l_end = p_delta + p_size;
+	auto l_position = p_delta;
+
+	delta::DeltaHeader l_header;
+
+	if (not read(l_position, l_end, l_header) or l_header.magic != delta::MAGIC or l_header.origin != m_origin or
+		l_header.nrOfRegions != m_regions.size())
+	{
+		return false;
+	}
+
+	for (auto i = 0u; i < l_header.nrOfRecords; i++)
+	{
+		delta::RecordHeader l_record;
+
+		if (not read(l_position, l_end, l_record) or l_record.region >= m_regions.size() or
+			static_cast<std::size_t>(l_end - l_position) < l_record.encodedSize)
+		{
+			return false;
+		}
+
+		const auto& l_region = m_regions[l_record.region];
+		const auto l_offset = static_cast<std::size_t>(l_record.chunk) * delta::CHUNK_SIZE;
+
+		if (l_offset >= l_region.size)
+		{
+			return false;
+		}
+
+		const auto l_chunkSize = static_cast<u32>(std::min<std::size_t>(delta::CHUNK_SIZE, l_region.size - l_offset));
+
+		if (not decodeChunk(l_position, l_record.encodedSize, l_region.data + l_offset,
+							m_baseline.data() + l_region.baselineOffset + l_offset, l_chunkSize))
+		{
+			return false;
+		}
+
+		l_position += l_record.encodedSize;
+	}
+
+	return true;
+}
+
+/*
+	Result is computed from baseline, not from live data - chunk ends up exactly in the other state
+	even if live data has not captured changes.
+*/
+
+bool DeltaSnapshotter::decodeChunk(const u8* p_encoded, u32 p_encodedSize, u8* p_current, u8* p_baseline, u32 p_size) const
+{
+	const auto l_end = p_encoded + p_encodedSize;
+	u32 l_position = 0u;
+
+	std::memcpy(p_current, p_baseline, p_size);
+
+	while (p_encoded < l_end)
+	{
+		if (l_end - p_encoded < 2)
+		{
+			return false;
+		}
+
+		const u32 l_zeros = p_encoded[0];
+		const u32 l_literals = p_encoded[1];
+		p_encoded += 2;
+		l_position += l_zeros;
+
+		if (l_position + l_literals > p_size or static_cast<u32>(l_end - p_encoded) < l_literals)
+		{
+			return false;
+		}
+
+		for (auto i = 0u; i < l_literals; i++)
+		{
+			p_current[l_position + i] ^= p_encoded[i];
+		}
+
+		p_encoded += l_literals;
+		l_position += l_literals;
+	}
+
+	std::memcpy(p_baseline, p_current, p_size);
+	return true;
+}
+
+bool DeltaSnapshotter::rewind(u32 p_nrOfFrames)
+{
+	if (p_nrOfFrames > m_nrOfStoredDeltas)
+	{
+		return false;
+	}
+
+	restoreBaseline();
+
+	for (auto i = 0u; i < p_nrOfFrames; i++)
+	{
+		const auto& l_delta = m_history[m_newestDelta];
+
+		if (not applyRecords(l_delta.data(), l_delta.size()))
+		{
+			return false;
+		}
+
+		m_newestDelta = static_cast<u32>((m_newestDelta + m_history.size() - 1u) % m_history.size());
+		m_nrOfStoredDeltas--;
+		m_frame--;
+	}
+
+	runAfterApplyHooks();
+	return true;
+}
+
+u32 DeltaSnapshotter::getNumOfStoredDeltas() const
+{
+	return m_nrOfStoredDeltas;
+}
+
+const std::vector<u8>& DeltaSnapshotter::getDelta(u32 p_framesAgo) const
+{
+	assert(p_framesAgo < m_nrOfStoredDeltas);
+	return m_history[(m_newestDelta + m_history.size() - p_framesAgo) % m_history.size()];
+}
+
+u32 DeltaSnapshotter::getFrame() const
+{
+	return m_frame;
+}
+
+//drops changes made after last capture, deltas are relative to captured states
+void DeltaSnapshotter::restoreBaseline()
+{
+	for (const auto& l_region : m_regions)
+	{
+		std::memcpy(l_region.data, m_baseline.data() + l_region.baselineOffset, l_region.size);
+	}
+}
+
+void DeltaSnapshotter::runBeforeCaptureHooks()
+{
+	for (auto& l_region : m_regions)
+	{
+		if (l_region.beforeCapture)
+		{
+			l_region.beforeCapture();
+		}
+	}
+}
+
+void DeltaSnapshotter::runAfterApplyHooks()
+{
+	for (auto& l_region : m_regions)
+	{
+		if (l_region.afterApply)
+		{
+			l_region.afterApply();
+		}
+	}
+}
+
+}
@@ -1,33 +1,49 @@
 #include "EntityPool.h"
+#include <algorithm>
+#include "Profiler.h"
 
 namespace engine
 {
-	EntityPool::EntityPool(PoolSize p_poolSize, std::unique_ptr<IIdGuard> p_guard)
-		: m_pool(p_poolSize),
-		  m_idGuard(std::move(p_guard))
+	EntityPool::EntityPool(PoolSize p_poolSize, std::unique_ptr<IIdGuard> p_guard, std::pmr::memory_resource& p_memoryResource)
+		: m_pool(p_poolSize, p_memoryResource),
+		  m_idGuard(std::move(p_guard)),
+		  m_storedIds(&p_memoryResource)
 	{
 	}
 
 	Entity& EntityPool::create()
 	{
-		auto& l_entity = m_pool.getNext();	
-
-		l_entity.id = m_idGuard->getNextId();
-		m_storedIds.emplace(l_entity.id);
+		ENGINE_PROFILE_ZONE("EntityPool::create");
+		//slot may still hold copy of previously moved entity, so it has to be constructed from scratch
+		auto& l_entity = m_pool.allocate(m_idGuard->getNextId());
+		markAsStored(l_entity.id);
 
 		return l_entity;
 	}
 
-	bool EntityPool::removeEntity(EntityId p_id)
+	Entity* EntityPool::createMultiple(u32 p_count)
 	{
-		auto l_iter = m_storedIds.find(p_id);
+		ENGINE_PROFILE_ZONE("EntityPool::createMultiple");
+		auto l_entities = m_pool.getNextBlock(p_count);
+
+		for (auto i = 0u; i < p_count; i++)
+		{
+			new (&l_entities[i]) Entity(m_idGuard->getNextId());
+			markAsStored(l_entities[i].id);
+		}
+
+		return l_entities;
+	}
 
-		if (l_iter != m_storedIds.end())
+	bool EntityPool::removeEntity(EntityId p_id)
+	{
+		ENGINE_PROFILE_ZONE("EntityPool::removeEntity");
+		if (hasEntity(p_id))
 		{
 			m_pool.takeBack(getEntity(p_id));
 
 			m_idGuard->freeId(p_id);
-			m_storedIds.erase(l_iter);
+			m_storedIds[p_id] = false;
 			
 			return true;
 		}
@@ -60,8 +76,7 @@ namespace engine
 
 	bool EntityPool::hasEntity(EntityId p_id) const
 	{
-		auto l_iter = m_storedIds.find(p_id);
-		return l_iter != m_storedIds.end();
+		return p_id < m_storedIds.size() and m_storedIds[p_id];
 	}
 
 	/*
@@ -78,4 +93,34 @@ namespace engine
 		m_storedIds.clear();
 		m_idGuard->reset();
 	}
+
+	ContinuousPool<Entity>& EntityPool::getEntities()
+	{
+		return m_pool;
+	}
+
+	IIdGuard& EntityPool::getIdGuard()
+	{
+		return *m_idGuard;
+	}
+
+	void EntityPool::rebuildStoredIds()
+	{
+		std::fill(m_storedIds.begin(), m_storedIds.end(), false);
+
+		for (const auto& l_entity : m_pool)
+		{
+			markAsStored(l_entity.id);
+		}
+	}
+
+	void EntityPool::markAsStored(EntityId p_id)
+	{
+		if (p_id >= m_storedIds.size())
+		{
+			m_storedIds.resize(p_id + 1u, false);
+		}
+
+		m_storedIds[p_id] = true;
+	}
 }
\ No newline at end of file
@@ -0,0 +1,129 @@
+#include "FrameArena.h"
+#include <algorithm>
+#include <cstdint>
+#include "assert.h"
+
+namespace engine
+{
+
+namespace
+{
+	std::size_t alignUp(std::size_t p_value, std::size_t p_alignment)
+	{
+		return (p_value + p_alignment - 1u) & ~(p_alignment - 1u);
+	}
+
+	[[maybe_unused]] bool isPowerOfTwo(std::size_t p_value)
+	{
+		return p_value != 0u and (p_value & (p_value - 1u)) == 0u;
+	}
+}
+
+FrameArena::FrameArena(std::size_t p_bytesPerThread, u32 p_nrOfThreads)
+	:m_capacityPerThread(alignUp(p_bytesPerThread, core::CACHE_LINE_SIZE)),
+	 m_memory(new u8[m_capacityPerThread * p_nrOfThreads + core::CACHE_LINE_SIZE]),
+	 m_subArenas(p_nrOfThreads)
+{
+	assert(p_nrOfThreads > 0u);
+
+	const auto l_address = reinterpret_cast<std::uintptr_t>(m_memory.get());
+	auto l_alignedMemory = m_memory.get() + (alignUp(l_address, core::CACHE_LINE_SIZE) - l_address);
+
+	for (auto& l_subArena : m_subArenas)
+	{
+		l_subArena.memory = l_alignedMemory;
+		l_alignedMemory += m_capacityPerThread;
+	}
+}
+
+void* FrameArena::allocate(std::size_t p_size, std::size_t p_alignment, u32 p_threadIndex)
+{
+	assert(p_threadIndex < m_subArenas.size());
+	assert(isPowerOfTwo(p_alignment));
+
+	auto& l_subArena = m_subArenas[p_threadIndex];
+
+	if (l_subArena.frameNumber != m_frameNumber)
+	{
+		l_subArena.frameNumber = m_frameNumber;
+		l_subArena.offset = 0u;
+	}
+
+	const auto l_address = reinterpret_cast<std::uintptr_t>(l_subArena.memory) + l_subArena.offset;
+	const auto l_begin = l_subArena.offset + (alignUp(l_address, p_alignment) - l_address);
+	const auto l_end = l_begin + p_size;
+
+	l_subArena.highWaterMark = std::max(l_subArena.highWaterMark, l_end);
+
+	if (l_end > m_capacityPerThread)
+	{
+		l_subArena.nrOfFailedAllocations++;
+		return nullptr;
+	}
+
+	l_subArena.offset = l_end;
+	return l_subArena.memory + l_begin;
+}
+
+void FrameArena::reset()
+{
+	m_frameNumber++;
+}
+
+u32 FrameArena::getFrameNumber() const
+{
+	return m_frameNumber;
+}
+
+u32 FrameArena::getNumOfThreads() const
+{
+	return static_cast<u32>(m_subArenas.size());
+}
+
+std::size_t FrameArena::getCapacityPerThread() const
+{
+	return m_capacityPerThread;
+}
+
+FrameArenaStats FrameArena::getStats(u32 p_threadIndex) const
+{
+	assert(p_threadIndex < m_subArenas.size());
+
+	const auto& l_subArena = m_subArenas[p_threadIndex];
+
+	FrameArenaStats l_stats;
+	l_stats.capacity = m_capacityPerThread;
+	l_stats.usedBytes = getUsedBytes(l_subArena);
+	l_stats.highWaterMark = l_subArena.highWaterMark;
+	l_stats.nrOfFailedAllocations = l_subArena.nrOfFailedAllocations;
+
+	return l_stats;
+}
+
+std::size_t FrameArena::getHighWaterMark() const
+{
+	std::size_t l_highWaterMark = 0u;
+
+	for (const auto& l_subArena : m_subArenas)
+	{
+		l_highWaterMark = std::max(l_highWaterMark, l_subArena.highWaterMark);
+	}
+
+	return l_highWaterMark;
+}
+
+void FrameArena::resetStats()
+{
+	for (auto& l_subArena : m_subArenas)
+	{
+		l_subArena.highWaterMark = getUsedBytes(l_subArena);
+		l_subArena.nrOfFailedAllocations = 0u;
+	}
+}
+
+std::size_t FrameArena::getUsedBytes(const SubArena& p_subArena) const
+{
+	return p_subArena.frameNumber == m_frameNumber ? p_subArena.offset : 0u;
+}
+
+}
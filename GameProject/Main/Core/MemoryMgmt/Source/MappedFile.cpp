@@ -0,0 +1,115 @@
+#include "MappedFile.h"
+
+#if defined(_WIN32)
+	#ifndef NOMINMAX
+		#define NOMINMAX
+	#endif
+	#include <windows.h>
+#else
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+namespace engine
+{
+
+MappedFile::~MappedFile()
+{
+	close();
+}
+
+bool MappedFile::open(const std::string& p_path)
+{
+	close();
+
+#if defined(_WIN32)
+	auto l_file = CreateFileA(p_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (l_file == INVALID_HANDLE_VALUE)
+	{
+		return false;
+	}
+
+	LARGE_INTEGER l_fileSize;
+	const auto l_hasSize = GetFileSizeEx(l_file, &l_fileSize) and l_fileSize.QuadPart > 0;
+	auto l_mapping = l_hasSize ? CreateFileMappingA(l_file, nullptr, PAGE_WRITECOPY, 0u, 0u, nullptr) : nullptr;
+	CloseHandle(l_file);
+
+	if (l_mapping == nullptr)
+	{
+		return false;
+	}
+
+	auto l_view = MapViewOfFile(l_mapping, FILE_MAP_COPY, 0u, 0u, 0u);
+	CloseHandle(l_mapping);
+
+	if (l_view == nullptr)
+	{
+		return false;
+	}
+
+	m_data = static_cast<u8*>(l_view);
+	m_size = static_cast<std::size_t>(l_fileSize.QuadPart);
+#else
+	const auto l_file = ::open(p_path.c_str(), O_RDONLY);
+	if (l_file < 0)
+	{
+		return false;
+	}
+
+	struct stat l_stat;
+	const auto l_hasSize = fstat(l_file, &l_stat) == 0 and l_stat.st_size > 0;
+	auto l_view = l_hasSize ? mmap(nullptr, l_stat.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, l_file, 0) : MAP_FAILED;
+	::close(l_file);
+
+	if (l_view == MAP_FAILED)
+	{
+		return false;
+	}
+
+	m_data = static_cast<u8*>(l_view);
+	m_size = static_cast<std::size_t>(l_stat.st_size);
+#endif
+
+	return true;
+}
+
+void MappedFile::close()
+{
+	if (m_data == nullptr)
+	{
+		return;
+	}
+
+#if defined(_WIN32)
+	UnmapViewOfFile(m_data);
+#else
+	munmap(m_data, m_size);
+#endif
+
+	m_data = nullptr;
+	m_size = 0u;
+}
+
+bool MappedFile::isOpen() const
+{
+	return m_data != nullptr;
+}
+
+u8* MappedFile::data()
+{
+	return m_data;
+}
+
+const u8* MappedFile::data() const
+{
+	return m_data;
+}
+
+std::size_t MappedFile::size() const
+{
+	return m_size;
+}
+
+}
@@ -0,0 +1,235 @@
+#include "PageBackedMemoryResource.h"
+#include <cstdint>
+#include <new>
+#include "assert.h"
+
+#if defined(_WIN32)
+	#ifndef NOMINMAX
+		#define NOMINMAX
+	#endif
+	#include <windows.h>
+#else
+	#include <sys/mman.h>
+	#include <sys/syscall.h>
+	#include <unistd.h>
+#endif
+
+namespace engine
+{
+
+namespace
+{
+	std::size_t alignUp(std::size_t p_value, std::size_t p_alignment)
+	{
+		return (p_value + p_alignment - 1u) & ~(p_alignment - 1u);
+	}
+
+#if defined(__linux__)
+	constexpr int MPOL_BIND_MODE = 2;
+	constexpr unsigned long NUMA_NODE_MASK_BITS = 8u * sizeof(unsigned long);
+#endif
+}
+
+PageBackedMemoryResource::PageBackedMemoryResource(const PageBackingSettings& p_settings)
+	:m_settings(p_settings)
+{
+}
+
+PageBacking PageBackedMemoryResource::getLastBacking() const
+{
+	return m_lastBacking;
+}
+
+PageBackingStats PageBackedMemoryResource::getStats() const
+{
+	return m_stats;
+}
+
+s32 PageBackedMemoryResource::getCurrentNumaNode()
+{
+#if defined(_WIN32)
+	PROCESSOR_NUMBER l_processor;
+	GetCurrentProcessorNumberEx(&l_processor);
+
+	USHORT l_node = 0u;
+	return GetNumaProcessorNodeEx(&l_processor, &l_node) ? static_cast<s32>(l_node) : ANY_NUMA_NODE;
+#elif defined(__linux__)
+	unsigned l_cpu = 0u;
+	unsigned l_node = 0u;
+	return syscall(SYS_getcpu, &l_cpu, &l_node, nullptr) == 0 ? static_cast<s32>(l_node) : ANY_NUMA_NODE;
+#else
+	return ANY_NUMA_NODE;
+#endif
+}
+
+void* PageBackedMemoryResource::do_allocate(std::size_t p_bytes, [[maybe_unused]] std::size_t p_alignment)
+{
+	assert(p_alignment <= STANDARD_PAGE_SIZE);
+
+	const auto l_size = getMappingSize(p_bytes);
+	void* l_memory = nullptr;
+
+	if (m_settings.pageSize == PageSize::LARGE)
+	{
+		if (l_memory = mapExplicitHugePages(l_size); l_memory != nullptr)
+		{
+			registerAllocation(PageBacking::EXPLICIT_HUGE_PAGES);
+		}
+		else if (l_memory = mapTransparentHugePages(l_size); l_memory != nullptr)
+		{
+			registerAllocation(PageBacking::TRANSPARENT_HUGE_PAGES);
+		}
+	}
+
+	if (l_memory == nullptr)
+	{
+		if (l_memory = mapStandardPages(l_size); l_memory == nullptr)
+		{
+			throw std::bad_alloc();
+		}
+
+		registerAllocation(PageBacking::STANDARD_PAGES);
+	}
+
+	bindToNumaNode(l_memory, l_size);
+	return l_memory;
+}
+
+void PageBackedMemoryResource::do_deallocate(void* p_memory, std::size_t p_bytes, std::size_t)
+{
+#if defined(_WIN32)
+	VirtualFree(p_memory, 0u, MEM_RELEASE);
+#else
+	munmap(p_memory, getMappingSize(p_bytes));
+#endif
+}
+
+bool PageBackedMemoryResource::do_is_equal(const std::pmr::memory_resource& p_other) const noexcept
+{
+	return this == &p_other;
+}
+
+std::size_t PageBackedMemoryResource::getMappingSize(std::size_t p_bytes) const
+{
+	const auto l_pageSize = m_settings.pageSize == PageSize::LARGE ? HUGE_PAGE_SIZE : STANDARD_PAGE_SIZE;
+	return alignUp(p_bytes == 0u ? 1u : p_bytes, l_pageSize);
+}
+
+void* PageBackedMemoryResource::mapExplicitHugePages(std::size_t p_size)
+{
+#if defined(_WIN32)
+	//needs SeLockMemoryPrivilege, without it allocation simply fails
+	const auto l_largePageSize = GetLargePageMinimum();
+	if (l_largePageSize == 0u or p_size % l_largePageSize != 0u)
+	{
+		return nullptr;
+	}
+
+	const auto l_node = m_settings.numaNode == ANY_NUMA_NODE ? NUMA_NO_PREFERRED_NODE : static_cast<DWORD>(m_settings.numaNode);
+	return VirtualAllocExNuma(GetCurrentProcess(), nullptr, p_size, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE, l_node);
+#elif defined(MAP_HUGETLB)
+	//works only if huge pages are reserved in the system (vm.nr_hugepages)
+	auto l_memory = mmap(nullptr, p_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+	return l_memory == MAP_FAILED ? nullptr : l_memory;
+#else
+	return nullptr;
+#endif
+}
+
+void* PageBackedMemoryResource::mapTransparentHugePages(std::size_t p_size)
+{
+#if defined(MADV_HUGEPAGE)
+	//over-map and trim, so the block starts on huge page boundary and can be fully covered by huge pages
+	const auto l_mappedSize = p_size + HUGE_PAGE_SIZE;
+	auto l_mapping = mmap(nullptr, l_mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+	if (l_mapping == MAP_FAILED)
+	{
+		return nullptr;
+	}
+
+	const auto l_begin = reinterpret_cast<std::uintptr_t>(l_mapping);
+	const auto l_alignedBegin = alignUp(l_begin, HUGE_PAGE_SIZE);
+	const auto l_head = l_alignedBegin - l_begin;
+	const auto l_tail = l_mappedSize - l_head - p_size;
+
+	if (l_head != 0u)
+	{
+		munmap(l_mapping, l_head);
+	}
+
+	if (l_tail != 0u)
+	{
+		munmap(reinterpret_cast<void*>(l_alignedBegin + p_size), l_tail);
+	}
+
+	auto l_memory = reinterpret_cast<void*>(l_alignedBegin);
+
+	if (madvise(l_memory, p_size, MADV_HUGEPAGE) != 0)
+	{
+		munmap(l_memory, p_size);
+		return nullptr;
+	}
+
+	return l_memory;
+#else
+	return nullptr;
+#endif
+}
+
+void* PageBackedMemoryResource::mapStandardPages(std::size_t p_size)
+{
+#if defined(_WIN32)
+	const auto l_node = m_settings.numaNode == ANY_NUMA_NODE ? NUMA_NO_PREFERRED_NODE : static_cast<DWORD>(m_settings.numaNode);
+	return VirtualAllocExNuma(GetCurrentProcess(), nullptr, p_size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE, l_node);
+#else
+	auto l_memory = mmap(nullptr, p_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	return l_memory == MAP_FAILED ? nullptr : l_memory;
+#endif
+}
+
+void PageBackedMemoryResource::bindToNumaNode(void* p_memory, std::size_t p_size)
+{
+	if (m_settings.numaNode == ANY_NUMA_NODE)
+	{
+		return;
+	}
+
+#if defined(__linux__) && defined(SYS_mbind)
+	//mbind without libnuma dependency; pages are not touched yet, so they will be placed on the node at first touch
+	if (static_cast<unsigned long>(m_settings.numaNode) < NUMA_NODE_MASK_BITS)
+	{
+		const unsigned long l_nodeMask = 1ul << m_settings.numaNode;
+
+		if (syscall(SYS_mbind, p_memory, p_size, MPOL_BIND_MODE, &l_nodeMask, NUMA_NODE_MASK_BITS, 0u) == 0)
+		{
+			return;
+		}
+	}
+
+	m_stats.nrOfFailedNumaBindings++;
+#elif !defined(_WIN32)
+	m_stats.nrOfFailedNumaBindings++;
+#endif
+	//on Windows node is already passed to VirtualAllocExNuma
+}
+
+void PageBackedMemoryResource::registerAllocation(PageBacking p_backing)
+{
+	m_lastBacking = p_backing;
+
+	switch (p_backing)
+	{
+	case PageBacking::EXPLICIT_HUGE_PAGES:
+		m_stats.nrOfExplicitHugePageAllocations++;
+		break;
+	case PageBacking::TRANSPARENT_HUGE_PAGES:
+		m_stats.nrOfTransparentHugePageAllocations++;
+		break;
+	default:
+		m_stats.nrOfStandardPageAllocations++;
+		break;
+	}
+}
+
+}
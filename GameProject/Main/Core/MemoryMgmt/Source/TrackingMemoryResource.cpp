@@ -0,0 +1,59 @@
+#include "TrackingMemoryResource.h"
+
+namespace engine
+{
+
+TrackingMemoryResource::TrackingMemoryResource(std::pmr::memory_resource& p_upstream)
+	:m_upstream(p_upstream)
+{
+}
+
+MemoryUsageStats TrackingMemoryResource::getStats() const
+{
+	MemoryUsageStats l_stats;
+	l_stats.currentBytes = m_currentBytes.load(std::memory_order_relaxed);
+	l_stats.peakBytes = m_peakBytes.load(std::memory_order_relaxed);
+	l_stats.totalAllocatedBytes = m_totalAllocatedBytes.load(std::memory_order_relaxed);
+	l_stats.nrOfAllocations = m_nrOfAllocations.load(std::memory_order_relaxed);
+	l_stats.nrOfDeallocations = m_nrOfDeallocations.load(std::memory_order_relaxed);
+
+	return l_stats;
+}
+
+std::pmr::memory_resource& TrackingMemoryResource::getUpstream() const
+{
+	return m_upstream;
+}
+
+void* TrackingMemoryResource::do_allocate(std::size_t p_bytes, std::size_t p_alignment)
+{
+	auto l_memory = m_upstream.allocate(p_bytes, p_alignment);
+
+	const auto l_currentBytes = m_currentBytes.fetch_add(p_bytes, std::memory_order_relaxed) + p_bytes;
+	auto l_peakBytes = m_peakBytes.load(std::memory_order_relaxed);
+
+	while (l_currentBytes > l_peakBytes and
+		   not m_peakBytes.compare_exchange_weak(l_peakBytes, l_currentBytes, std::memory_order_relaxed))
+	{
+	}
+
+	m_totalAllocatedBytes.fetch_add(p_bytes, std::memory_order_relaxed);
+	m_nrOfAllocations.fetch_add(1u, std::memory_order_relaxed);
+
+	return l_memory;
+}
+
+void TrackingMemoryResource::do_deallocate(void* p_memory, std::size_t p_bytes, std::size_t p_alignment)
+{
+	m_upstream.deallocate(p_memory, p_bytes, p_alignment);
+
+	m_currentBytes.fetch_sub(p_bytes, std::memory_order_relaxed);
+	m_nrOfDeallocations.fetch_add(1u, std::memory_order_relaxed);
+}
+
+bool TrackingMemoryResource::do_is_equal(const std::pmr::memory_resource& p_other) const noexcept
+{
+	return this == &p_other;
+}
+
+}
@@ -0,0 +1,453 @@
+#include "TransformHierarchy.h"
+#include <atomic>
+#include <cmath>
+#include <thread>
+#include "assert.h"
+
+namespace engine
+{
+
+namespace
+{
+class LevelBarrier
+{
+public:
+	LevelBarrier(u32 p_nrOfThreads)
+		:m_nrOfThreads(p_nrOfThreads)
+	{
+	}
+
+	void arriveAndWait()
+	{
+		const auto l_generation = m_generation.load(std::memory_order_acquire);
+
+		if (m_arrived.fetch_add(1u, std::memory_order_acq_rel) + 1u == m_nrOfThreads)
+		{
+			m_arrived.store(0u, std::memory_order_relaxed);
+			m_generation.fetch_add(1u, std::memory_order_release);
+		}
+		else
+		{
+			while (m_generation.load(std::memory_order_acquire) == l_generation)
+			{
+				std::this_thread::yield();
+			}
+		}
+	}
+
+private:
+	const u32 m_nrOfThreads;
+	std::atomic<u32> m_arrived{0u};
+	std::atomic<u32> m_generation{0u};
+};
+}
+
+TransformHierarchy::TransformHierarchy(PoolSize p_capacity)
+	:m_capacity(p_capacity),
+	 m_scratchIndex(p_capacity),
+	 m_entityIds(p_capacity + 1u, UNDEFINED_ENTITY_ID),
+	 m_links(p_capacity + 1u),
+	 m_parentIndices(p_capacity + 1u, INVALID_INDEX),
+	 m_depths(p_capacity + 1u, 0u),
+	 m_locals(p_capacity + 1u),
+	 m_worlds(p_capacity + 1u),
+	 m_worldCos(p_capacity + 1u, 1.0f),
+	 m_worldSin(p_capacity + 1u, 0.0f),
+	 m_sparseIndices(p_capacity + 1u, INVALID_INDEX)
+{
+	m_subtree.reserve(p_capacity);
+}
+
+bool TransformHierarchy::add(EntityId p_id, const Transform2D& p_local)
+{
+	if (not isIdInRange(p_id) or has(p_id) or m_size == m_capacity)
+	{
+		return false;
+	}
+
+	const auto l_index = insertSlot(0u);
+
+	m_entityIds[l_index] = p_id;
+	m_links[l_index] = HierarchyComponent();
+	m_parentIndices[l_index] = INVALID_INDEX;
+	m_depths[l_index] = 0u;
+	m_locals[l_index] = p_local;
+	m_worlds[l_index] = p_local;
+	m_worldCos[l_index] = std::cos(p_local.rotation);
+	m_worldSin[l_index] = std::sin(p_local.rotation);
+	m_sparseIndices[p_id] = l_index;
+
+	return true;
+}
+
+bool TransformHierarchy::remove(EntityId p_id)
+{
+	if (not has(p_id))
+	{
+		return false;
+	}
+
+	while (m_links[m_sparseIndices[p_id]].firstChild != UNDEFINED_ENTITY_ID)
+	{
+		setParent(m_links[m_sparseIndices[p_id]].firstChild, UNDEFINED_ENTITY_ID);
+	}
+
+	unlinkFromParent(p_id);
+
+	const auto l_index = m_sparseIndices[p_id];
+	removeSlot(l_index, m_depths[l_index]);
+	m_sparseIndices[p_id] = INVALID_INDEX;
+
+	return true;
+}
+
+bool TransformHierarchy::has(EntityId p_id) const
+{
+	return isIdInRange(p_id) and m_sparseIndices[p_id] != INVALID_INDEX;
+}
+
+bool TransformHierarchy::isIdInRange(EntityId p_id) const
+{
+	return p_id != UNDEFINED_ENTITY_ID and p_id <= m_capacity;
+}
+
+bool TransformHierarchy::setParent(EntityId p_child, EntityId p_parent)
+{
+	if (not has(p_child))
+	{
+		return false;
+	}
+
+	const auto l_detach = p_parent == UNDEFINED_ENTITY_ID;
+
+	if (not l_detach and (not has(p_parent) or p_parent == p_child or isDescendant(p_parent, p_child)))
+	{
+		return false;
+	}
+
+	if (getParent(p_child) == p_parent)
+	{
+		return true;
+	}
+
+	unlinkFromParent(p_child);
+
+	if (not l_detach)
+	{
+		auto& l_parentLinks = m_links[m_sparseIndices[p_parent]];
+		auto& l_childLinks = m_links[m_sparseIndices[p_child]];
+
+		l_childLinks.parent = p_parent;
+		l_childLinks.nextSibling = l_parentLinks.firstChild;
+		l_parentLinks.firstChild = p_child;
+	}
+
+	const auto l_newDepth = l_detach ? 0u : m_depths[m_sparseIndices[p_parent]] + 1u;
+
+	if (l_newDepth != m_depths[m_sparseIndices[p_child]])
+	{
+		changeDepth(p_child, l_newDepth);
+	}
+
+	m_parentIndices[m_sparseIndices[p_child]] = l_detach ? INVALID_INDEX : m_sparseIndices[p_parent];
+	return true;
+}
+
+bool TransformHierarchy::isDescendant(EntityId p_id, EntityId p_ancestor) const
+{
+	for (auto l_parent = getParent(p_id); l_parent != UNDEFINED_ENTITY_ID; l_parent = getParent(l_parent))
+	{
+		if (l_parent == p_ancestor)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void TransformHierarchy::unlinkFromParent(EntityId p_id)
+{
+	auto& l_links = m_links[m_sparseIndices[p_id]];
+
+	if (l_links.parent == UNDEFINED_ENTITY_ID)
+	{
+		return;
+	}
+
+	auto& l_parentLinks = m_links[m_sparseIndices[l_links.parent]];
+
+	if (l_parentLinks.firstChild == p_id)
+	{
+		l_parentLinks.firstChild = l_links.nextSibling;
+	}
+	else
+	{
+		auto l_sibling = l_parentLinks.firstChild;
+
+		while (m_links[m_sparseIndices[l_sibling]].nextSibling != p_id)
+		{
+			l_sibling = m_links[m_sparseIndices[l_sibling]].nextSibling;
+		}
+
+		m_links[m_sparseIndices[l_sibling]].nextSibling = l_links.nextSibling;
+	}
+
+	l_links.parent = UNDEFINED_ENTITY_ID;
+	l_links.nextSibling = UNDEFINED_ENTITY_ID;
+	m_parentIndices[m_sparseIndices[p_id]] = INVALID_INDEX;
+}
+
+/*
+	Whole subtree is shifted by the same number of levels. Nodes are collected breadth first
+	and relocated one by one - cost depends on size of subtree and number of levels,
+	never on number of nodes in hierarchy.
+*/
+
+void TransformHierarchy::changeDepth(EntityId p_root, u32 p_newDepth)
+{
+	m_subtree.clear();
+	m_subtree.push_back(p_root);
+
+	for (auto i = 0u; i < m_subtree.size(); i++)
+	{
+		auto l_child = m_links[m_sparseIndices[m_subtree[i]]].firstChild;
+
+		while (l_child != UNDEFINED_ENTITY_ID)
+		{
+			m_subtree.push_back(l_child);
+			l_child = m_links[m_sparseIndices[l_child]].nextSibling;
+		}
+	}
+
+	const auto l_oldDepth = m_depths[m_sparseIndices[p_root]];
+
+	for (auto l_id : m_subtree)
+	{
+		const auto l_index = m_sparseIndices[l_id];
+		relocate(l_index, m_depths[l_index] - l_oldDepth + p_newDepth);
+	}
+}
+
+void TransformHierarchy::relocate(u32 p_index, u32 p_newDepth)
+{
+	const auto l_oldDepth = m_depths[p_index];
+
+	moveElement(p_index, m_scratchIndex);
+	removeSlot(p_index, l_oldDepth);
+
+	const auto l_newIndex = insertSlot(p_newDepth);
+	moveElement(m_scratchIndex, l_newIndex);
+	m_depths[l_newIndex] = p_newDepth;
+}
+
+u32 TransformHierarchy::levelBegin(u32 p_level) const
+{
+	return p_level == 0u ? 0u : m_levelEnds[p_level - 1u];
+}
+
+/*
+	Makes free slot at the end of p_level: first element of every deeper level
+	is moved to the end of its own level, which opens gap one level higher.
+*/
+
+u32 TransformHierarchy::insertSlot(u32 p_level)
+{
+	assert(m_size < m_capacity);
+
+	while (m_levelEnds.size() <= p_level)
+	{
+		m_levelEnds.push_back(m_size);
+	}
+
+	auto l_free = m_size++;
+
+	for (auto l_level = static_cast<u32>(m_levelEnds.size()) - 1u; l_level > p_level; l_level--)
+	{
+		const auto l_first = levelBegin(l_level);
+
+		if (l_first != l_free)
+		{
+			moveElement(l_first, l_free);
+		}
+
+		m_levelEnds[l_level]++;
+		l_free = l_first;
+	}
+
+	m_levelEnds[p_level]++;
+	return l_free;
+}
+
+//inverse of insertSlot - gap is filled with last element of every level down to the end of storage
+void TransformHierarchy::removeSlot(u32 p_index, u32 p_level)
+{
+	auto l_hole = p_index;
+
+	for (auto l_level = p_level; l_level < m_levelEnds.size(); l_level++)
+	{
+		const auto l_last = m_levelEnds[l_level] - 1u;
+
+		if (l_last != l_hole)
+		{
+			moveElement(l_last, l_hole);
+		}
+
+		m_levelEnds[l_level]--;
+		l_hole = l_last;
+	}
+
+	m_entityIds[--m_size] = UNDEFINED_ENTITY_ID;
+
+	while (not m_levelEnds.empty() and m_levelEnds.back() == levelBegin(static_cast<u32>(m_levelEnds.size()) - 1u))
+	{
+		m_levelEnds.pop_back();
+	}
+}
+
+void TransformHierarchy::moveElement(u32 p_from, u32 p_to)
+{
+	m_links[p_to] = m_links[p_from];
+	m_parentIndices[p_to] = m_parentIndices[p_from];
+	m_depths[p_to] = m_depths[p_from];
+	m_locals[p_to] = m_locals[p_from];
+	m_worlds[p_to] = m_worlds[p_from];
+	m_worldCos[p_to] = m_worldCos[p_from];
+	m_worldSin[p_to] = m_worldSin[p_from];
+
+	const auto l_movedId = m_entityIds[p_from];
+	m_entityIds[p_to] = l_movedId;
+	m_sparseIndices[l_movedId] = p_to;
+
+	updateChildrenParentIndex(p_to);
+}
+
+void TransformHierarchy::updateChildrenParentIndex(u32 p_index)
+{
+	for (auto l_child = m_links[p_index].firstChild; l_child != UNDEFINED_ENTITY_ID;)
+	{
+		const auto l_childIndex = m_sparseIndices[l_child];
+
+		m_parentIndices[l_childIndex] = p_index;
+		l_child = m_links[l_childIndex].nextSibling;
+	}
+}
+
+EntityId TransformHierarchy::getParent(EntityId p_id) const
+{
+	return has(p_id) ? m_links[m_sparseIndices[p_id]].parent : UNDEFINED_ENTITY_ID;
+}
+
+const HierarchyComponent& TransformHierarchy::getLinks(EntityId p_id) const
+{
+	assert(has(p_id));
+	return m_links[m_sparseIndices[p_id]];
+}
+
+u32 TransformHierarchy::getDepth(EntityId p_id) const
+{
+	assert(has(p_id));
+	return m_depths[m_sparseIndices[p_id]];
+}
+
+void TransformHierarchy::setLocal(EntityId p_id, const Transform2D& p_local)
+{
+	m_locals[m_sparseIndices[p_id]] = p_local;
+}
+
+const Transform2D& TransformHierarchy::getLocal(EntityId p_id) const
+{
+	return m_locals[m_sparseIndices[p_id]];
+}
+
+const Transform2D& TransformHierarchy::getWorld(EntityId p_id) const
+{
+	return m_worlds[m_sparseIndices[p_id]];
+}
+
+u32 TransformHierarchy::size() const
+{
+	return m_size;
+}
+
+u32 TransformHierarchy::getNrOfLevels() const
+{
+	return static_cast<u32>(m_levelEnds.size());
+}
+
+u32 TransformHierarchy::getIndex(EntityId p_id) const
+{
+	return isIdInRange(p_id) ? m_sparseIndices[p_id] : INVALID_INDEX;
+}
+
+EntityId TransformHierarchy::getEntityId(u32 p_index) const
+{
+	return p_index < m_size ? m_entityIds[p_index] : UNDEFINED_ENTITY_ID;
+}
+
+void TransformHierarchy::propagate()
+{
+	propagateRange(0u, m_size);
+}
+
+void TransformHierarchy::propagateParallel(ITaskExecutor& p_executor)
+{
+	const auto l_nrOfThreads = p_executor.getNrOfThreads();
+
+	if (l_nrOfThreads <= 1u)
+	{
+		propagate();
+		return;
+	}
+
+	LevelBarrier l_barrier(l_nrOfThreads);
+
+	p_executor.run(l_nrOfThreads, [this, &l_barrier, l_nrOfThreads](u32 p_thread)
+	{
+		const auto l_nrOfLevels = getNrOfLevels();
+
+		for (auto l_level = 0u; l_level < l_nrOfLevels; l_level++)
+		{
+			const auto l_begin = levelBegin(l_level);
+			const auto l_length = m_levelEnds[l_level] - l_begin;
+
+			propagateRange(l_begin + static_cast<u32>(static_cast<u64>(l_length) * p_thread / l_nrOfThreads),
+						   l_begin + static_cast<u32>(static_cast<u64>(l_length) * (p_thread + 1u) / l_nrOfThreads));
+
+			if (l_level + 1u < l_nrOfLevels)
+			{
+				l_barrier.arriveAndWait();
+			}
+		}
+	});
+}
+
+void TransformHierarchy::propagateRange(u32 p_begin, u32 p_end)
+{
+	for (auto i = p_begin; i < p_end; i++)
+	{
+		const auto& l_local = m_locals[i];
+		const auto l_parentIndex = m_parentIndices[i];
+		auto& l_world = m_worlds[i];
+
+		if (l_parentIndex == INVALID_INDEX)
+		{
+			l_world = l_local;
+		}
+		else
+		{
+			const auto& l_parent = m_worlds[l_parentIndex];
+			const auto l_cos = m_worldCos[l_parentIndex];
+			const auto l_sin = m_worldSin[l_parentIndex];
+
+			l_world.x = l_parent.x + l_cos * l_local.x - l_sin * l_local.y;
+			l_world.y = l_parent.y + l_sin * l_local.x + l_cos * l_local.y;
+			l_world.rotation = l_parent.rotation + l_local.rotation;
+		}
+
+		m_worldCos[i] = std::cos(l_world.rotation);
+		m_worldSin[i] = std::sin(l_world.rotation);
+	}
+}
+
+}
@@ -0,0 +1,210 @@
+#include "TransformStore.h"
+
+namespace engine
+{
+
+TransformStore::TransformStore(PoolSize p_capacity)
+	:m_capacity(p_capacity),
+	 m_positionsX(p_capacity),
+	 m_positionsY(p_capacity),
+	 m_velocitiesX(p_capacity),
+	 m_velocitiesY(p_capacity),
+	 m_entityIds(p_capacity, UNDEFINED_ENTITY_ID),
+	 m_sparseIndices(p_capacity + 1u, INVALID_INDEX)
+{
+}
+
+bool TransformStore::add(EntityId p_id, f32 p_positionX, f32 p_positionY, f32 p_velocityX, f32 p_velocityY)
+{
+	if (not isIdInRange(p_id) or has(p_id) or m_size == m_capacity)
+	{
+		return false;
+	}
+
+	const auto l_index = m_size++;
+
+	m_positionsX[l_index] = p_positionX;
+	m_positionsY[l_index] = p_positionY;
+	m_velocitiesX[l_index] = p_velocityX;
+	m_velocitiesY[l_index] = p_velocityY;
+
+	m_entityIds[l_index] = p_id;
+	m_sparseIndices[p_id] = l_index;
+
+	return true;
+}
+
+bool TransformStore::remove(EntityId p_id)
+{
+	if (not has(p_id))
+	{
+		return false;
+	}
+
+	const auto l_removedIndex = m_sparseIndices[p_id];
+	const auto l_lastIndex = --m_size;
+
+	if (l_removedIndex != l_lastIndex)
+	{
+		moveElement(l_lastIndex, l_removedIndex);
+	}
+
+	m_entityIds[l_lastIndex] = UNDEFINED_ENTITY_ID;
+	m_sparseIndices[p_id] = INVALID_INDEX;
+
+	return true;
+}
+
+void TransformStore::moveElement(u32 p_from, u32 p_to)
+{
+	m_positionsX[p_to] = m_positionsX[p_from];
+	m_positionsY[p_to] = m_positionsY[p_from];
+	m_velocitiesX[p_to] = m_velocitiesX[p_from];
+	m_velocitiesY[p_to] = m_velocitiesY[p_from];
+
+	const auto l_movedId = m_entityIds[p_from];
+	m_entityIds[p_to] = l_movedId;
+	m_sparseIndices[l_movedId] = p_to;
+}
+
+bool TransformStore::has(EntityId p_id) const
+{
+	return isIdInRange(p_id) and m_sparseIndices[p_id] != INVALID_INDEX;
+}
+
+bool TransformStore::isIdInRange(EntityId p_id) const
+{
+	return p_id != UNDEFINED_ENTITY_ID and p_id <= m_capacity;
+}
+
+void TransformStore::clear()
+{
+	for (auto i = 0u; i < m_size; i++)
+	{
+		m_sparseIndices[m_entityIds[i]] = INVALID_INDEX;
+		m_entityIds[i] = UNDEFINED_ENTITY_ID;
+	}
+
+	m_size = 0u;
+}
+
+u32 TransformStore::size() const
+{
+	return m_size;
+}
+
+PoolSize TransformStore::capacity() const
+{
+	return m_capacity;
+}
+
+u32 TransformStore::getIndex(EntityId p_id) const
+{
+	return isIdInRange(p_id) ? m_sparseIndices[p_id] : INVALID_INDEX;
+}
+
+EntityId TransformStore::getEntityId(u32 p_index) const
+{
+	return p_index < m_size ? m_entityIds[p_index] : UNDEFINED_ENTITY_ID;
+}
+
+void TransformStore::setPosition(EntityId p_id, f32 p_x, f32 p_y)
+{
+	const auto l_index = m_sparseIndices[p_id];
+	m_positionsX[l_index] = p_x;
+	m_positionsY[l_index] = p_y;
+}
+
+void TransformStore::setVelocity(EntityId p_id, f32 p_x, f32 p_y)
+{
+	const auto l_index = m_sparseIndices[p_id];
+	m_velocitiesX[l_index] = p_x;
+	m_velocitiesY[l_index] = p_y;
+}
+
+f32* TransformStore::positionsX()
+{
+	return m_positionsX.data();
+}
+
+f32* TransformStore::positionsY()
+{
+	return m_positionsY.data();
+}
+
+f32* TransformStore::velocitiesX()
+{
+	return m_velocitiesX.data();
+}
+
+f32* TransformStore::velocitiesY()
+{
+	return m_velocitiesY.data();
+}
+
+const f32* TransformStore::positionsX() const
+{
+	return m_positionsX.data();
+}
+
+const f32* TransformStore::positionsY() const
+{
+	return m_positionsY.data();
+}
+
+const f32* TransformStore::velocitiesX() const
+{
+	return m_velocitiesX.data();
+}
+
+const f32* TransformStore::velocitiesY() const
+{
+	return m_velocitiesY.data();
+}
+
+const EntityId* TransformStore::entityIds() const
+{
+	return m_entityIds.data();
+}
+
+/*
+	Used when element arrays were filled in bulk (e.g. from a snapshot):
+	sets dense ids for first p_size elements and rebuilds sparse index.
+*/
+
+bool TransformStore::restoreEntityIds(const EntityId* p_ids, u32 p_size)
+{
+	clear();
+
+	if (p_size > m_capacity)
+	{
+		return false;
+	}
+
+	for (auto i = 0u; i < p_size; i++)
+	{
+		if (not isIdInRange(p_ids[i]) or has(p_ids[i]))
+		{
+			clear();
+			return false;
+		}
+
+		m_entityIds[i] = p_ids[i];
+		m_sparseIndices[p_ids[i]] = i;
+		m_size = i + 1u;
+	}
+
+	return true;
+}
+
+void TransformStore::integrate(f32 p_deltaTime)
+{
+	integrate(p_deltaTime, kernels::getBestIntegrationKernel());
+}
+
+void TransformStore::integrate(f32 p_deltaTime, IntegrationKernel p_kernel)
+{
+	p_kernel(m_positionsX.data(), m_positionsY.data(), m_velocitiesX.data(), m_velocitiesY.data(), m_size, p_deltaTime);
+}
+
+}
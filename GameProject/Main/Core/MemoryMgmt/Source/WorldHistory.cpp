@@ -0,0 +1,73 @@
+#include "WorldHistory.h"
+
+namespace engine
+{
+
+WorldHistory::WorldHistory(EntityPool& p_entityPool, u32 p_nrOfFrames)
+	:m_entityPool(p_entityPool),
+	 m_snapshotter(p_nrOfFrames),
+	 m_freedIds(p_entityPool.getEntities().maxSize(), UNDEFINED_ID)
+{
+	m_snapshotter.registerPool(m_entityPool.getEntities());
+
+	//registered after entity pool, so its size is already restored when stored ids are rebuilt
+	m_snapshotter.registerRegion(&m_idGuardState, sizeof(m_idGuardState), [this]() { saveIdGuardState(); });
+	m_snapshotter.registerRegion(m_freedIds.data(), m_freedIds.size() * sizeof(Id), DeltaSnapshotter::Hook(),
+		[this]() { restoreEntityPoolState(); });
+}
+
+void WorldHistory::registerTransformStore(TransformStore& p_store)
+{
+	m_snapshotter.registerTransformStore(p_store);
+}
+
+void WorldHistory::saveFrame()
+{
+	if (m_hasBaseline)
+	{
+		m_snapshotter.captureDelta();
+	}
+	else
+	{
+		m_snapshotter.captureBaseline();
+		m_hasBaseline = true;
+	}
+}
+
+/*
+	p_framesAgo == 0 brings back last saved frame (drops changes made after it).
+	Restored frames are removed from history - frames saved afterwards replace them.
+*/
+
+bool WorldHistory::restoreFrame(u32 p_framesAgo)
+{
+	if (not m_hasBaseline)
+	{
+		return false;
+	}
+
+	return m_snapshotter.rewind(p_framesAgo);
+}
+
+u32 WorldHistory::getNumOfStoredFrames() const
+{
+	return m_hasBaseline ? m_snapshotter.getNumOfStoredDeltas() + 1u : 0u;
+}
+
+u32 WorldHistory::getCurrentFrame() const
+{
+	return m_snapshotter.getFrame();
+}
+
+void WorldHistory::saveIdGuardState()
+{
+	m_idGuardState = m_entityPool.getIdGuard().saveState(m_freedIds.data(), static_cast<u32>(m_freedIds.size()));
+}
+
+void WorldHistory::restoreEntityPoolState()
+{
+	m_entityPool.getIdGuard().restoreState(m_idGuardState, m_freedIds.data());
+	m_entityPool.rebuildStoredIds();
+}
+
+}
@@ -0,0 +1,559 @@
+#include "WorldSnapshot.h"
+#include <algorithm>
+#include <type_traits>
+
+namespace engine
+{
+
+namespace
+{
+	constexpr u32 ENTITIES_PER_CHUNK = 4096u;
+	constexpr u32 TRANSFORM_ELEMENT_SIZE = 4u * sizeof(f32) + sizeof(EntityId);
+
+	template<typename Type>
+	void writeRaw(std::ostream& p_stream, const Type* p_data, std::size_t p_count)
+	{
+		p_stream.write(reinterpret_cast<const char*>(p_data), static_cast<std::streamsize>(p_count * sizeof(Type)));
+	}
+
+	template<typename Type>
+	bool readRaw(std::istream& p_stream, Type* p_data, std::size_t p_count)
+	{
+		p_stream.read(reinterpret_cast<char*>(p_data), static_cast<std::streamsize>(p_count * sizeof(Type)));
+		return static_cast<bool>(p_stream);
+	}
+
+	std::size_t getBlockDataSize(const snapshot::BlockHeader& p_header)
+	{
+		return static_cast<std::size_t>(p_header.count) * p_header.elementSize;
+	}
+
+	std::size_t getBlockReservedSize(const snapshot::BlockHeader& p_header)
+	{
+		return static_cast<std::size_t>(p_header.capacity) * p_header.elementSize;
+	}
+
+	std::size_t getPadding(std::size_t p_size)
+	{
+		return (snapshot::BLOCK_ALIGNMENT - p_size % snapshot::BLOCK_ALIGNMENT) % snapshot::BLOCK_ALIGNMENT;
+	}
+
+	//bytes between stored elements and next block: spare capacity and alignment padding
+	std::size_t getBlockTailSize(const snapshot::BlockHeader& p_header)
+	{
+		const auto l_reservedSize = getBlockReservedSize(p_header);
+		return l_reservedSize - getBlockDataSize(p_header) + getPadding(l_reservedSize);
+	}
+
+	void writeBlockTail(std::ostream& p_stream, const snapshot::BlockHeader& p_header)
+	{
+		static const char s_zeros[4096] = {};
+
+		for (auto l_left = getBlockTailSize(p_header); l_left > 0u;)
+		{
+			const auto l_size = std::min(l_left, sizeof(s_zeros));
+			p_stream.write(s_zeros, static_cast<std::streamsize>(l_size));
+			l_left -= l_size;
+		}
+	}
+
+	bool isBlockHeaderValid(const snapshot::BlockHeader& p_header)
+	{
+		return p_header.version == snapshot::VERSION and p_header.count <= p_header.capacity;
+	}
+
+	bool isBlockCompatible(const snapshot::BlockHeader& p_header, u32 p_elementSize, PoolSize p_capacity)
+	{
+		return p_header.elementSize == p_elementSize and p_header.count <= p_capacity;
+	}
+
+	snapshot::BlockHeader createBlockHeader(u32 p_typeId, u32 p_elementSize, u32 p_count, u32 p_capacity)
+	{
+		snapshot::BlockHeader l_header;
+		l_header.typeId = p_typeId;
+		l_header.elementSize = p_elementSize;
+		l_header.count = p_count;
+		l_header.capacity = p_capacity;
+
+		return l_header;
+	}
+}
+
+WorldSnapshot::WorldSnapshot(EntityPool& p_entityPool, TransformStore& p_transforms)
+	:m_entityPool(p_entityPool),
+	 m_entities(p_entityPool.getEntities()),
+	 m_transforms(p_transforms),
+	 m_idGuardData(snapshot::ID_GUARD_STATE_SIZE + m_entities.maxSize(), UNDEFINED_ID)
+{
+}
+
+bool WorldSnapshot::save(std::ostream& p_stream) const
+{
+	snapshot::FileHeader l_header;
+	l_header.nrOfBlocks = static_cast<u32>(m_componentBlocks.size()) + 3u;
+	writeRaw(p_stream, &l_header, 1u);
+
+	writeEntities(p_stream);
+
+	for (const auto& l_block : m_componentBlocks)
+	{
+		writeComponents(p_stream, *l_block);
+	}
+
+	writeTransforms(p_stream);
+	writeIdGuard(p_stream);
+
+	return static_cast<bool>(p_stream);
+}
+
+void WorldSnapshot::writeEntities(std::ostream& p_stream) const
+{
+	const auto l_count = m_entities.size();
+	const auto l_header = createBlockHeader(snapshot::ENTITY_BLOCK, sizeof(Entity), l_count, m_entities.maxSize());
+	writeRaw(p_stream, &l_header, 1u);
+
+	std::vector<Entity> l_chunk(std::min(l_count, ENTITIES_PER_CHUNK));
+	const auto l_entities = m_entities.data();
+
+	for (auto l_begin = 0u; l_begin < l_count; l_begin += ENTITIES_PER_CHUNK)
+	{
+		const auto l_chunkSize = std::min(ENTITIES_PER_CHUNK, l_count - l_begin);
+
+		for (auto i = 0u; i < l_chunkSize; i++)
+		{
+			l_chunk[i] = l_entities[l_begin + i];
+			l_chunk[i].components = reinterpret_cast<ComponentPtr>(encode(l_chunk[i].components));
+		}
+
+		writeRaw(p_stream, l_chunk.data(), l_chunkSize);
+	}
+
+	writeBlockTail(p_stream, l_header);
+}
+
+void WorldSnapshot::writeComponents(std::ostream& p_stream, const IComponentBlock& p_block) const
+{
+	const auto l_count = p_block.size();
+	const auto l_elementSize = p_block.getElementSize();
+	const auto l_header = createBlockHeader(p_block.getTypeId(), l_elementSize, l_count, p_block.maxSize());
+	writeRaw(p_stream, &l_header, 1u);
+
+	if (l_count == 0u)
+	{
+		writeBlockTail(p_stream, l_header);
+		return;
+	}
+
+	const auto l_nextOffset = reinterpret_cast<const u8*>(&p_block.getComponent(0u).nextComponent) - p_block.data();
+	const auto l_elementsPerChunk = std::max(1u, ENTITIES_PER_CHUNK * static_cast<u32>(sizeof(Entity)) / l_elementSize);
+	std::vector<u8> l_chunk(static_cast<std::size_t>(std::min(l_count, l_elementsPerChunk)) * l_elementSize);
+
+	for (auto l_begin = 0u; l_begin < l_count; l_begin += l_elementsPerChunk)
+	{
+		const auto l_chunkSize = std::min(l_elementsPerChunk, l_count - l_begin);
+		std::memcpy(l_chunk.data(), p_block.data() + static_cast<std::size_t>(l_begin) * l_elementSize, l_chunkSize * l_elementSize);
+
+		for (auto i = 0u; i < l_chunkSize; i++)
+		{
+			const auto l_encoded = encode(p_block.getComponent(l_begin + i).nextComponent);
+			std::memcpy(l_chunk.data() + i * l_elementSize + l_nextOffset, &l_encoded, sizeof(l_encoded));
+		}
+
+		writeRaw(p_stream, l_chunk.data(), static_cast<std::size_t>(l_chunkSize) * l_elementSize);
+	}
+
+	writeBlockTail(p_stream, l_header);
+}
+
+void WorldSnapshot::writeTransforms(std::ostream& p_stream) const
+{
+	const auto l_count = m_transforms.size();
+	const auto l_header = createBlockHeader(snapshot::TRANSFORM_BLOCK, TRANSFORM_ELEMENT_SIZE, l_count, l_count);
+	writeRaw(p_stream, &l_header, 1u);
+
+	const TransformStore& l_transforms = m_transforms;
+	writeRaw(p_stream, l_transforms.entityIds(), l_count);
+	writeRaw(p_stream, l_transforms.positionsX(), l_count);
+	writeRaw(p_stream, l_transforms.positionsY(), l_count);
+	writeRaw(p_stream, l_transforms.velocitiesX(), l_count);
+	writeRaw(p_stream, l_transforms.velocitiesY(), l_count);
+	writeBlockTail(p_stream, l_header);
+}
+
+void WorldSnapshot::writeIdGuard(std::ostream& p_stream) const
+{
+	const auto l_freedIds = m_idGuardData.data() + snapshot::ID_GUARD_STATE_SIZE;
+	const auto l_capacity = static_cast<u32>(m_idGuardData.size()) - snapshot::ID_GUARD_STATE_SIZE;
+	const auto l_state = m_entityPool.getIdGuard().saveState(l_freedIds, l_capacity);
+	std::memcpy(m_idGuardData.data(), &l_state, sizeof(l_state));
+
+	const auto l_count = snapshot::ID_GUARD_STATE_SIZE + l_state.nrOfFreedIds;
+	const auto l_header = createBlockHeader(snapshot::ID_GUARD_BLOCK, sizeof(Id), l_count, l_count);
+	writeRaw(p_stream, &l_header, 1u);
+	writeRaw(p_stream, m_idGuardData.data(), l_header.count);
+	writeBlockTail(p_stream, l_header);
+}
+
+bool WorldSnapshot::load(std::istream& p_stream)
+{
+	snapshot::FileHeader l_header;
+
+	if (not readRaw(p_stream, &l_header, 1u) or l_header.magic != snapshot::MAGIC or l_header.version != snapshot::VERSION)
+	{
+		return false;
+	}
+
+	std::vector<LoadedBlock> l_loadedBlocks;
+	u32 l_nextComponentIndex = 0u;
+
+	for (auto i = 0u; i < l_header.nrOfBlocks; i++)
+	{
+		snapshot::BlockHeader l_blockHeader;
+
+		if (not readRaw(p_stream, &l_blockHeader, 1u) or not isBlockHeaderValid(l_blockHeader))
+		{
+			return false;
+		}
+
+		bool l_isRead = false;
+
+		if (l_blockHeader.typeId == snapshot::ENTITY_BLOCK)
+		{
+			l_isRead = readEntities(p_stream, l_blockHeader);
+		}
+		else if (l_blockHeader.typeId == snapshot::TRANSFORM_BLOCK)
+		{
+			l_isRead = readTransforms(p_stream, l_blockHeader);
+		}
+		else if (l_blockHeader.typeId == snapshot::ID_GUARD_BLOCK)
+		{
+			l_isRead = readIdGuard(p_stream, l_blockHeader);
+		}
+		else
+		{
+			//unknown component types still take their range of indices
+			auto l_block = findComponentBlock(l_blockHeader.typeId);
+			l_isRead = l_block ? readComponents(p_stream, l_blockHeader, *l_block) : skipBlock(p_stream, l_blockHeader);
+
+			l_loadedBlocks.push_back({ l_block, l_nextComponentIndex, l_blockHeader.count });
+			l_nextComponentIndex += l_blockHeader.count;
+		}
+
+		if (not l_isRead or not p_stream.ignore(static_cast<std::streamsize>(getBlockTailSize(l_blockHeader))))
+		{
+			return false;
+		}
+	}
+
+	relinkComponents(l_loadedBlocks);
+	m_entityPool.rebuildStoredIds();
+
+	return true;
+}
+
+bool WorldSnapshot::map(MappedFile& p_file)
+{
+	auto l_position = p_file.data();
+	const auto l_end = p_file.data() + p_file.size();
+
+	snapshot::FileHeader l_header;
+
+	if (not p_file.isOpen() or p_file.size() < sizeof(l_header))
+	{
+		return false;
+	}
+
+	std::memcpy(&l_header, l_position, sizeof(l_header));
+	l_position += sizeof(l_header);
+
+	if (l_header.magic != snapshot::MAGIC or l_header.version != snapshot::VERSION)
+	{
+		return false;
+	}
+
+	std::vector<LoadedBlock> l_loadedBlocks;
+	u32 l_nextComponentIndex = 0u;
+
+	for (auto i = 0u; i < l_header.nrOfBlocks; i++)
+	{
+		snapshot::BlockHeader l_blockHeader;
+
+		if (static_cast<std::size_t>(l_end - l_position) < sizeof(l_blockHeader))
+		{
+			return false;
+		}
+
+		std::memcpy(&l_blockHeader, l_position, sizeof(l_blockHeader));
+		l_position += sizeof(l_blockHeader);
+
+		const auto l_reservedSize = getBlockReservedSize(l_blockHeader);
+
+		if (not isBlockHeaderValid(l_blockHeader) or static_cast<std::size_t>(l_end - l_position) < l_reservedSize)
+		{
+			return false;
+		}
+
+		bool l_isMapped = false;
+
+		if (l_blockHeader.typeId == snapshot::ENTITY_BLOCK)
+		{
+			l_isMapped = mapEntities(l_position, l_blockHeader);
+		}
+		else if (l_blockHeader.typeId == snapshot::TRANSFORM_BLOCK)
+		{
+			l_isMapped = copyTransforms(l_position, l_blockHeader);
+		}
+		else if (l_blockHeader.typeId == snapshot::ID_GUARD_BLOCK)
+		{
+			l_isMapped = copyIdGuard(l_position, l_blockHeader);
+		}
+		else
+		{
+			auto l_block = findComponentBlock(l_blockHeader.typeId);
+			l_isMapped = l_block ? mapComponents(l_position, l_blockHeader, *l_block) : true;
+
+			l_loadedBlocks.push_back({ l_block, l_nextComponentIndex, l_blockHeader.count });
+			l_nextComponentIndex += l_blockHeader.count;
+		}
+
+		if (not l_isMapped)
+		{
+			return false;
+		}
+
+		l_position += std::min(l_reservedSize + getPadding(l_reservedSize), static_cast<std::size_t>(l_end - l_position));
+	}
+
+	relinkComponents(l_loadedBlocks);
+	m_entityPool.rebuildStoredIds();
+
+	return true;
+}
+
+bool WorldSnapshot::mapEntities(u8* p_data, const snapshot::BlockHeader& p_header)
+{
+	if (p_header.elementSize != sizeof(Entity))
+	{
+		return false;
+	}
+
+	m_entities.clear();
+	m_entities.useExternalStorage(reinterpret_cast<Entity*>(p_data), p_header.capacity, p_header.count);
+
+	return true;
+}
+
+bool WorldSnapshot::mapComponents(u8* p_data, const snapshot::BlockHeader& p_header, IComponentBlock& p_block)
+{
+	if (p_header.elementSize != p_block.getElementSize())
+	{
+		return false;
+	}
+
+	p_block.useExternalStorage(p_data, p_header.capacity, p_header.count);
+	p_block.restoreTypeInfo();
+
+	return true;
+}
+
+bool WorldSnapshot::copyTransforms(const u8* p_data, const snapshot::BlockHeader& p_header)
+{
+	if (not isBlockCompatible(p_header, TRANSFORM_ELEMENT_SIZE, m_transforms.capacity()))
+	{
+		return false;
+	}
+
+	const auto l_count = p_header.count;
+	std::vector<EntityId> l_ids(l_count);
+
+	std::memcpy(l_ids.data(), p_data, l_count * sizeof(EntityId));
+	p_data += l_count * sizeof(EntityId);
+
+	for (auto l_array : { m_transforms.positionsX(), m_transforms.positionsY(), m_transforms.velocitiesX(), m_transforms.velocitiesY() })
+	{
+		std::memcpy(l_array, p_data, l_count * sizeof(f32));
+		p_data += l_count * sizeof(f32);
+	}
+
+	return m_transforms.restoreEntityIds(l_ids.data(), l_count);
+}
+
+bool WorldSnapshot::readEntities(std::istream& p_stream, const snapshot::BlockHeader& p_header)
+{
+	if (not isBlockCompatible(p_header, sizeof(Entity), m_entities.maxSize()))
+	{
+		return false;
+	}
+
+	m_entities.clear();
+	return readRaw(p_stream, m_entities.getNextBlock(p_header.count), p_header.count);
+}
+
+bool WorldSnapshot::readComponents(std::istream& p_stream, const snapshot::BlockHeader& p_header, IComponentBlock& p_block)
+{
+	if (not isBlockCompatible(p_header, p_block.getElementSize(), p_block.maxSize()))
+	{
+		return false;
+	}
+
+	auto l_memory = p_block.prepareForLoad(p_header.count);
+
+	if (not readRaw(p_stream, l_memory, getBlockDataSize(p_header)))
+	{
+		return false;
+	}
+
+	p_block.restoreTypeInfo();
+	return true;
+}
+
+bool WorldSnapshot::readTransforms(std::istream& p_stream, const snapshot::BlockHeader& p_header)
+{
+	if (not isBlockCompatible(p_header, TRANSFORM_ELEMENT_SIZE, m_transforms.capacity()))
+	{
+		return false;
+	}
+
+	std::vector<EntityId> l_ids(p_header.count);
+
+	return readRaw(p_stream, l_ids.data(), p_header.count) and
+		   readRaw(p_stream, m_transforms.positionsX(), p_header.count) and
+		   readRaw(p_stream, m_transforms.positionsY(), p_header.count) and
+		   readRaw(p_stream, m_transforms.velocitiesX(), p_header.count) and
+		   readRaw(p_stream, m_transforms.velocitiesY(), p_header.count) and
+		   m_transforms.restoreEntityIds(l_ids.data(), p_header.count);
+}
+
+bool WorldSnapshot::readIdGuard(std::istream& p_stream, const snapshot::BlockHeader& p_header)
+{
+	if (not isBlockCompatible(p_header, sizeof(Id), static_cast<PoolSize>(m_idGuardData.size())) or
+		not readRaw(p_stream, m_idGuardData.data(), p_header.count))
+	{
+		return false;
+	}
+
+	return restoreIdGuard(p_header);
+}
+
+bool WorldSnapshot::copyIdGuard(const u8* p_data, const snapshot::BlockHeader& p_header)
+{
+	if (not isBlockCompatible(p_header, sizeof(Id), static_cast<PoolSize>(m_idGuardData.size())))
+	{
+		return false;
+	}
+
+	std::memcpy(m_idGuardData.data(), p_data, getBlockDataSize(p_header));
+	return restoreIdGuard(p_header);
+}
+
+bool WorldSnapshot::restoreIdGuard(const snapshot::BlockHeader& p_header)
+{
+	IdGuardState l_state;
+
+	if (p_header.count < snapshot::ID_GUARD_STATE_SIZE)
+	{
+		return false;
+	}
+
+	//state has default member initializers, so it is not trivial - only trivially copyable
+	static_assert(std::is_trivially_copyable_v<IdGuardState>, "IdGuardState is stored as raw bytes");
+	std::memcpy(static_cast<void*>(&l_state), m_idGuardData.data(), sizeof(l_state));
+
+	if (l_state.nrOfFreedIds != p_header.count - snapshot::ID_GUARD_STATE_SIZE)
+	{
+		return false;
+	}
+
+	m_entityPool.getIdGuard().restoreState(l_state, m_idGuardData.data() + snapshot::ID_GUARD_STATE_SIZE);
+	return true;
+}
+
+bool WorldSnapshot::skipBlock(std::istream& p_stream, const snapshot::BlockHeader& p_header)
+{
+	p_stream.ignore(static_cast<std::streamsize>(getBlockDataSize(p_header)));
+	return static_cast<bool>(p_stream);
+}
+
+WorldSnapshot::IComponentBlock* WorldSnapshot::findComponentBlock(u32 p_typeId)
+{
+	for (auto& l_block : m_componentBlocks)
+	{
+		if (l_block->getTypeId() == p_typeId)
+		{
+			return l_block.get();
+		}
+	}
+
+	return nullptr;
+}
+
+void WorldSnapshot::relinkComponents(const std::vector<LoadedBlock>& p_loadedBlocks)
+{
+	for (auto& l_entity : m_entities)
+	{
+		l_entity.components = decode(reinterpret_cast<snapshot::EncodedPtr>(l_entity.components), p_loadedBlocks);
+	}
+
+	for (const auto& l_loadedBlock : p_loadedBlocks)
+	{
+		if (l_loadedBlock.block == nullptr)
+		{
+			continue;
+		}
+
+		for (auto i = 0u; i < l_loadedBlock.count; i++)
+		{
+			auto& l_component = l_loadedBlock.block->getComponent(i);
+			l_component.nextComponent = decode(reinterpret_cast<snapshot::EncodedPtr>(l_component.nextComponent), p_loadedBlocks);
+		}
+	}
+}
+
+snapshot::EncodedPtr WorldSnapshot::encode(ComponentPtr p_component) const
+{
+	if (p_component == nullptr)
+	{
+		return 0u;
+	}
+
+	const auto l_address = reinterpret_cast<const u8*>(p_component);
+	snapshot::EncodedPtr l_firstIndex = 0u;
+
+	for (const auto& l_block : m_componentBlocks)
+	{
+		const auto l_begin = l_block->data();
+		const auto l_end = l_begin + static_cast<std::size_t>(l_block->size()) * l_block->getElementSize();
+
+		if (l_address >= l_begin and l_address < l_end)
+		{
+			return 1u + l_firstIndex + static_cast<snapshot::EncodedPtr>(l_address - l_begin) / l_block->getElementSize();
+		}
+
+		l_firstIndex += l_block->size();
+	}
+
+	//component from not registered pool - link is dropped
+	return 0u;
+}
+
+ComponentPtr WorldSnapshot::decode(snapshot::EncodedPtr p_encoded, const std::vector<LoadedBlock>& p_loadedBlocks) const
+{
+	if (p_encoded == 0u)
+	{
+		return nullptr;
+	}
+
+	const auto l_index = p_encoded - 1u;
+
+	for (const auto& l_loadedBlock : p_loadedBlocks)
+	{
+		if (l_index >= l_loadedBlock.firstIndex and l_index < l_loadedBlock.firstIndex + l_loadedBlock.count)
+		{
+			return l_loadedBlock.block ? &l_loadedBlock.block->getComponent(static_cast<u32>(l_index - l_loadedBlock.firstIndex)) : nullptr;
+		}
+	}
+
+	return nullptr;
+}
+
+}
@@ -1,4 +1,8 @@
 #include "ComponentController.h"
+#include <algorithm>
+#include <array>
+#include "Profiler.h"
+#include "assert.h"
 
 namespace engine
 {
@@ -11,6 +15,8 @@ ComponentController::ComponentController(std::unique_ptr<IComponentProvider> p_c
 
 bool ComponentController::attachComponent(Entity& p_entity, ComponentType p_componentType)
 {
+	ENGINE_PROFILE_ZONE("ComponentController::attachComponent");
+
 	if (not isComponentAlreadyAttached(p_entity, p_componentType))
 	{
 		attachComponentToEntity(p_entity, p_componentType);
@@ -24,6 +30,8 @@ bool ComponentController::attachComponent(Entity& p_entity, ComponentType p_comp
 
 bool ComponentController::attachMultipleComponents(Entity& p_entity, const ComponentIndicators& p_componentsRequestedToAttach)
 {
+	ENGINE_PROFILE_ZONE("ComponentController::attachMultipleComponents");
+
 	if (auto l_componentsToAttach = getComponentsWhichAreNotAlreadyAttached(p_entity, p_componentsRequestedToAttach); l_componentsToAttach.any())
 	{
 		attachMultipleComponentsToEntity(p_entity, l_componentsToAttach);
@@ -55,7 +63,7 @@ bool ComponentController::hasOnlyOneComponentToProcess(const ComponentIndicators
 
 ComponentType ComponentController::getSingleSetComponent(const ComponentIndicators& p_componentsToAttach) const
 {
-	for (auto i = 0u; i < LAST_VALID_COMPONENT_INDEX; i++)
+	for (auto i = 0u; i <= LAST_VALID_COMPONENT_INDEX; i++)
 	{
 		if (auto l_componentType = convertIndexToComponentType(i); p_componentsToAttach.isSet(l_componentType))
 		{
@@ -75,13 +83,16 @@ void ComponentController::attachRequestedComponentsToEntity(Entity& p_entity, co
 {
 	auto l_positionForNextComponent = getNextFreeComponentPosition(p_entity);
 
-	for (auto i = 0u; i < LAST_VALID_COMPONENT_INDEX; i++)
+	for (auto i = 0u; i <= LAST_VALID_COMPONENT_INDEX; i++)
 	{
 		if (auto l_componentType = convertIndexToComponentType(i); p_componentsToAttach.isSet(l_componentType))
 		{
 			auto& l_newComponent = m_componentProvider->createComponent(l_componentType);
 			attachComponentToPosition(l_newComponent, l_positionForNextComponent);
+
+			const auto l_componentsBefore = p_entity.attachedComponents;
 			p_entity.attachedComponents.flip(l_componentType);
+			notifyAdd(p_entity, l_componentType, l_componentsBefore);
 
 			l_positionForNextComponent = getNextComponentPosition(l_newComponent);
 		}
@@ -99,6 +110,8 @@ ComponentIndicators ComponentController::getComponentsWhichAreNotAlreadyAttached
 
 bool ComponentController::detachComponent(Entity& p_entity, ComponentType p_componentType)
 {
+	ENGINE_PROFILE_ZONE("ComponentController::detachComponent");
+
 	if (isComponentAlreadyAttached(p_entity, p_componentType))
 	{
 		detachComponentFromEntity(p_entity, p_componentType);
@@ -112,6 +125,8 @@ bool ComponentController::detachComponent(Entity& p_entity, ComponentType p_comp
 
 bool ComponentController::detachMultipleComponents(Entity& p_entity, const ComponentIndicators& p_componentsRequestedToDetach)
 {
+	ENGINE_PROFILE_ZONE("ComponentController::detachMultipleComponents");
+
 	if (auto l_componentsToDetach = getComponentsToDetach(p_entity, p_componentsRequestedToDetach); l_componentsToDetach.any())
 	{
 		detachMultipleComponentsFromEntity(p_entity, l_componentsToDetach);
@@ -138,7 +153,7 @@ void ComponentController::detachMultipleComponentsFromEntity(Entity& p_entity, c
 
 void ComponentController::detachRequestedComponentsFromEntity(Entity& p_entity, const ComponentIndicators& p_componentsToDetach)
 {
-	for (auto i = 0u; i < LAST_VALID_COMPONENT_INDEX; i++)
+	for (auto i = 0u; i <= LAST_VALID_COMPONENT_INDEX; i++)
 	{
 		if (auto l_componentType = convertIndexToComponentType(i); p_componentsToDetach.isSet(l_componentType))
 		{
@@ -161,7 +176,10 @@ void ComponentController::attachComponentToEntity(Entity& p_entity, ComponentTyp
 {
 	auto& l_newComponent = m_componentProvider->createComponent(p_componentType);
 	attachToNextFreePosition(p_entity, l_newComponent);
+
+	const auto l_componentsBefore = p_entity.attachedComponents;
 	p_entity.attachedComponents.flip(p_componentType);
+	notifyAdd(p_entity, p_componentType, l_componentsBefore);
 }
 
 void ComponentController::attachToNextFreePosition(Entity& p_entity, ComponentBase& p_newComponent)
@@ -194,6 +212,11 @@ void ComponentController::attachComponentToPosition(ComponentBase& p_componentTo
 
 void ComponentController::detachComponentFromEntity(Entity& p_entity, ComponentType p_componentType)
 {
+	if (m_observers)
+	{
+		m_observers->notifyRemove(p_entity, p_componentType, p_entity.attachedComponents);
+	}
+
 	ComponentPtr* l_ptrToComponentPosition = &p_entity.components;
 
 	while (*l_ptrToComponentPosition != nullptr)
@@ -214,4 +237,92 @@ void ComponentController::detachComponentFromEntity(Entity& p_entity, ComponentT
 	p_entity.attachedComponents.flip(p_componentType);
 }
 
+bool ComponentController::attachPrefab(Entity* p_entities, u32 p_count, const Prefab& p_prefab)
+{
+	ENGINE_PROFILE_ZONE("ComponentController::attachPrefab");
+
+	if (p_count == 0u or p_prefab.getComponents().none())
+	{
+		return false;
+	}
+
+	for (auto l_first = 0u; l_first < p_count; l_first += PREFAB_BATCH_SIZE)
+	{
+		attachPrefabToEntities(p_entities + l_first, std::min(PREFAB_BATCH_SIZE, p_count - l_first), p_prefab);
+	}
+
+	return true;
+}
+
+/*
+	Components of one type are created for whole batch at once and get defaults with single memcpy each.
+	They are linked at the front of the chain, so going from the last type leaves chain in ascending
+	type order - the same as attachMultipleComponents gives.
+*/
+
+void ComponentController::attachPrefabToEntities(Entity* p_entities, u32 p_count, const Prefab& p_prefab)
+{
+	std::array<ComponentBase*, PREFAB_BATCH_SIZE> l_components;
+	const auto& l_componentsToAttach = p_prefab.getComponents();
+
+	for (auto i = LAST_VALID_COMPONENT_INDEX + 1u; i-- > 0u;)
+	{
+		if (auto l_componentType = convertIndexToComponentType(i); l_componentsToAttach.isSet(l_componentType))
+		{
+			m_componentProvider->createComponents(l_componentType, p_count, l_components.data());
+			p_prefab.applyDefaults(l_components.data(), p_count);
+
+			for (auto l_index = 0u; l_index < p_count; l_index++)
+			{
+				auto& l_entity = p_entities[l_index];
+
+				l_components[l_index]->nextComponent = l_entity.components;
+				l_entity.components = l_components[l_index];
+			}
+		}
+	}
+
+	for (auto l_index = 0u; l_index < p_count; l_index++)
+	{
+		assert(p_entities[l_index].attachedComponents.none());
+		p_entities[l_index].attachedComponents = l_componentsToAttach;
+	}
+
+	if (m_observers and not m_observers->empty())
+	{
+		notifyPrefabAttached(p_entities, p_count, l_componentsToAttach);
+	}
+}
+
+//observers see prefab as components attached one by one in ascending type order
+void ComponentController::notifyPrefabAttached(Entity* p_entities, u32 p_count, const ComponentIndicators& p_components)
+{
+	for (auto l_index = 0u; l_index < p_count; l_index++)
+	{
+		ComponentIndicators l_componentsBefore;
+
+		for (auto i = 0u; i <= LAST_VALID_COMPONENT_INDEX; i++)
+		{
+			if (auto l_componentType = convertIndexToComponentType(i); p_components.isSet(l_componentType))
+			{
+				m_observers->notifyAdd(p_entities[l_index], l_componentType, l_componentsBefore);
+				l_componentsBefore.set(l_componentType);
+			}
+		}
+	}
+}
+
+void ComponentController::notifyAdd(Entity& p_entity, ComponentType p_componentType, const ComponentIndicators& p_componentsBefore)
+{
+	if (m_observers)
+	{
+		m_observers->notifyAdd(p_entity, p_componentType, p_componentsBefore);
+	}
+}
+
+void ComponentController::attachObservers(ComponentObservers& p_observers)
+{
+	m_observers = &p_observers;
+}
+
 }
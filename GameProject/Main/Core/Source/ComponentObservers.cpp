@@ -0,0 +1,142 @@
+#include "ComponentObservers.h"
+#include <algorithm>
+#include "assert.h"
+
+namespace engine
+{
+
+ComponentObservers::ComponentObservers(std::pmr::memory_resource& p_memoryResource)
+	:m_subscriptions(&p_memoryResource),
+	 m_observers(&p_memoryResource),
+	 m_table(2u * NR_OF_TYPES * NR_OF_MASKS, &p_memoryResource)
+{
+}
+
+void ComponentObservers::onAdd(ComponentType p_type, IComponentObserver& p_observer, const ComponentIndicators& p_required)
+{
+	subscribe(Subscription{Transition::ADD, p_type, p_required, &p_observer});
+}
+
+void ComponentObservers::onRemove(ComponentType p_type, IComponentObserver& p_observer, const ComponentIndicators& p_required)
+{
+	subscribe(Subscription{Transition::REMOVE, p_type, p_required, &p_observer});
+}
+
+void ComponentObservers::onMatch(const ComponentIndicators& p_mask, IComponentObserver& p_observer)
+{
+	subscribe(Subscription{Transition::MATCH, ComponentType::UndefinedComponent, p_mask, &p_observer});
+}
+
+void ComponentObservers::subscribe(const Subscription& p_subscription)
+{
+	assert(p_subscription.transition == Transition::MATCH or static_cast<u32>(p_subscription.type) < NR_OF_TYPES);
+
+	m_subscriptions.push_back(p_subscription);
+	rebuildTable();
+}
+
+void ComponentObservers::unsubscribe(IComponentObserver& p_observer)
+{
+	m_subscriptions.erase(std::remove_if(m_subscriptions.begin(), m_subscriptions.end(),
+										 [&p_observer](const auto& p_subscription){ return p_subscription.observer == &p_observer; }),
+						  m_subscriptions.end());
+	rebuildTable();
+}
+
+bool ComponentObservers::empty() const
+{
+	return m_subscriptions.empty();
+}
+
+void ComponentObservers::rebuildTable()
+{
+	m_observers.clear();
+
+	for (auto l_isAdd : {true, false})
+	{
+		for (auto l_typeIndex = 0u; l_typeIndex < NR_OF_TYPES; l_typeIndex++)
+		{
+			const auto l_type = static_cast<ComponentType>(l_typeIndex);
+
+			for (auto l_maskNumber = 0u; l_maskNumber < NR_OF_MASKS; l_maskNumber++)
+			{
+				ComponentIndicators l_before;
+
+				for (auto l_bit = 0u; l_bit < NR_OF_TYPES; l_bit++)
+				{
+					l_before.set(static_cast<ComponentType>(l_bit), (l_maskNumber >> l_bit) & 1u);
+				}
+
+				auto& l_range = m_table[getTableIndex(l_isAdd, l_type, l_before)];
+				l_range.begin = static_cast<u32>(m_observers.size());
+
+				for (const auto& l_subscription : m_subscriptions)
+				{
+					if (shouldNotify(l_subscription, l_isAdd, l_type, l_before))
+					{
+						m_observers.push_back(l_subscription.observer);
+					}
+				}
+
+				l_range.end = static_cast<u32>(m_observers.size());
+			}
+		}
+	}
+}
+
+bool ComponentObservers::shouldNotify(const Subscription& p_subscription, bool p_isAdd, ComponentType p_type, const ComponentIndicators& p_before) const
+{
+	//transition has to be consistent with mask - added component is not set before, removed one is
+	if (p_before.isSet(p_type) == p_isAdd)
+	{
+		return false;
+	}
+
+	auto l_after = p_before;
+	l_after.flip(p_type);
+
+	const auto l_hasAll = [](const ComponentIndicators& p_components, const ComponentIndicators& p_mask)
+	{
+		return (p_components & p_mask) == p_mask;
+	};
+
+	switch (p_subscription.transition)
+	{
+	case Transition::ADD:
+		return p_isAdd and p_subscription.type == p_type and l_hasAll(l_after, p_subscription.mask);
+	case Transition::REMOVE:
+		return not p_isAdd and p_subscription.type == p_type and l_hasAll(p_before, p_subscription.mask);
+	case Transition::MATCH:
+		return p_isAdd and l_hasAll(l_after, p_subscription.mask) and not l_hasAll(p_before, p_subscription.mask);
+	}
+
+	return false;
+}
+
+u32 ComponentObservers::getTableIndex(bool p_isAdd, ComponentType p_type, const ComponentIndicators& p_before) const
+{
+	const auto l_transition = p_isAdd ? 0u : 1u;
+	return (l_transition * NR_OF_TYPES + static_cast<u32>(p_type)) * NR_OF_MASKS + (p_before.toNumber() & (NR_OF_MASKS - 1u));
+}
+
+void ComponentObservers::notifyAdd(Entity& p_entity, ComponentType p_type, const ComponentIndicators& p_componentsBefore) const
+{
+	notify(getTableIndex(true, p_type, p_componentsBefore), p_entity, p_type);
+}
+
+void ComponentObservers::notifyRemove(Entity& p_entity, ComponentType p_type, const ComponentIndicators& p_componentsBefore) const
+{
+	notify(getTableIndex(false, p_type, p_componentsBefore), p_entity, p_type);
+}
+
+void ComponentObservers::notify(u32 p_tableIndex, Entity& p_entity, ComponentType p_type) const
+{
+	const auto& l_range = m_table[p_tableIndex];
+
+	for (auto i = l_range.begin; i < l_range.end; i++)
+	{
+		m_observers[i]->onComponentChange(p_entity, p_type);
+	}
+}
+
+}
@@ -3,9 +3,20 @@
 namespace engine
 {
 
+//placeholder until providers are backed by component pools
+
 ComponentBase& ComponentProvider::createComponent(ComponentType)
 {
-	return ComponentBase(ComponentType::POSITION);
+	static ComponentBase s_placeholder(ComponentType::POSITION);
+	return s_placeholder;
+}
+
+void ComponentProvider::createComponents(ComponentType p_type, u32 p_count, ComponentBase** p_components)
+{
+	for (auto i = 0u; i < p_count; i++)
+	{
+		p_components[i] = &createComponent(p_type);
+	}
 }
 
 bool ComponentProvider::removeComponent(ComponentBase&)
@@ -1,11 +1,66 @@
 #include "EntityChangeDistributor.h"
+#include <algorithm>
 
 namespace engine
 {
 
+EntityChangeDistributor::EntityChangeDistributor(std::pmr::memory_resource& p_memoryResource)
+	:m_listeners(&p_memoryResource)
+{
+}
+
 void EntityChangeDistributor::distributeEntityChange(EntityId p_id)
 {
+	if (m_changesMetric)
+	{
+		m_changesMetric->add();
+	}
 
+	for (auto l_listener : m_listeners)
+	{
+		l_listener->onEntityChange(p_id);
+	}
+}
+
+void EntityChangeDistributor::registerListener(IEntityChangeListener& p_listener)
+{
+	if (not isRegistered(p_listener))
+	{
+		m_listeners.push_back(&p_listener);
+		updateListenersMetric();
+	}
 }
 
-}
\ No newline at end of file
+void EntityChangeDistributor::deregisterListener(IEntityChangeListener& p_listener)
+{
+	auto l_iter = std::find(m_listeners.begin(), m_listeners.end(), &p_listener);
+
+	if (l_iter != m_listeners.end())
+	{
+		m_listeners.erase(l_iter);
+		updateListenersMetric();
+	}
+}
+
+bool EntityChangeDistributor::isRegistered(const IEntityChangeListener& p_listener) const
+{
+	return std::find(m_listeners.begin(), m_listeners.end(), &p_listener) != m_listeners.end();
+}
+
+void EntityChangeDistributor::attachMetrics(MetricsRegistry& p_registry, const std::string& p_prefix)
+{
+	m_changesMetric = &p_registry.getCounter(p_prefix + ".changes");
+	m_listenersMetric = &p_registry.getGauge(p_prefix + ".listeners");
+
+	updateListenersMetric();
+}
+
+void EntityChangeDistributor::updateListenersMetric()
+{
+	if (m_listenersMetric)
+	{
+		m_listenersMetric->set(static_cast<s64>(m_listeners.size()));
+	}
+}
+
+}
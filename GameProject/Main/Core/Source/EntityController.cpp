@@ -16,20 +16,81 @@ EntityController::EntityController(std::unique_ptr<IEntityPool> p_entityPool,
 EntityId EntityController::createEntity()
 {
 	auto& l_entity = m_pool->create();
+	increment(m_metrics.creates);
+
 	return l_entity.id;
 }
 
 EntityId EntityController::createEntityWithComponents(const ComponentIndicators& p_components)
 {
 	auto& l_entity = m_pool->create();
+	increment(m_metrics.creates);
+
 	connectMultipleComponents(l_entity, p_components);
 	return l_entity.id;
 }
 
+EntityId EntityController::createEntityFromPrefab(const Prefab& p_prefab)
+{
+	auto& l_entity = m_pool->create();
+	increment(m_metrics.creates);
+
+	connectPrefab(&l_entity, 1u, p_prefab);
+	return l_entity.id;
+}
+
+void EntityController::createEntitiesFromPrefab(const Prefab& p_prefab, u32 p_count, EntityId* p_ids)
+{
+	auto l_entities = m_pool->createMultiple(p_count);
+	increment(m_metrics.creates, p_count);
+
+	connectPrefab(l_entities, p_count, p_prefab);
+
+	if (p_ids)
+	{
+		for (auto i = 0u; i < p_count; i++)
+		{
+			p_ids[i] = l_entities[i].id;
+		}
+	}
+}
+
+void EntityController::connectPrefab(Entity* p_entities, u32 p_count, const Prefab& p_prefab)
+{
+	if (m_componentController->attachPrefab(p_entities, p_count, p_prefab))
+	{
+		increment(m_metrics.attaches, p_count);
+
+		for (auto i = 0u; i < p_count; i++)
+		{
+			m_changeDistributor.distributeEntityChange(p_entities[i].id);
+		}
+	}
+}
+
 bool EntityController::removeEntity(EntityId p_id)
 {
 	disconnectAllComponentsFromEntity(p_id);
-	return m_pool->removeEntity(p_id);
+
+	if (m_pool->removeEntity(p_id))
+	{
+		if (m_relations)
+		{
+			m_relations->removeEntity(p_id);
+		}
+
+		if (m_hierarchy)
+		{
+			m_hierarchy->remove(p_id);
+		}
+
+		increment(m_metrics.removes);
+		return true;
+	}
+	else
+	{
+		return false;
+	}
 }
 
 void EntityController::disconnectAllComponentsFromEntity(EntityId p_id)
@@ -54,6 +115,7 @@ bool EntityController::connectComponentToEntity(EntityId p_id, ComponentType p_c
 	
 	if(m_componentController->attachComponent(l_entity, p_componentType))
 	{
+		increment(m_metrics.attaches);
 		m_changeDistributor.distributeEntityChange(p_id);
 		return true;
 	}
@@ -69,6 +131,7 @@ bool EntityController::disconnectComponentFromEntity(EntityId p_id, ComponentTyp
 
 	if (m_componentController->detachComponent(l_entity, p_componentType))
 	{
+		increment(m_metrics.detaches);
 		m_changeDistributor.distributeEntityChange(p_id);
 		return true;
 	}
@@ -88,6 +151,7 @@ bool EntityController::connectMultipleComponents(Entity& p_entity, const Compone
 {
 	if (m_componentController->attachMultipleComponents(p_entity, p_components))
 	{
+		increment(m_metrics.attaches);
 		m_changeDistributor.distributeEntityChange(p_entity.id);
 		return true;
 	}
@@ -107,6 +171,7 @@ bool EntityController::disconnectMultipleComponents(Entity& p_entity, const Comp
 {
 	if (m_componentController->detachMultipleComponents(p_entity, p_components))
 	{
+		increment(m_metrics.detaches);
 		m_changeDistributor.distributeEntityChange(p_entity.id);
 		return true;
 	}
@@ -116,4 +181,30 @@ bool EntityController::disconnectMultipleComponents(Entity& p_entity, const Comp
 	}
 }
 
+void EntityController::attachMetrics(MetricsRegistry& p_registry, const std::string& p_prefix)
+{
+	m_metrics.creates = &p_registry.getCounter(p_prefix + ".creates");
+	m_metrics.removes = &p_registry.getCounter(p_prefix + ".removes");
+	m_metrics.attaches = &p_registry.getCounter(p_prefix + ".attaches");
+	m_metrics.detaches = &p_registry.getCounter(p_prefix + ".detaches");
+}
+
+void EntityController::attachRelations(RelationStore& p_relations)
+{
+	m_relations = &p_relations;
+}
+
+void EntityController::attachHierarchy(TransformHierarchy& p_hierarchy)
+{
+	m_hierarchy = &p_hierarchy;
+}
+
+void EntityController::increment(metrics::Counter* p_counter, u64 p_value)
+{
+	if (p_counter)
+	{
+		p_counter->add(p_value);
+	}
+}
+
 }
\ No newline at end of file
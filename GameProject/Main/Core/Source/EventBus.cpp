@@ -0,0 +1,28 @@
+#include "EventBus.h"
+
+namespace engine
+{
+
+EventBus::EventBus(u32 p_nrOfThreads, std::pmr::memory_resource& p_memoryResource)
+	:m_nrOfThreads(p_nrOfThreads),
+	 m_queues(&p_memoryResource)
+{
+}
+
+void EventBus::swapBuffers()
+{
+	for (auto& l_queue : m_queues)
+	{
+		if (l_queue)
+		{
+			l_queue->swapBuffers();
+		}
+	}
+}
+
+u32 EventBus::getNumOfThreads() const
+{
+	return m_nrOfThreads;
+}
+
+}
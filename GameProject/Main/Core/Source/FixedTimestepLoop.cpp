@@ -0,0 +1,179 @@
+#include "FixedTimestepLoop.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <thread>
+#include "Profiler.h"
+#include "assert.h"
+
+#if defined(_WIN32)
+	#ifndef NOMINMAX
+		#define NOMINMAX
+	#endif
+	#include <windows.h>
+#else
+	#include <time.h>
+#endif
+
+namespace engine
+{
+
+namespace
+{
+	using Clock = std::chrono::steady_clock;
+	using Milliseconds = std::chrono::duration<f64, std::milli>;
+	using Seconds = std::chrono::duration<f64>;
+
+	//CPU time consumed by calling thread, in milliseconds
+	f64 getThreadCpuTime()
+	{
+	#if defined(_WIN32)
+		FILETIME l_creation, l_exit, l_kernel, l_user;
+		GetThreadTimes(GetCurrentThread(), &l_creation, &l_exit, &l_kernel, &l_user);
+
+		auto toTicks = [](const FILETIME& p_time)
+		{
+			return (static_cast<u64>(p_time.dwHighDateTime) << 32u) | p_time.dwLowDateTime;
+		};
+
+		//FILETIME counts 100 ns intervals
+		return static_cast<f64>(toTicks(l_kernel) + toTicks(l_user)) / 10000.0;
+	#else
+		timespec l_time;
+		clock_gettime(CLOCK_THREAD_CPUTIME_ID, &l_time);
+
+		return static_cast<f64>(l_time.tv_sec) * 1000.0 + static_cast<f64>(l_time.tv_nsec) / 1000000.0;
+	#endif
+	}
+}
+
+FixedTimestepLoop::FixedTimestepLoop(ISystemController& p_systems, const FixedTimestepSettings& p_settings)
+	:m_systems(p_systems),
+	 m_settings(p_settings)
+{
+	assert(m_settings.fixedTimeStep > 0.0f);
+}
+
+u32 FixedTimestepLoop::advance(f32 p_elapsedTime)
+{
+	if (m_settings.maxElapsedTime > 0.0f)
+	{
+		p_elapsedTime = std::min(p_elapsedTime, m_settings.maxElapsedTime);
+	}
+
+	m_accumulator += p_elapsedTime;
+	u32 l_ticks = 0u;
+
+	while (m_accumulator >= m_settings.fixedTimeStep)
+	{
+		if (m_settings.maxTicksPerAdvance != 0u and l_ticks == m_settings.maxTicksPerAdvance)
+		{
+			if (m_settings.dropExcessTime)
+			{
+				dropExcessTime();
+			}
+
+			break;
+		}
+
+		tick();
+		m_accumulator -= m_settings.fixedTimeStep;
+		l_ticks++;
+	}
+
+	return l_ticks;
+}
+
+void FixedTimestepLoop::dropExcessTime()
+{
+	const auto l_nrOfTicks = std::floor(m_accumulator / m_settings.fixedTimeStep);
+
+	m_stats.nrOfDroppedTicks += static_cast<u64>(l_nrOfTicks);
+	m_accumulator -= l_nrOfTicks * m_settings.fixedTimeStep;
+}
+
+void FixedTimestepLoop::tick()
+{
+	ENGINE_PROFILE_ZONE("FixedTimestepLoop::tick");
+	const auto l_start = Clock::now();
+	const auto l_cpuStart = getThreadCpuTime();
+	m_systems.update(m_settings.fixedTimeStep);
+
+	registerTickTime(Milliseconds(Clock::now() - l_start).count(), getThreadCpuTime() - l_cpuStart);
+}
+
+void FixedTimestepLoop::registerTickTime(f64 p_tickTime, f64 p_cpuTime)
+{
+	m_stats.minTickTime = m_stats.nrOfTicks == 0u ? p_tickTime : std::min(m_stats.minTickTime, p_tickTime);
+	m_stats.maxTickTime = std::max(m_stats.maxTickTime, p_tickTime);
+	m_stats.lastTickTime = p_tickTime;
+	m_stats.totalTickTime += p_tickTime;
+
+	m_stats.lastTickCpuTime = p_cpuTime;
+	m_stats.maxTickCpuTime = std::max(m_stats.maxTickCpuTime, p_cpuTime);
+	m_stats.totalTickCpuTime += p_cpuTime;
+	m_stats.nrOfTicks++;
+}
+
+/*
+	Paced loop sleeps until next tick is due. Time spent in ticks stays in the accumulator,
+	so long ticks do not shift the schedule - following ticks catch up (up to the cap).
+	Unpaced loop runs ticks back to back - throughput of the simulation.
+*/
+
+u64 FixedTimestepLoop::run(u64 p_nrOfTicks, bool p_paceToRealTime)
+{
+	m_stopRequested = false;
+	const auto l_firstTick = m_stats.nrOfTicks;
+	auto l_previousTime = Clock::now();
+
+	auto isFinished = [&]()
+	{
+		return m_stopRequested or (p_nrOfTicks != 0u and m_stats.nrOfTicks - l_firstTick >= p_nrOfTicks);
+	};
+
+	while (not isFinished())
+	{
+		if (not p_paceToRealTime)
+		{
+			tick();
+			continue;
+		}
+
+		const auto l_now = Clock::now();
+		advance(static_cast<f32>(Seconds(l_now - l_previousTime).count()));
+		l_previousTime = l_now;
+
+		const auto l_timeToNextTick = Seconds(m_settings.fixedTimeStep - m_accumulator);
+		std::this_thread::sleep_for(l_timeToNextTick);
+	}
+
+	return m_stats.nrOfTicks - l_firstTick;
+}
+
+void FixedTimestepLoop::requestStop()
+{
+	m_stopRequested = true;
+}
+
+f32 FixedTimestepLoop::getInterpolationAlpha() const
+{
+	return static_cast<f32>(m_accumulator / m_settings.fixedTimeStep);
+}
+
+const TickStats& FixedTimestepLoop::getStats() const
+{
+	return m_stats;
+}
+
+void FixedTimestepLoop::resetStats()
+{
+	m_stats = TickStats();
+}
+
+const FixedTimestepSettings& FixedTimestepLoop::getSettings() const
+{
+	return m_settings;
+}
+
+}
@@ -1,13 +1,26 @@
 #include "IdGuard.h"
+#include <algorithm>
+#include <functional>
+#include "assert.h"
 
 namespace engine
 {
 
-IdGuard::IdGuard(Id p_maxId)
-	:m_maxId(p_maxId)
+IdGuard::IdGuard(Id p_maxId, std::pmr::memory_resource& p_memoryResource)
+	:m_maxId(p_maxId),
+	 m_freedIds(&p_memoryResource),
+	 m_isFreed(&p_memoryResource)
 {
 }
 
+IdGuard::~IdGuard()
+{
+	if (m_metrics.registry)
+	{
+		m_metrics.registry->removeSampledGauges(this);
+	}
+}
+
 Id IdGuard::getNextId()
 {
 	if (isIdCounterOverflowed())
@@ -58,16 +71,31 @@ Id IdGuard::getNewId()
 
 Id IdGuard::getIdFromFreed()
 {
-	auto l_iter = m_freedIds.begin();
-	auto l_id = *l_iter;
-	m_freedIds.erase(l_iter);
+	std::pop_heap(m_freedIds.begin(), m_freedIds.end(), std::greater<Id>());
+	auto l_id = m_freedIds.back();
+	m_freedIds.pop_back();
+	markAsFreed(l_id, false);
+
+#if defined(ENGINE_METRICS)
+	if (m_metrics.recycledIds)
+	{
+		m_metrics.recycledIds->add();
+	}
+#endif
 
 	return l_id;
 }
 
 void IdGuard::freeId(Id p_id)
 {
-	m_freedIds.emplace(p_id);
+	if (not canBeFreed(p_id))
+	{
+		return;
+	}
+
+	markAsFreed(p_id, true);
+	m_freedIds.push_back(p_id);
+	std::push_heap(m_freedIds.begin(), m_freedIds.end(), std::greater<Id>());
 }
 
 void IdGuard::reset()
@@ -75,6 +103,71 @@ void IdGuard::reset()
 	m_overflowed = false;
 	m_currentId = engine::UNDEFINED_ID;
 	m_freedIds.clear();
+	m_isFreed.assign(m_isFreed.size(), false);
+}
+
+/*
+	Writes freed ids in ascending order to p_freedIds, p_capacity has to fit all of them.
+	Freed ids are reused before new ones are generated, so their number never exceeds
+	max number of entities alive at once - capacity of entity pool is enough.
+*/
+
+IdGuardState IdGuard::saveState(Id* p_freedIds, [[maybe_unused]] u32 p_capacity) const
+{
+	assert(m_freedIds.size() <= p_capacity);
+
+	IdGuardState l_state;
+	l_state.currentId = m_currentId;
+	l_state.nrOfFreedIds = static_cast<u32>(m_freedIds.size());
+	l_state.overflowed = m_overflowed ? 1u : 0u;
+
+	std::copy(m_freedIds.begin(), m_freedIds.end(), p_freedIds);
+	std::sort(p_freedIds, p_freedIds + l_state.nrOfFreedIds);
+
+	return l_state;
+}
+
+void IdGuard::restoreState(const IdGuardState& p_state, const Id* p_freedIds)
+{
+	m_currentId = p_state.currentId;
+	m_overflowed = p_state.overflowed != 0u;
+
+	m_freedIds.assign(p_freedIds, p_freedIds + p_state.nrOfFreedIds);
+	std::make_heap(m_freedIds.begin(), m_freedIds.end(), std::greater<Id>());
+
+	m_isFreed.assign(m_isFreed.size(), false);
+	for (auto l_id : m_freedIds)
+	{
+		markAsFreed(l_id, true);
+	}
+}
+
+bool IdGuard::canBeFreed(Id p_id) const
+{
+	const bool l_wasGiven = p_id != engine::UNDEFINED_ID and p_id <= m_currentId;
+	return l_wasGiven and (p_id >= m_isFreed.size() or not m_isFreed[p_id]);
+}
+
+void IdGuard::markAsFreed(Id p_id, bool p_isFreed)
+{
+	if (p_id >= m_isFreed.size())
+	{
+		m_isFreed.resize(p_id + 1u, false);
+	}
+
+	m_isFreed[p_id] = p_isFreed;
+}
+
+void IdGuard::attachMetrics(MetricsRegistry& p_registry, const std::string& p_prefix)
+{
+	m_metrics.registry = &p_registry;
+	p_registry.addSampledGauge(p_prefix + ".freedIds", this, [this]() { return static_cast<s64>(m_freedIds.size()); });
+	p_registry.addSampledGauge(p_prefix + ".currentId", this, [this]() { return static_cast<s64>(m_currentId); });
+	p_registry.addSampledGauge(p_prefix + ".overflowed", this, [this]() { return m_overflowed ? s64(1) : s64(0); });
+
+#if defined(ENGINE_METRICS)
+	m_metrics.recycledIds = &p_registry.getCounter(p_prefix + ".recycledIds");
+#endif
 }
 
 }
\ No newline at end of file
@@ -0,0 +1,184 @@
+#include "IntegrationKernels.h"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+	#define ENGINE_X86
+	#include <immintrin.h>
+	#if defined(_MSC_VER)
+		#include <intrin.h>
+	#endif
+#endif
+
+#if defined(ENGINE_X86) && defined(__GNUC__)
+	#define ENGINE_TARGET_SSE2 __attribute__((target("sse2")))
+	#define ENGINE_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+	#define ENGINE_TARGET_SSE2
+	#define ENGINE_TARGET_AVX2
+#endif
+
+namespace engine
+{
+
+namespace
+{
+	constexpr u32 SSE2_LANES = 4u;
+	constexpr u32 AVX2_LANES = 8u;
+
+#if defined(ENGINE_X86) && defined(_MSC_VER)
+	constexpr int CPUID_EDX_SSE2 = 1 << 26;
+	constexpr int CPUID_ECX_OSXSAVE = 1 << 27;
+	constexpr int CPUID_ECX_AVX = 1 << 28;
+	constexpr int CPUID_EBX_AVX2 = 1 << 5;
+	constexpr unsigned long long XCR0_XMM_AND_YMM = 0x6;
+
+	SimdLevel detectSimdLevelWithCpuid()
+	{
+		int l_info[4] = {};
+
+		__cpuid(l_info, 0);
+		const auto l_maxLeaf = l_info[0];
+
+		__cpuid(l_info, 1);
+		const bool l_hasSse2 = l_info[3] & CPUID_EDX_SSE2;
+		const bool l_hasAvx = (l_info[2] & CPUID_ECX_AVX) and (l_info[2] & CPUID_ECX_OSXSAVE);
+
+		bool l_hasAvx2 = false;
+		if (l_hasAvx and l_maxLeaf >= 7)
+		{
+			__cpuidex(l_info, 7, 0);
+			const bool l_isYmmStateEnabled = (_xgetbv(0) & XCR0_XMM_AND_YMM) == XCR0_XMM_AND_YMM;
+			l_hasAvx2 = (l_info[1] & CPUID_EBX_AVX2) and l_isYmmStateEnabled;
+		}
+
+		if (l_hasAvx2)
+			return SimdLevel::AVX2;
+
+		return l_hasSse2 ? SimdLevel::SSE2 : SimdLevel::SCALAR;
+	}
+#endif
+
+	SimdLevel queryHostSimdLevel()
+	{
+#if defined(ENGINE_X86) && defined(_MSC_VER)
+		return detectSimdLevelWithCpuid();
+#elif defined(ENGINE_X86) && defined(__GNUC__)
+		__builtin_cpu_init();
+
+		if (__builtin_cpu_supports("avx2"))
+			return SimdLevel::AVX2;
+
+		return __builtin_cpu_supports("sse2") ? SimdLevel::SSE2 : SimdLevel::SCALAR;
+#else
+		return SimdLevel::SCALAR;
+#endif
+	}
+
+	void integrateTail(f32* p_positionsX, f32* p_positionsY,
+					   const f32* p_velocitiesX, const f32* p_velocitiesY,
+					   u32 p_begin, u32 p_end, f32 p_deltaTime)
+	{
+		for (auto i = p_begin; i < p_end; i++)
+		{
+			p_positionsX[i] += p_velocitiesX[i] * p_deltaTime;
+			p_positionsY[i] += p_velocitiesY[i] * p_deltaTime;
+		}
+	}
+}
+
+namespace kernels
+{
+
+SimdLevel detectSimdLevel()
+{
+	static const SimdLevel s_hostLevel = queryHostSimdLevel();
+	return s_hostLevel;
+}
+
+bool isSimdLevelSupported(SimdLevel p_level)
+{
+	return static_cast<int>(p_level) <= static_cast<int>(detectSimdLevel());
+}
+
+IntegrationKernel getIntegrationKernel(SimdLevel p_level)
+{
+	if (not isSimdLevelSupported(p_level))
+	{
+		return &integrateScalar;
+	}
+
+	switch (p_level)
+	{
+	case SimdLevel::AVX2:
+		return &integrateAvx2;
+	case SimdLevel::SSE2:
+		return &integrateSse2;
+	default:
+		return &integrateScalar;
+	}
+}
+
+IntegrationKernel getBestIntegrationKernel()
+{
+	static const IntegrationKernel s_bestKernel = getIntegrationKernel(detectSimdLevel());
+	return s_bestKernel;
+}
+
+void integrateScalar(f32* p_positionsX, f32* p_positionsY,
+					 const f32* p_velocitiesX, const f32* p_velocitiesY,
+					 u32 p_count, f32 p_deltaTime)
+{
+	integrateTail(p_positionsX, p_positionsY, p_velocitiesX, p_velocitiesY, 0u, p_count, p_deltaTime);
+}
+
+ENGINE_TARGET_SSE2
+void integrateSse2(f32* p_positionsX, f32* p_positionsY,
+				   const f32* p_velocitiesX, const f32* p_velocitiesY,
+				   u32 p_count, f32 p_deltaTime)
+{
+#if defined(ENGINE_X86)
+	const auto l_vectorizedCount = p_count - (p_count % SSE2_LANES);
+	const __m128 l_deltaTime = _mm_set1_ps(p_deltaTime);
+
+	for (auto i = 0u; i < l_vectorizedCount; i += SSE2_LANES)
+	{
+		const __m128 l_stepX = _mm_mul_ps(_mm_loadu_ps(p_velocitiesX + i), l_deltaTime);
+		const __m128 l_stepY = _mm_mul_ps(_mm_loadu_ps(p_velocitiesY + i), l_deltaTime);
+
+		_mm_storeu_ps(p_positionsX + i, _mm_add_ps(_mm_loadu_ps(p_positionsX + i), l_stepX));
+		_mm_storeu_ps(p_positionsY + i, _mm_add_ps(_mm_loadu_ps(p_positionsY + i), l_stepY));
+	}
+
+	integrateTail(p_positionsX, p_positionsY, p_velocitiesX, p_velocitiesY, l_vectorizedCount, p_count, p_deltaTime);
+#else
+	integrateScalar(p_positionsX, p_positionsY, p_velocitiesX, p_velocitiesY, p_count, p_deltaTime);
+#endif
+}
+
+ENGINE_TARGET_AVX2
+void integrateAvx2(f32* p_positionsX, f32* p_positionsY,
+				   const f32* p_velocitiesX, const f32* p_velocitiesY,
+				   u32 p_count, f32 p_deltaTime)
+{
+#if defined(ENGINE_X86)
+	const auto l_vectorizedCount = p_count - (p_count % AVX2_LANES);
+	const __m256 l_deltaTime = _mm256_set1_ps(p_deltaTime);
+
+	for (auto i = 0u; i < l_vectorizedCount; i += AVX2_LANES)
+	{
+		const __m256 l_stepX = _mm256_mul_ps(_mm256_loadu_ps(p_velocitiesX + i), l_deltaTime);
+		const __m256 l_stepY = _mm256_mul_ps(_mm256_loadu_ps(p_velocitiesY + i), l_deltaTime);
+
+		_mm256_storeu_ps(p_positionsX + i, _mm256_add_ps(_mm256_loadu_ps(p_positionsX + i), l_stepX));
+		_mm256_storeu_ps(p_positionsY + i, _mm256_add_ps(_mm256_loadu_ps(p_positionsY + i), l_stepY));
+	}
+
+	_mm256_zeroupper();
+	integrateTail(p_positionsX, p_positionsY, p_velocitiesX, p_velocitiesY, l_vectorizedCount, p_count, p_deltaTime);
+#else
+	integrateScalar(p_positionsX, p_positionsY, p_velocitiesX, p_velocitiesY, p_count, p_deltaTime);
+#endif
+}
+
+}
+
+}
@@ -0,0 +1,207 @@
+#include "MetricsRegistry.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+
+namespace engine
+{
+
+namespace metrics
+{
+
+namespace
+{
+	u32 getBucketIndex(u64 p_value)
+	{
+		u32 l_index = 0u;
+
+		while (p_value != 0u)
+		{
+			p_value >>= 1u;
+			l_index++;
+		}
+
+		return l_index;
+	}
+
+	u64 getBucketUpperBound(u32 p_index)
+	{
+		return p_index >= 64u ? std::numeric_limits<u64>::max() : (u64(1u) << p_index) - 1u;
+	}
+}
+
+void Histogram::record(u64 p_value)
+{
+	m_buckets[getBucketIndex(p_value)].fetch_add(1u, std::memory_order_relaxed);
+	m_sum.fetch_add(p_value, std::memory_order_relaxed);
+	m_count.fetch_add(1u, std::memory_order_relaxed);
+}
+
+u64 Histogram::getCount() const
+{
+	return m_count.load(std::memory_order_relaxed);
+}
+
+u64 Histogram::getSum() const
+{
+	return m_sum.load(std::memory_order_relaxed);
+}
+
+u64 Histogram::getBucket(u32 p_index) const
+{
+	return m_buckets[p_index].load(std::memory_order_relaxed);
+}
+
+u64 Histogram::getPercentile(f64 p_fraction) const
+{
+	u64 l_total = 0u;
+	u64 l_counts[NR_OF_HISTOGRAM_BUCKETS];
+
+	for (auto i = 0u; i < NR_OF_HISTOGRAM_BUCKETS; i++)
+	{
+		l_counts[i] = getBucket(i);
+		l_total += l_counts[i];
+	}
+
+	if (l_total == 0u)
+	{
+		return 0u;
+	}
+
+	const auto l_rank = std::max<u64>(1u, static_cast<u64>(std::ceil(p_fraction * static_cast<f64>(l_total))));
+	u64 l_seen = 0u;
+
+	for (auto i = 0u; i < NR_OF_HISTOGRAM_BUCKETS; i++)
+	{
+		l_seen += l_counts[i];
+
+		if (l_seen >= l_rank)
+		{
+			return getBucketUpperBound(i);
+		}
+	}
+
+	return getBucketUpperBound(NR_OF_HISTOGRAM_BUCKETS - 1u);
+}
+
+const MetricSample* MetricsSnapshot::find(const std::string& p_name) const
+{
+	auto l_iter = std::find_if(samples.begin(), samples.end(),
+		[&p_name](const MetricSample& p_sample) { return p_name == p_sample.name; });
+
+	return l_iter != samples.end() ? &*l_iter : nullptr;
+}
+
+}
+
+template<typename Metric>
+Metric& MetricsRegistry::getOrCreate(std::deque<NamedMetric<Metric>>& p_metrics, const std::string& p_name)
+{
+	std::lock_guard<std::mutex> l_lock(m_mutex);
+
+	auto l_iter = std::find_if(p_metrics.begin(), p_metrics.end(),
+		[&p_name](const NamedMetric<Metric>& p_metric) { return p_metric.name == p_name; });
+
+	if (l_iter != p_metrics.end())
+	{
+		return l_iter->metric;
+	}
+
+	return p_metrics.emplace_back(p_name).metric;
+}
+
+metrics::Counter& MetricsRegistry::getCounter(const std::string& p_name)
+{
+	return getOrCreate(m_counters, p_name);
+}
+
+metrics::Gauge& MetricsRegistry::getGauge(const std::string& p_name)
+{
+	return getOrCreate(m_gauges, p_name);
+}
+
+metrics::Histogram& MetricsRegistry::getHistogram(const std::string& p_name)
+{
+	return getOrCreate(m_histograms, p_name);
+}
+
+void MetricsRegistry::addSampledGauge(const std::string& p_name, const void* p_owner, std::function<s64()> p_sample)
+{
+	std::lock_guard<std::mutex> l_lock(m_mutex);
+	m_sampledGauges.push_back({ p_name, p_owner, std::move(p_sample) });
+}
+
+void MetricsRegistry::removeSampledGauges(const void* p_owner)
+{
+	std::lock_guard<std::mutex> l_lock(m_mutex);
+
+	m_sampledGauges.erase(std::remove_if(m_sampledGauges.begin(), m_sampledGauges.end(),
+		[p_owner](const SampledGauge& p_gauge) { return p_gauge.owner == p_owner; }), m_sampledGauges.end());
+}
+
+u32 MetricsRegistry::getNumOfMetrics() const
+{
+	std::lock_guard<std::mutex> l_lock(m_mutex);
+	return static_cast<u32>(m_counters.size() + m_gauges.size() + m_histograms.size() + m_sampledGauges.size());
+}
+
+void MetricsRegistry::takeSnapshot(metrics::MetricsSnapshot& p_snapshot) const
+{
+	std::lock_guard<std::mutex> l_lock(m_mutex);
+
+	p_snapshot.timestamp = static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::steady_clock::now().time_since_epoch()).count());
+	p_snapshot.samples.clear();
+
+	for (const auto& l_counter : m_counters)
+	{
+		p_snapshot.samples.push_back({ l_counter.name.c_str(), metrics::MetricType::COUNTER,
+									   static_cast<s64>(l_counter.metric.get()), 0u, 0u, 0u });
+	}
+
+	for (const auto& l_gauge : m_gauges)
+	{
+		p_snapshot.samples.push_back({ l_gauge.name.c_str(), metrics::MetricType::GAUGE, l_gauge.metric.get(), 0u, 0u, 0u });
+	}
+
+	for (const auto& l_gauge : m_sampledGauges)
+	{
+		p_snapshot.samples.push_back({ l_gauge.name.c_str(), metrics::MetricType::GAUGE, l_gauge.sample(), 0u, 0u, 0u });
+	}
+
+	for (const auto& l_histogram : m_histograms)
+	{
+		const auto& l_metric = l_histogram.metric;
+
+		p_snapshot.samples.push_back({ l_histogram.name.c_str(), metrics::MetricType::HISTOGRAM,
+									   static_cast<s64>(l_metric.getCount()), l_metric.getSum(),
+									   l_metric.getPercentile(0.5), l_metric.getPercentile(0.99) });
+	}
+}
+
+bool MetricsRegistry::writeSnapshot(std::ostream& p_output, const metrics::MetricsSnapshot& p_snapshot)
+{
+	p_output << "{\"timestamp\":" << p_snapshot.timestamp << ",\"metrics\":{";
+
+	for (auto i = 0u; i < p_snapshot.samples.size(); i++)
+	{
+		const auto& l_sample = p_snapshot.samples[i];
+		p_output << (i == 0u ? "" : ",") << "\"" << l_sample.name << "\":";
+
+		if (l_sample.type == metrics::MetricType::HISTOGRAM)
+		{
+			p_output << "{\"count\":" << l_sample.value << ",\"sum\":" << l_sample.sum
+					 << ",\"p50\":" << l_sample.p50 << ",\"p99\":" << l_sample.p99 << "}";
+		}
+		else
+		{
+			p_output << l_sample.value;
+		}
+	}
+
+	p_output << "}}\n";
+	return p_output.good();
+}
+
+}
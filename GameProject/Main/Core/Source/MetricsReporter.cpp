@@ -0,0 +1,59 @@
+#include "MetricsReporter.h"
+#include <fstream>
+#include "assert.h"
+
+namespace engine
+{
+
+MetricsReporter::MetricsReporter(MetricsRegistry& p_registry, const std::string& p_filePath, f32 p_interval)
+	:m_registry(p_registry),
+	 m_filePath(p_filePath),
+	 m_interval(p_interval)
+{
+	assert(p_interval > 0.0f);
+}
+
+void MetricsReporter::update(f32 p_deltaTime)
+{
+	for (auto& l_tracked : m_trackedCounters)
+	{
+		const auto l_value = l_tracked.counter->get();
+
+		l_tracked.histogram->record(l_value - l_tracked.lastValue);
+		l_tracked.lastValue = l_value;
+	}
+
+	m_timeSinceDump += p_deltaTime;
+
+	if (m_timeSinceDump >= m_interval)
+	{
+		m_timeSinceDump -= m_interval;
+		dump();
+	}
+}
+
+const char* MetricsReporter::getName() const
+{
+	return "MetricsReporter";
+}
+
+void MetricsReporter::trackPerTick(const std::string& p_counterName)
+{
+	const auto& l_counter = m_registry.getCounter(p_counterName);
+	m_trackedCounters.push_back({ &l_counter, &m_registry.getHistogram(p_counterName + ".perTick"), l_counter.get() });
+}
+
+bool MetricsReporter::dump()
+{
+	m_registry.takeSnapshot(m_snapshot);
+
+	std::ofstream l_file(m_filePath, std::ios::app);
+	return l_file and MetricsRegistry::writeSnapshot(l_file, m_snapshot);
+}
+
+const metrics::MetricsSnapshot& MetricsReporter::getLastSnapshot() const
+{
+	return m_snapshot;
+}
+
+}
@@ -0,0 +1,81 @@
+#include "Prefab.h"
+#include <cstring>
+#include "assert.h"
+
+namespace engine
+{
+
+bool Prefab::addComponent(ComponentType p_type)
+{
+	if (isValid(p_type) and not m_components.isSet(p_type))
+	{
+		m_components.set(p_type);
+		return true;
+	}
+	else
+	{
+		return false;
+	}
+}
+
+bool Prefab::addDefaults(ComponentType p_type, const u8* p_data, u32 p_size)
+{
+	if (not addComponent(p_type))
+	{
+		return false;
+	}
+
+	auto& l_range = m_defaults[static_cast<u32>(p_type)];
+	l_range.offset = static_cast<u32>(m_data.size());
+	l_range.size = p_size;
+
+	m_data.insert(m_data.end(), p_data, p_data + p_size);
+	return true;
+}
+
+bool Prefab::isValid(ComponentType p_type) const
+{
+	return static_cast<u32>(p_type) < NR_OF_TYPES;
+}
+
+const ComponentIndicators& Prefab::getComponents() const
+{
+	return m_components;
+}
+
+bool Prefab::hasDefaults(ComponentType p_type) const
+{
+	return isValid(p_type) and m_defaults[static_cast<u32>(p_type)].size != 0u;
+}
+
+void Prefab::applyDefaults(ComponentBase& p_component) const
+{
+	ComponentBase* l_component = &p_component;
+	applyDefaults(&l_component, 1u);
+}
+
+/*
+	All components have to be of the same type - range is looked up once and every component
+	gets the same memcpy, which is the whole cost of instantiation for plain data components.
+*/
+
+void Prefab::applyDefaults(ComponentBase* const* p_components, u32 p_count) const
+{
+	if (p_count == 0u or not hasDefaults(p_components[0]->type))
+	{
+		return;
+	}
+
+	const auto& l_range = m_defaults[static_cast<u32>(p_components[0]->type)];
+	const auto l_defaults = m_data.data() + l_range.offset;
+
+	for (auto i = 0u; i < p_count; i++)
+	{
+		assert(p_components[i]->type == p_components[0]->type);
+
+		auto l_data = reinterpret_cast<u8*>(p_components[i]) + sizeof(ComponentBase);
+		std::memcpy(l_data, l_defaults, l_range.size);
+	}
+}
+
+}
@@ -0,0 +1,270 @@
+#include "Profiler.h"
+#include <algorithm>
+#include <atomic>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace engine
+{
+
+namespace profiler
+{
+
+namespace
+{
+	constexpr u32 PROCESS_ID = 1u;
+	constexpr f64 NS_PER_US = 1000.0;
+
+	struct ZoneEvent
+	{
+		const char* name;
+		u64 start;
+		u64 duration;
+	};
+
+	/*
+		Written only by its own thread. started is bumped before slot is overwritten and written is published
+		with release after the event is stored - readers take everything below written and afterwards drop
+		slots which the owner started to reuse in the meantime (seqlock). clearedAt marks events dropped by clear().
+		threadId, name and finished are changed under registry mutex only.
+	*/
+	struct ThreadBuffer
+	{
+		ThreadBuffer(u32 p_threadId)
+			:threadId(p_threadId),
+			 events(EVENTS_PER_THREAD)
+		{
+		}
+
+		u32 threadId;
+		bool finished = false;
+		std::string name;
+		std::vector<ZoneEvent> events;
+		std::atomic<u64> started{ 0u };
+		std::atomic<u64> written{ 0u };
+		std::atomic<u64> clearedAt{ 0u };
+	};
+
+	//buffers of finished threads stay registered, so their zones can still be exported, until the registry is full
+	struct Registry
+	{
+		std::mutex mutex;
+		std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+		u32 nextThreadId = 0u;
+	};
+
+	Registry& getRegistry()
+	{
+		static Registry s_registry;
+		return s_registry;
+	}
+
+	//events of previous owner are dropped, new thread id keeps zones of both threads apart
+	ThreadBuffer* reuseFinishedBuffer(Registry& p_registry)
+	{
+		for (auto& l_buffer : p_registry.buffers)
+		{
+			if (l_buffer->finished)
+			{
+				l_buffer->finished = false;
+				l_buffer->threadId = p_registry.nextThreadId++;
+				l_buffer->name.clear();
+				l_buffer->clearedAt.store(l_buffer->written.load(std::memory_order_relaxed), std::memory_order_release);
+
+				return l_buffer.get();
+			}
+		}
+
+		return nullptr;
+	}
+
+	ThreadBuffer& registerThread()
+	{
+		auto& l_registry = getRegistry();
+		std::lock_guard<std::mutex> l_lock(l_registry.mutex);
+
+		if (l_registry.buffers.size() >= MAX_NR_OF_THREAD_BUFFERS)
+		{
+			if (auto l_buffer = reuseFinishedBuffer(l_registry))
+			{
+				return *l_buffer;
+			}
+		}
+
+		auto l_buffer = std::make_shared<ThreadBuffer>(l_registry.nextThreadId++);
+		l_registry.buffers.push_back(l_buffer);
+
+		return *l_buffer;
+	}
+
+	//marks buffer as free for reuse when its thread exits
+	struct ThreadBufferOwner
+	{
+		ThreadBufferOwner()
+			:buffer(registerThread())
+		{
+		}
+
+		~ThreadBufferOwner()
+		{
+			std::lock_guard<std::mutex> l_lock(getRegistry().mutex);
+			buffer.finished = true;
+		}
+
+		ThreadBuffer& buffer;
+	};
+
+	ThreadBuffer& getThreadBuffer()
+	{
+		thread_local ThreadBufferOwner s_owner;
+		return s_owner.buffer;
+	}
+
+	void collectThreadZones(const ThreadBuffer& p_buffer, std::vector<RecordedZone>& p_zones)
+	{
+		const auto l_written = p_buffer.written.load(std::memory_order_acquire);
+		const auto l_begin = std::max(p_buffer.clearedAt.load(std::memory_order_acquire),
+									  l_written > EVENTS_PER_THREAD ? l_written - EVENTS_PER_THREAD : 0u);
+		const auto l_firstCollected = p_zones.size();
+
+		for (auto i = l_begin; i < l_written; i++)
+		{
+			const auto& l_event = p_buffer.events[i % EVENTS_PER_THREAD];
+			p_zones.push_back({ l_event.name, l_event.start, l_event.duration, p_buffer.threadId });
+		}
+
+		std::atomic_thread_fence(std::memory_order_acquire);
+		const auto l_started = p_buffer.started.load(std::memory_order_relaxed);
+
+		if (l_started > l_begin + EVENTS_PER_THREAD)
+		{
+			const auto l_nrOfOverwritten = std::min<u64>(l_started - EVENTS_PER_THREAD - l_begin, l_written - l_begin);
+			p_zones.erase(p_zones.begin() + l_firstCollected, p_zones.begin() + l_firstCollected + l_nrOfOverwritten);
+		}
+	}
+
+	void writeEscaped(std::ostream& p_output, const char* p_text)
+	{
+		for (; *p_text != '\0'; p_text++)
+		{
+			if (*p_text == '"' or *p_text == '\\')
+			{
+				p_output << '\\';
+			}
+
+			p_output << *p_text;
+		}
+	}
+}
+
+void recordZone(const char* p_name, u64 p_start, u64 p_end)
+{
+	auto& l_buffer = getThreadBuffer();
+	const auto l_index = l_buffer.written.load(std::memory_order_relaxed);
+
+	l_buffer.started.store(l_index + 1u, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+	l_buffer.events[l_index % EVENTS_PER_THREAD] = { p_name, p_start, p_end - p_start };
+	l_buffer.written.store(l_index + 1u, std::memory_order_release);
+}
+
+void setThreadName(const char* p_name)
+{
+	auto& l_buffer = getThreadBuffer();
+
+	std::lock_guard<std::mutex> l_lock(getRegistry().mutex);
+	l_buffer.name = p_name;
+}
+
+std::vector<RecordedZone> collectZones()
+{
+	auto& l_registry = getRegistry();
+	std::lock_guard<std::mutex> l_lock(l_registry.mutex);
+
+	std::vector<RecordedZone> l_zones;
+
+	for (const auto& l_buffer : l_registry.buffers)
+	{
+		collectThreadZones(*l_buffer, l_zones);
+	}
+
+	return l_zones;
+}
+
+/*
+	Complete events ("ph":"X") with microsecond timestamps relative to the oldest exported zone,
+	plus thread_name metadata for named threads.
+*/
+
+bool exportChromeTrace(std::ostream& p_output)
+{
+	const auto l_zones = collectZones();
+	u64 l_origin = 0u;
+
+	if (not l_zones.empty())
+	{
+		l_origin = std::min_element(l_zones.begin(), l_zones.end(),
+			[](const RecordedZone& p_first, const RecordedZone& p_second) { return p_first.start < p_second.start; })->start;
+	}
+
+	const auto l_flags = p_output.flags();
+	const auto l_precision = p_output.precision();
+
+	p_output << std::fixed << std::setprecision(3) << "{\"traceEvents\":[";
+	bool l_first = true;
+
+	{
+		auto& l_registry = getRegistry();
+		std::lock_guard<std::mutex> l_lock(l_registry.mutex);
+
+		for (const auto& l_buffer : l_registry.buffers)
+		{
+			if (l_buffer->name.empty())
+			{
+				continue;
+			}
+
+			p_output << (l_first ? "\n" : ",\n")
+					 << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << PROCESS_ID << ",\"tid\":" << l_buffer->threadId
+					 << ",\"args\":{\"name\":\"";
+			writeEscaped(p_output, l_buffer->name.c_str());
+			p_output << "\"}}";
+
+			l_first = false;
+		}
+	}
+
+	for (const auto& l_zone : l_zones)
+	{
+		p_output << (l_first ? "\n" : ",\n") << "{\"name\":\"";
+		writeEscaped(p_output, l_zone.name);
+		p_output << "\",\"ph\":\"X\",\"ts\":" << static_cast<f64>(l_zone.start - l_origin) / NS_PER_US
+				 << ",\"dur\":" << static_cast<f64>(l_zone.duration) / NS_PER_US
+				 << ",\"pid\":" << PROCESS_ID << ",\"tid\":" << l_zone.threadId << "}";
+
+		l_first = false;
+	}
+
+	p_output << "\n],\"displayTimeUnit\":\"ns\"}\n";
+	p_output.flags(l_flags);
+	p_output.precision(l_precision);
+
+	return p_output.good();
+}
+
+void clear()
+{
+	auto& l_registry = getRegistry();
+	std::lock_guard<std::mutex> l_lock(l_registry.mutex);
+
+	for (auto& l_buffer : l_registry.buffers)
+	{
+		l_buffer->clearedAt.store(l_buffer->written.load(std::memory_order_acquire), std::memory_order_release);
+	}
+}
+
+}
+
+}
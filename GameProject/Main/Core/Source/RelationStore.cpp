@@ -0,0 +1,191 @@
+#include "RelationStore.h"
+
+namespace engine
+{
+
+RelationStore::RelationStore(PoolSize p_capacity, std::pmr::memory_resource& p_memoryResource)
+	:m_capacity(p_capacity),
+	 m_targets(NR_OF_RELATION_TYPES, &p_memoryResource),
+	 m_sources(NR_OF_RELATION_TYPES, &p_memoryResource)
+{
+}
+
+bool RelationStore::add(EntityId p_source, RelationType p_type, EntityId p_target)
+{
+	if (not isIdInRange(p_source) or not isIdInRange(p_target) or p_source == p_target or has(p_source, p_type, p_target))
+	{
+		return false;
+	}
+
+	auto& l_targets = targets(p_type).try_emplace(p_source).first->second;
+	auto& l_sources = sources(p_type).try_emplace(p_target).first->second;
+
+	l_targets.entities.push_back(p_target);
+	l_targets.counterpartSlots.push_back(static_cast<u32>(l_sources.entities.size()));
+
+	l_sources.entities.push_back(p_source);
+	l_sources.counterpartSlots.push_back(static_cast<u32>(l_targets.entities.size() - 1u));
+
+	++m_size;
+	return true;
+}
+
+bool RelationStore::remove(EntityId p_source, RelationType p_type, EntityId p_target)
+{
+	if (not isIdInRange(p_source) or not isIdInRange(p_target))
+	{
+		return false;
+	}
+
+	const auto l_targets = findList(targets(p_type), p_source);
+	const auto l_slot = l_targets ? findSlot(*l_targets, p_target) : INVALID_INDEX;
+
+	if (l_slot == INVALID_INDEX)
+	{
+		return false;
+	}
+
+	erase(p_type, p_source, l_slot);
+	return true;
+}
+
+bool RelationStore::has(EntityId p_source, RelationType p_type, EntityId p_target) const
+{
+	if (not isIdInRange(p_source) or not isIdInRange(p_target))
+	{
+		return false;
+	}
+
+	const auto l_targets = findList(m_targets[static_cast<u32>(p_type)], p_source);
+	const auto l_sources = findList(m_sources[static_cast<u32>(p_type)], p_target);
+
+	if (l_targets == nullptr or l_sources == nullptr)
+	{
+		return false;
+	}
+
+	//shorter side is scanned - relation is present on both
+	return l_targets->entities.size() <= l_sources->entities.size() ? findSlot(*l_targets, p_target) != INVALID_INDEX
+																	   : findSlot(*l_sources, p_source) != INVALID_INDEX;
+}
+
+const std::pmr::vector<EntityId>& RelationStore::getTargets(EntityId p_source, RelationType p_type) const
+{
+	const auto l_targets = findList(m_targets[static_cast<u32>(p_type)], p_source);
+	return l_targets ? l_targets->entities : m_emptyList;
+}
+
+const std::pmr::vector<EntityId>& RelationStore::getSources(RelationType p_type, EntityId p_target) const
+{
+	const auto l_sources = findList(m_sources[static_cast<u32>(p_type)], p_target);
+	return l_sources ? l_sources->entities : m_emptyList;
+}
+
+void RelationStore::removeEntity(EntityId p_id)
+{
+	if (not isIdInRange(p_id))
+	{
+		return;
+	}
+
+	for (auto i = 0u; i < NR_OF_RELATION_TYPES; i++)
+	{
+		const auto l_type = static_cast<RelationType>(i);
+		const auto l_targets = targets(l_type).find(p_id);
+		const auto l_sources = sources(l_type).find(p_id);
+
+		if (l_targets != targets(l_type).end())
+		{
+			while (not l_targets->second.entities.empty())
+			{
+				erase(l_type, p_id, static_cast<u32>(l_targets->second.entities.size() - 1u));
+			}
+
+			targets(l_type).erase(l_targets);
+		}
+
+		if (l_sources != sources(l_type).end())
+		{
+			while (not l_sources->second.entities.empty())
+			{
+				erase(l_type, l_sources->second.entities.back(), l_sources->second.counterpartSlots.back());
+			}
+
+			sources(l_type).erase(l_sources);
+		}
+	}
+}
+
+u32 RelationStore::size() const
+{
+	return m_size;
+}
+
+bool RelationStore::isIdInRange(EntityId p_id) const
+{
+	return p_id != UNDEFINED_ENTITY_ID and p_id <= m_capacity;
+}
+
+const RelationStore::RelationList* RelationStore::findList(const RelationLists& p_lists, EntityId p_id) const
+{
+	const auto l_list = p_lists.find(p_id);
+	return l_list != p_lists.end() ? &l_list->second : nullptr;
+}
+
+u32 RelationStore::findSlot(const RelationList& p_list, EntityId p_id) const
+{
+	for (auto i = 0u; i < p_list.entities.size(); i++)
+	{
+		if (p_list.entities[i] == p_id)
+		{
+			return i;
+		}
+	}
+
+	return INVALID_INDEX;
+}
+
+/*
+	Swap with last - counterpart of moved entry (in list of other entity) is pointed to its new slot.
+*/
+
+void RelationStore::erase(RelationList& p_list, u32 p_slot, RelationLists& p_counterpartLists)
+{
+	const auto l_last = static_cast<u32>(p_list.entities.size() - 1u);
+
+	if (p_slot != l_last)
+	{
+		p_list.entities[p_slot] = p_list.entities[l_last];
+		p_list.counterpartSlots[p_slot] = p_list.counterpartSlots[l_last];
+
+		//counterpart holds the other side of relation, so its list exists
+		p_counterpartLists.find(p_list.entities[p_slot])->second.counterpartSlots[p_list.counterpartSlots[p_slot]] = p_slot;
+	}
+
+	p_list.entities.pop_back();
+	p_list.counterpartSlots.pop_back();
+}
+
+void RelationStore::erase(RelationType p_type, EntityId p_source, u32 p_targetSlot)
+{
+	auto& l_targets = targets(p_type).find(p_source)->second;
+	const auto l_target = l_targets.entities[p_targetSlot];
+	const auto l_sourceSlot = l_targets.counterpartSlots[p_targetSlot];
+
+	erase(l_targets, p_targetSlot, sources(p_type));
+	erase(sources(p_type).find(l_target)->second, l_sourceSlot, targets(p_type));
+
+	--m_size;
+}
+
+RelationStore::RelationLists& RelationStore::targets(RelationType p_type)
+{
+	return m_targets[static_cast<u32>(p_type)];
+}
+
+RelationStore::RelationLists& RelationStore::sources(RelationType p_type)
+{
+	return m_sources[static_cast<u32>(p_type)];
+}
+
+}
@@ -0,0 +1,18 @@
+#include "ResourceStore.h"
+#include <algorithm>
+
+namespace engine
+{
+
+ResourceStore::ResourceStore(std::pmr::memory_resource& p_memoryResource)
+	:m_resources(&p_memoryResource)
+{
+}
+
+u32 ResourceStore::size() const
+{
+	return static_cast<u32>(std::count_if(m_resources.begin(), m_resources.end(),
+										  [](const ResourcePtr& p_resource){ return p_resource != nullptr; }));
+}
+
+}
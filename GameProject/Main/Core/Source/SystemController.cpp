@@ -0,0 +1,76 @@
+#include "SystemController.h"
+#include <algorithm>
+#include "Profiler.h"
+
+namespace engine
+{
+
+void SystemController::addSystem(ISystem& p_system, s32 p_priority)
+{
+	//after all systems with the same priority - keeps registration order
+	auto l_position = std::upper_bound(m_systems.begin(), m_systems.end(), p_priority,
+		[](s32 p_value, const ScheduledSystem& p_scheduled) { return p_value < p_scheduled.priority; });
+
+	m_systems.insert(l_position, { &p_system, p_priority });
+}
+
+bool SystemController::removeSystem(ISystem& p_system)
+{
+	auto l_iter = std::find_if(m_systems.begin(), m_systems.end(),
+		[&p_system](const ScheduledSystem& p_scheduled) { return p_scheduled.system == &p_system; });
+
+	if (l_iter == m_systems.end())
+	{
+		return false;
+	}
+
+	m_systems.erase(l_iter);
+	return true;
+}
+
+void SystemController::update(f32 p_deltaTime)
+{
+	ENGINE_PROFILE_ZONE("SystemController::update");
+
+	for (auto& l_scheduled : m_systems)
+	{
+		ENGINE_PROFILE_ZONE(l_scheduled.system->getName());
+		l_scheduled.system->update(p_deltaTime);
+	}
+}
+
+u32 SystemController::getNumOfSystems() const
+{
+	return static_cast<u32>(m_systems.size());
+}
+
+/*
+	Greedy split of update order - system starts new batch when it conflicts with any system
+	of the current one, so every conflicting pair still runs in registration/priority order.
+*/
+
+std::vector<std::vector<ISystem*>> SystemController::getParallelBatches() const
+{
+	std::vector<std::vector<ISystem*>> l_batches;
+	std::vector<ResourceAccess> l_batchAccess;
+
+	for (auto& l_scheduled : m_systems)
+	{
+		const auto l_access = l_scheduled.system->getResourceAccess();
+		const auto l_conflicts = std::any_of(l_batchAccess.begin(), l_batchAccess.end(),
+			[&l_access](const ResourceAccess& p_access) { return p_access.conflictsWith(l_access); });
+
+		if (l_batches.empty() or l_conflicts)
+		{
+			l_batches.emplace_back();
+			l_batchAccess.clear();
+		}
+
+		l_batches.back().push_back(l_scheduled.system);
+		l_batchAccess.push_back(l_access);
+	}
+
+	return l_batches;
+}
+
+}
@@ -0,0 +1,121 @@
+#include "ThreadPool.h"
+#include <chrono>
+#include "assert.h"
+
+namespace engine
+{
+
+namespace
+{
+	//yields before worker goes to sleep - covers gaps between parallel passes of one frame
+	constexpr u32 SPIN_COUNT = 2000u;
+	//sleeping worker re-checks generation at least this often, even without notification
+	constexpr std::chrono::milliseconds SLEEP_SLICE{ 10 };
+}
+
+ThreadPool::ThreadPool(u32 p_nrOfWorkers)
+{
+	m_workers.reserve(p_nrOfWorkers);
+
+	for (auto i = 0u; i < p_nrOfWorkers; i++)
+	{
+		m_workers.emplace_back(&ThreadPool::work, this, i + 1u);
+	}
+}
+
+ThreadPool::~ThreadPool()
+{
+	{
+		std::lock_guard<std::mutex> l_lock(m_mutex);
+		m_stopRequested = true;
+		m_generation.fetch_add(1u, std::memory_order_release);
+	}
+
+	m_wakeUp.notify_all();
+
+	for (auto& l_worker : m_workers)
+	{
+		l_worker.join();
+	}
+}
+
+u32 ThreadPool::getNrOfThreads() const
+{
+	return static_cast<u32>(m_workers.size()) + 1u;
+}
+
+void ThreadPool::run(u32 p_nrOfTasks, const Task& p_task)
+{
+	assert(p_nrOfTasks <= getNrOfThreads());
+
+	if (p_nrOfTasks == 0u)
+	{
+		return;
+	}
+
+	if (p_nrOfTasks > 1u)
+	{
+		{
+			std::lock_guard<std::mutex> l_lock(m_mutex);
+			m_task = &p_task;
+			m_nrOfTasks = p_nrOfTasks;
+			m_nrOfPendingTasks.store(p_nrOfTasks - 1u, std::memory_order_relaxed);
+			m_generation.fetch_add(1u, std::memory_order_release);
+		}
+
+		m_wakeUp.notify_all();
+	}
+
+	p_task(0u);
+
+	while (m_nrOfPendingTasks.load(std::memory_order_acquire) != 0u)
+	{
+		std::this_thread::yield();
+	}
+}
+
+void ThreadPool::work(u32 p_taskIndex)
+{
+	u64 l_generation = 0u;
+	const Task* l_task = nullptr;
+	u32 l_nrOfTasks = 0u;
+
+	while (waitForRun(l_generation, l_task, l_nrOfTasks))
+	{
+		//workers without task in this run skip it - run() does not wait for them
+		if (p_taskIndex < l_nrOfTasks)
+		{
+			(*l_task)(p_taskIndex);
+			m_nrOfPendingTasks.fetch_sub(1u, std::memory_order_release);
+		}
+	}
+}
+
+/*
+	Worker which had a task could not miss any run - run() waits for it. Worker without a task may
+	see a newer generation than the one it waited for, then it takes the newest run, which is correct
+	as it had nothing to do in the skipped one.
+*/
+
+bool ThreadPool::waitForRun(u64& p_generation, const Task*& p_task, u32& p_nrOfTasks)
+{
+	for (auto i = 0u; i < SPIN_COUNT and m_generation.load(std::memory_order_acquire) == p_generation; i++)
+	{
+		std::this_thread::yield();
+	}
+
+	std::unique_lock<std::mutex> l_lock(m_mutex);
+
+	while (m_generation.load(std::memory_order_relaxed) == p_generation)
+	{
+		m_wakeUp.wait_for(l_lock, SLEEP_SLICE);
+	}
+
+	p_generation = m_generation.load(std::memory_order_relaxed);
+	p_task = m_task;
+	p_nrOfTasks = m_nrOfTasks;
+
+	return not m_stopRequested;
+}
+
+}
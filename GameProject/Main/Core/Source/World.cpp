@@ -0,0 +1,111 @@
+#include "World.h"
+#include "ComponentController.h"
+#include "IdGuard.h"
+
+namespace engine
+{
+
+namespace
+{
+//ownership goes to entity controller, world keeps only raw pointers for snapshots and metrics
+std::unique_ptr<IEntityPool> createEntityPool(PoolSize p_capacity, std::pmr::memory_resource& p_memoryResource,
+											  EntityPool*& p_pool, IdGuard*& p_idGuard)
+{
+	auto l_idGuard = std::make_unique<IdGuard>(p_capacity, p_memoryResource);
+	p_idGuard = l_idGuard.get();
+
+	auto l_pool = std::make_unique<EntityPool>(p_capacity, std::move(l_idGuard), p_memoryResource);
+	p_pool = l_pool.get();
+
+	return l_pool;
+}
+
+std::unique_ptr<ComponentController> createComponentController(std::unique_ptr<IComponentProvider> p_provider,
+															   ComponentObservers& p_observers)
+{
+	auto l_controller = std::make_unique<ComponentController>(std::move(p_provider));
+	l_controller->attachObservers(p_observers);
+
+	return l_controller;
+}
+}
+
+World::World(std::unique_ptr<IComponentProvider> p_componentProvider,
+			 const WorldSettings& p_settings,
+			 std::pmr::memory_resource& p_upstream)
+	:m_settings(p_settings),
+	 m_memoryResource(&p_upstream),
+	 m_changeDistributor(m_memoryResource),
+	 m_observers(m_memoryResource),
+	 m_relations(p_settings.maxNrOfEntities, m_memoryResource),
+	 m_resources(m_memoryResource),
+	 m_events(p_settings.nrOfEventThreads, m_memoryResource),
+	 m_entityPool(nullptr),
+	 m_idGuard(nullptr),
+	 m_entityController(createEntityPool(p_settings.maxNrOfEntities, m_memoryResource, m_entityPool, m_idGuard),
+						createComponentController(std::move(p_componentProvider), m_observers),
+						m_changeDistributor)
+{
+	m_entityController.attachRelations(m_relations);
+}
+
+EntityController& World::getEntityController()
+{
+	return m_entityController;
+}
+
+EntityPool& World::getEntityPool()
+{
+	return *m_entityPool;
+}
+
+EntityChangeDistributor& World::getChangeDistributor()
+{
+	return m_changeDistributor;
+}
+
+ComponentObservers& World::getObservers()
+{
+	return m_observers;
+}
+
+RelationStore& World::getRelations()
+{
+	return m_relations;
+}
+
+ResourceStore& World::getResources()
+{
+	return m_resources;
+}
+
+EventBus& World::getEvents()
+{
+	return m_events;
+}
+
+SystemController& World::getSystems()
+{
+	return m_systems;
+}
+
+const WorldSettings& World::getSettings() const
+{
+	return m_settings;
+}
+
+void World::attachMetrics(MetricsRegistry& p_registry, const std::string& p_prefix)
+{
+	m_entityPool->getEntities().attachMetrics(p_registry, p_prefix + ".entityPool");
+	m_idGuard->attachMetrics(p_registry, p_prefix + ".ids");
+	m_entityController.attachMetrics(p_registry, p_prefix + ".entities");
+	m_changeDistributor.attachMetrics(p_registry, p_prefix + ".changes");
+}
+
+void World::step(f32 p_deltaTime)
+{
+	m_systems.update(p_deltaTime);
+	m_events.swapBuffers();
+}
+
+}
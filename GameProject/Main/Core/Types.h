@@ -35,5 +35,11 @@ namespace engine
 	using s32 = signed int;
 	using u32 = unsigned int;
 
+	using s64 = signed long long;
+	using u64 = unsigned long long;
+
+	using f32 = float;
+	using f64 = double;
+
 	using ComponentIndex = u8;
 };
\ No newline at end of file
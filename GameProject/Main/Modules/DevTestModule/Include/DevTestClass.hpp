@@ -1,6 +1,6 @@
 #pragma once
-#include <SFML\Graphics.hpp>
-#include <Box2D\Box2D.h>
+#include <SFML/Graphics.hpp>
+#include <Box2D/Box2D.h>
 
 class DevTestClass
 {
@@ -0,0 +1,22 @@
+#pragma once
+#include "Types.h"
+
+namespace engine
+{
+
+struct PhysicsSettings
+{
+	f32 fixedTimeStep = 1.0f / 60.0f;
+	u32 maxStepsPerUpdate = 5u;
+
+	s32 velocityIterations = 8;
+	s32 positionIterations = 3;
+
+	f32 gravityX = 0.0f;
+	f32 gravityY = -10.0f;
+
+	f32 bodyHalfExtent = 0.5f;
+	f32 bodyDensity = 1.0f;
+};
+
+}
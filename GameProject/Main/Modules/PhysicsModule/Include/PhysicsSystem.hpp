@@ -0,0 +1,77 @@
+#pragma once
+#include <vector>
+#include <Box2D/Box2D.h>
+#include "System.h"
+#include "IEntityController.h"
+#include "IEntityChangeListener.h"
+#include "TransformStore.h"
+#include "PositionComponent.h"
+#include "PhysicsSettings.hpp"
+
+namespace engine
+{
+
+/*
+	Bridge between ECS and Box2D.
+	Entity gets a body when it has POSITION + PHYSICS (dynamic if MOVABLE is attached too, static otherwise)
+	and loses it when any of them is detached.
+	World is stepped with fixed time step; positions written back to POSITION components and TransformStore
+	are interpolated between last two steps. Bodies are kept in dense arrays together with pointers
+	to their POSITION components, so write back is a single loop without virtual calls.
+	Transform created for entity without one is owned by the system and released with its POSITION or entity.
+*/
+
+class PhysicsSystem : public System, public IEntityChangeListener
+{
+public:
+	static constexpr u32 NO_BODY = ~0u;
+
+	PhysicsSystem(IEntityController&, TransformStore&, const PhysicsSettings& = PhysicsSettings());
+	PhysicsSystem(const PhysicsSystem&) = delete;
+	~PhysicsSystem();
+
+	void update(f32 p_deltaTime) override;
+	const char* getName() const override;
+	void onEntityChange(EntityId) override;
+
+	bool hasBody(EntityId) const;
+	b2Body* getBody(EntityId);
+	u32 getNumOfBodies() const;
+
+	f32 getInterpolationAlpha() const;
+	u32 getNumOfStepsInLastUpdate() const;
+
+	b2World& getWorld();
+
+private:
+	bool requiresBody(const Entity&) const;
+	bool isDynamic(const Entity&) const;
+
+	void createBody(const Entity&);
+	void destroyBody(EntityId);
+	bool ensureTransformExists(const Entity&);
+	void releaseOwnedTransform(EntityId);
+	static PositionComponent* findPositionComponent(const Entity&);
+
+	void step();
+	void storePreviousPositions();
+	void writeBackInterpolatedPositions();
+
+	IEntityController& m_entityController;
+	TransformStore& m_transforms;
+	const PhysicsSettings m_settings;
+
+	b2World m_world;
+	f32 m_accumulator = 0.0f;
+	u32 m_stepsInLastUpdate = 0u;
+
+	std::vector<b2Body*> m_bodies;
+	std::vector<EntityId> m_bodyOwners;
+	std::vector<f32> m_previousX;
+	std::vector<f32> m_previousY;
+	std::vector<PositionComponent*> m_positionComponents;
+	std::vector<u32> m_bodyIndices;
+	std::vector<bool> m_ownedTransforms;
+};
+
+}
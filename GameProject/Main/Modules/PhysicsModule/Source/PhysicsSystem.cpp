@@ -0,0 +1,272 @@
+#include "PhysicsSystem.hpp"
+#include <cmath>
+#include <cstdint>
+
+namespace engine
+{
+
+PhysicsSystem::PhysicsSystem(IEntityController& p_entityController,
+							 TransformStore& p_transforms,
+							 const PhysicsSettings& p_settings)
+	:m_entityController(p_entityController),
+	 m_transforms(p_transforms),
+	 m_settings(p_settings),
+	 m_world(b2Vec2(p_settings.gravityX, p_settings.gravityY)),
+	 m_bodyIndices(p_transforms.capacity() + 1u, NO_BODY),
+	 m_ownedTransforms(p_transforms.capacity() + 1u, false)
+{
+	m_bodies.reserve(p_transforms.capacity());
+	m_bodyOwners.reserve(p_transforms.capacity());
+	m_previousX.reserve(p_transforms.capacity());
+	m_previousY.reserve(p_transforms.capacity());
+	m_positionComponents.reserve(p_transforms.capacity());
+}
+
+PhysicsSystem::~PhysicsSystem()
+{
+	//bodies are released together with m_world
+}
+
+void PhysicsSystem::update(f32 p_deltaTime)
+{
+	m_accumulator += p_deltaTime;
+	m_stepsInLastUpdate = 0u;
+
+	while (m_accumulator >= m_settings.fixedTimeStep and m_stepsInLastUpdate < m_settings.maxStepsPerUpdate)
+	{
+		step();
+		m_accumulator -= m_settings.fixedTimeStep;
+		m_stepsInLastUpdate++;
+	}
+
+	if (m_accumulator >= m_settings.fixedTimeStep)
+	{
+		//too much time to catch up - drop it instead of spiralling
+		m_accumulator = std::fmod(m_accumulator, m_settings.fixedTimeStep);
+	}
+
+	writeBackInterpolatedPositions();
+}
+
+const char* PhysicsSystem::getName() const
+{
+	return "PhysicsSystem";
+}
+
+void PhysicsSystem::step()
+{
+	storePreviousPositions();
+	m_world.Step(m_settings.fixedTimeStep, m_settings.velocityIterations, m_settings.positionIterations);
+}
+
+void PhysicsSystem::storePreviousPositions()
+{
+	const auto l_nrOfBodies = getNumOfBodies();
+
+	for (auto i = 0u; i < l_nrOfBodies; i++)
+	{
+		const auto& l_position = m_bodies[i]->GetPosition();
+		m_previousX[i] = l_position.x;
+		m_previousY[i] = l_position.y;
+	}
+}
+
+void PhysicsSystem::writeBackInterpolatedPositions()
+{
+	const auto l_alpha = getInterpolationAlpha();
+	const auto l_nrOfBodies = getNumOfBodies();
+
+	auto l_positionsX = m_transforms.positionsX();
+	auto l_positionsY = m_transforms.positionsY();
+
+	for (auto i = 0u; i < l_nrOfBodies; i++)
+	{
+		const auto& l_current = m_bodies[i]->GetPosition();
+		const auto l_x = m_previousX[i] + (l_current.x - m_previousX[i]) * l_alpha;
+		const auto l_y = m_previousY[i] + (l_current.y - m_previousY[i]) * l_alpha;
+
+		if (auto l_position = m_positionComponents[i])
+		{
+			l_position->x = l_x;
+			l_position->y = l_y;
+		}
+
+		//transform may have been removed by other system in the meantime
+		const auto l_transformIndex = m_transforms.getIndex(m_bodyOwners[i]);
+		if (l_transformIndex != TransformStore::INVALID_INDEX)
+		{
+			l_positionsX[l_transformIndex] = l_x;
+			l_positionsY[l_transformIndex] = l_y;
+		}
+	}
+}
+
+void PhysicsSystem::onEntityChange(EntityId p_id)
+{
+	if (not m_entityController.hasEntity(p_id))
+	{
+		destroyBody(p_id);
+		releaseOwnedTransform(p_id);
+		return;
+	}
+
+	const auto& l_entity = m_entityController.getEntity(p_id);
+	const auto l_requiresBody = requiresBody(l_entity);
+
+	if (l_requiresBody and not hasBody(p_id))
+	{
+		createBody(l_entity);
+	}
+	else if (not l_requiresBody and hasBody(p_id))
+	{
+		destroyBody(p_id);
+	}
+	else if (l_requiresBody)
+	{
+		getBody(p_id)->SetType(isDynamic(l_entity) ? b2_dynamicBody : b2_staticBody);
+		m_positionComponents[m_bodyIndices[p_id]] = findPositionComponent(l_entity);
+	}
+
+	if (not l_entity.attachedComponents.isSet(ComponentType::POSITION))
+	{
+		releaseOwnedTransform(p_id);
+	}
+}
+
+bool PhysicsSystem::requiresBody(const Entity& p_entity) const
+{
+	return p_entity.attachedComponents.isSet(ComponentType::POSITION) and
+		   p_entity.attachedComponents.isSet(ComponentType::PHYSICS);
+}
+
+bool PhysicsSystem::isDynamic(const Entity& p_entity) const
+{
+	return p_entity.attachedComponents.isSet(ComponentType::MOVABLE);
+}
+
+void PhysicsSystem::createBody(const Entity& p_entity)
+{
+	if (not ensureTransformExists(p_entity))
+	{
+		return;
+	}
+
+	const auto l_transformIndex = m_transforms.getIndex(p_entity.id);
+
+	b2BodyDef l_bodyDef;
+	l_bodyDef.type = isDynamic(p_entity) ? b2_dynamicBody : b2_staticBody;
+	l_bodyDef.position.Set(m_transforms.positionsX()[l_transformIndex], m_transforms.positionsY()[l_transformIndex]);
+	l_bodyDef.userData = reinterpret_cast<void*>(static_cast<std::uintptr_t>(p_entity.id));
+
+	auto l_body = m_world.CreateBody(&l_bodyDef);
+
+	b2PolygonShape l_shape;
+	l_shape.SetAsBox(m_settings.bodyHalfExtent, m_settings.bodyHalfExtent);
+	l_body->CreateFixture(&l_shape, m_settings.bodyDensity);
+
+	m_bodyIndices[p_entity.id] = getNumOfBodies();
+	m_bodies.push_back(l_body);
+	m_bodyOwners.push_back(p_entity.id);
+	m_previousX.push_back(l_bodyDef.position.x);
+	m_previousY.push_back(l_bodyDef.position.y);
+	m_positionComponents.push_back(findPositionComponent(p_entity));
+}
+
+bool PhysicsSystem::ensureTransformExists(const Entity& p_entity)
+{
+	if (m_transforms.has(p_entity.id))
+	{
+		return true;
+	}
+
+	const auto l_position = findPositionComponent(p_entity);
+	const auto l_added = l_position ? m_transforms.add(p_entity.id, l_position->x, l_position->y)
+									: m_transforms.add(p_entity.id, 0.0f, 0.0f);
+
+	m_ownedTransforms[p_entity.id] = l_added;
+	return l_added;
+}
+
+void PhysicsSystem::releaseOwnedTransform(EntityId p_id)
+{
+	if (p_id < m_ownedTransforms.size() and m_ownedTransforms[p_id])
+	{
+		m_transforms.remove(p_id);
+		m_ownedTransforms[p_id] = false;
+	}
+}
+
+PositionComponent* PhysicsSystem::findPositionComponent(const Entity& p_entity)
+{
+	for (auto l_component = p_entity.components; l_component != nullptr; l_component = l_component->nextComponent)
+	{
+		if (l_component->type == ComponentType::POSITION)
+		{
+			return static_cast<PositionComponent*>(l_component);
+		}
+	}
+
+	return nullptr;
+}
+
+void PhysicsSystem::destroyBody(EntityId p_id)
+{
+	if (not hasBody(p_id))
+	{
+		return;
+	}
+
+	const auto l_removedIndex = m_bodyIndices[p_id];
+	const auto l_lastIndex = getNumOfBodies() - 1u;
+
+	m_world.DestroyBody(m_bodies[l_removedIndex]);
+
+	if (l_removedIndex != l_lastIndex)
+	{
+		m_bodies[l_removedIndex] = m_bodies[l_lastIndex];
+		m_bodyOwners[l_removedIndex] = m_bodyOwners[l_lastIndex];
+		m_previousX[l_removedIndex] = m_previousX[l_lastIndex];
+		m_previousY[l_removedIndex] = m_previousY[l_lastIndex];
+		m_positionComponents[l_removedIndex] = m_positionComponents[l_lastIndex];
+		m_bodyIndices[m_bodyOwners[l_removedIndex]] = l_removedIndex;
+	}
+
+	m_bodies.pop_back();
+	m_bodyOwners.pop_back();
+	m_previousX.pop_back();
+	m_previousY.pop_back();
+	m_positionComponents.pop_back();
+	m_bodyIndices[p_id] = NO_BODY;
+}
+
+bool PhysicsSystem::hasBody(EntityId p_id) const
+{
+	return p_id < m_bodyIndices.size() and m_bodyIndices[p_id] != NO_BODY;
+}
+
+b2Body* PhysicsSystem::getBody(EntityId p_id)
+{
+	return hasBody(p_id) ? m_bodies[m_bodyIndices[p_id]] : nullptr;
+}
+
+u32 PhysicsSystem::getNumOfBodies() const
+{
+	return static_cast<u32>(m_bodies.size());
+}
+
+f32 PhysicsSystem::getInterpolationAlpha() const
+{
+	return m_accumulator / m_settings.fixedTimeStep;
+}
+
+u32 PhysicsSystem::getNumOfStepsInLastUpdate() const
+{
+	return m_stepsInLastUpdate;
+}
+
+b2World& PhysicsSystem::getWorld()
+{
+	return m_world;
+}
+
+}
@@ -0,0 +1,106 @@
+#pragma once
+#include <vector>
+#include "System.h"
+#include "IEntityController.h"
+#include "IEntityChangeListener.h"
+#include "ComponentIndicators.h"
+#include "TransformStore.h"
+
+namespace engine
+{
+
+enum class OverlapEventType : u8
+{
+	BEGIN,
+	END
+};
+
+struct OverlapEvent
+{
+	EntityId first;
+	EntityId second;
+	OverlapEventType type;
+};
+
+struct BroadphaseSettings
+{
+	BroadphaseSettings()
+	{
+		requiredComponents.set(ComponentType::POSITION);
+	}
+
+	ComponentIndicators requiredComponents;
+	f32 defaultHalfExtent = 0.5f;
+};
+
+/*
+	Sort and sweep broadphase for cheap overlap detection (triggers etc.).
+	Entity takes part when it has all requiredComponents; membership follows entity change notifications.
+	Bounds (position from TransformStore +/- half extents) are kept in SoA arrays.
+	Order of proxies along X axis is kept between frames and repaired with insertion sort -
+	with frame coherence it is close to linear. Removed proxy only leaves empty slot in that order (O(1)),
+	empty slots are squeezed out at the beginning of next sort.
+	Each update fills event buffer with BEGIN/END events of pairs which started/stopped overlapping.
+	Pair is reported with lower entity id as first.
+*/
+
+class BroadphaseSystem : public System, public IEntityChangeListener
+{
+public:
+	BroadphaseSystem(IEntityController&, const TransformStore&, const BroadphaseSettings& = BroadphaseSettings());
+	BroadphaseSystem(const BroadphaseSystem&) = delete;
+
+	void update(f32 p_deltaTime) override;
+	const char* getName() const override;
+	void onEntityChange(EntityId) override;
+
+	bool isTracked(EntityId) const;
+	u32 getNumOfProxies() const;
+	void setHalfExtents(EntityId, f32 p_halfWidth, f32 p_halfHeight);
+
+	const std::vector<OverlapEvent>& getEvents() const;
+	u32 getNumOfOverlappingPairs() const;
+
+private:
+	using PairKey = unsigned long long;
+	static constexpr u32 NO_PROXY = ~0u;
+
+	static PairKey makePairKey(EntityId, EntityId);
+	static EntityId getFirst(PairKey);
+	static EntityId getSecond(PairKey);
+
+	bool meetsRequirements(EntityId) const;
+	void createProxy(EntityId);
+	void destroyProxy(EntityId);
+
+	void updateBounds();
+	void removeEmptySortedSlots();
+	void sortProxiesAlongX();
+	void findOverlappingPairs();
+	void emitEvents();
+
+	IEntityController& m_entityController;
+	const TransformStore& m_transforms;
+	const BroadphaseSettings m_settings;
+
+	std::vector<u32> m_proxyIndices;
+	std::vector<EntityId> m_proxyEntities;
+	std::vector<f32> m_halfWidths;
+	std::vector<f32> m_halfHeights;
+
+	std::vector<f32> m_minX;
+	std::vector<f32> m_maxX;
+	std::vector<f32> m_minY;
+	std::vector<f32> m_maxY;
+
+	std::vector<u32> m_sortedProxies;
+	//position of every proxy in m_sortedProxies
+	std::vector<u32> m_sortedSlots;
+	u32 m_nrOfEmptySortedSlots = 0u;
+
+	std::vector<PairKey> m_currentPairs;
+	std::vector<PairKey> m_previousPairs;
+	std::vector<OverlapEvent> m_events;
+};
+
+}
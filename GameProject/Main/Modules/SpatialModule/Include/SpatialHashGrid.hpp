@@ -0,0 +1,103 @@
+#pragma once
+#include <vector>
+#include "System.h"
+#include "IEntityController.h"
+#include "IEntityChangeListener.h"
+#include "TransformStore.h"
+
+namespace engine
+{
+
+struct SpatialGridSettings
+{
+	f32 cellSize = 4.0f;
+	u32 nrOfBuckets = 16384u; //has to be power of two
+};
+
+/*
+	Uniform grid over POSITION entities, cells hashed into fixed number of buckets.
+	Set of tracked entities follows POSITION attach/detach; positions are read from TransformStore.
+	update() rebuilds flat bucket ranges with counting sort:
+		m_bucketStarts[b] .. m_bucketStarts[b + 1] -> range of m_sorted* arrays belonging to bucket b
+	Each sorted element keeps its cell coordinates, so hash collisions and duplicates are filtered out during queries.
+	Queries see positions from the last rebuild.
+*/
+
+class SpatialHashGrid : public System, public IEntityChangeListener
+{
+public:
+	static constexpr u32 MAX_K = 64u;
+
+	SpatialHashGrid(IEntityController&, const TransformStore&, const SpatialGridSettings& = SpatialGridSettings());
+	SpatialHashGrid(const SpatialHashGrid&) = delete;
+
+	void update(f32 p_deltaTime) override;
+	const char* getName() const override;
+	void onEntityChange(EntityId) override;
+
+	void rebuild();
+
+	bool isTracked(EntityId) const;
+	u32 getNumOfTrackedEntities() const;
+	u32 getNumOfIndexedEntities() const;
+
+	void queryRadius(f32 p_x, f32 p_y, f32 p_radius, std::vector<EntityId>& p_result) const;
+	void queryAabb(f32 p_minX, f32 p_minY, f32 p_maxX, f32 p_maxY, std::vector<EntityId>& p_result) const;
+
+	/*
+		Batched k-nearest search. For query i, ids of up to p_k nearest entities (within p_maxRadius),
+		ordered from the closest one, are written to p_result[i * p_k .. i * p_k + p_k).
+		Missing entries are filled with UNDEFINED_ENTITY_ID. p_k can not exceed MAX_K.
+	*/
+	void queryKNearest(const f32* p_queriesX, const f32* p_queriesY, u32 p_nrOfQueries,
+					   u32 p_k, f32 p_maxRadius, EntityId* p_result) const;
+
+private:
+	static constexpr u32 NOT_TRACKED = ~0u;
+
+	//everything needed to test element during query - kept together to touch one cache line per element
+	struct GridElement
+	{
+		f32 x;
+		f32 y;
+		s32 cellX;
+		s32 cellY;
+	};
+
+	s32 toCell(f32 p_coordinate) const;
+	u32 getBucket(s32 p_cellX, s32 p_cellY) const;
+
+	void track(EntityId);
+	void untrack(EntityId);
+
+	void countElementsPerBucket();
+	void computeBucketStarts();
+	void scatterElementsToBuckets();
+
+	template<typename Visitor>
+	void visitCell(s32 p_cellX, s32 p_cellY, Visitor&& p_visitor) const;
+
+	void findKNearest(f32 p_x, f32 p_y, u32 p_k, f32 p_maxRadius, f32* p_distances, EntityId* p_result) const;
+
+	IEntityController& m_entityController;
+	const TransformStore& m_transforms;
+
+	const f32 m_cellSize;
+	const f32 m_inverseCellSize;
+	const u32 m_bucketMask;
+
+	std::vector<EntityId> m_trackedEntities;
+	std::vector<u32> m_trackedIndices;
+
+	std::vector<u32> m_bucketStarts;
+	std::vector<u32> m_bucketCursors;
+	std::vector<u32> m_elementBuckets;
+	std::vector<s32> m_elementCellsX;
+	std::vector<s32> m_elementCellsY;
+
+	u32 m_nrOfIndexed = 0u;
+	std::vector<GridElement> m_sortedElements;
+	std::vector<EntityId> m_sortedEntities;
+};
+
+}
@@ -0,0 +1,314 @@
+#include "BroadphaseSystem.hpp"
+#include <algorithm>
+
+namespace engine
+{
+
+namespace
+{
+	constexpr unsigned int ID_BITS = 32u;
+}
+
+BroadphaseSystem::BroadphaseSystem(IEntityController& p_entityController,
+								   const TransformStore& p_transforms,
+								   const BroadphaseSettings& p_settings)
+	:m_entityController(p_entityController),
+	 m_transforms(p_transforms),
+	 m_settings(p_settings),
+	 m_proxyIndices(p_transforms.capacity() + 1u, NO_PROXY)
+{
+	const auto l_capacity = p_transforms.capacity();
+
+	m_proxyEntities.reserve(l_capacity);
+	m_halfWidths.reserve(l_capacity);
+	m_halfHeights.reserve(l_capacity);
+	m_minX.reserve(l_capacity);
+	m_maxX.reserve(l_capacity);
+	m_minY.reserve(l_capacity);
+	m_maxY.reserve(l_capacity);
+	m_sortedProxies.reserve(l_capacity);
+	m_sortedSlots.reserve(l_capacity);
+}
+
+void BroadphaseSystem::update(f32)
+{
+	updateBounds();
+	sortProxiesAlongX();
+	findOverlappingPairs();
+	emitEvents();
+}
+
+const char* BroadphaseSystem::getName() const
+{
+	return "BroadphaseSystem";
+}
+
+void BroadphaseSystem::onEntityChange(EntityId p_id)
+{
+	const auto l_meetsRequirements = meetsRequirements(p_id);
+
+	if (l_meetsRequirements and not isTracked(p_id))
+	{
+		createProxy(p_id);
+	}
+	else if (not l_meetsRequirements and isTracked(p_id))
+	{
+		destroyProxy(p_id);
+	}
+}
+
+bool BroadphaseSystem::meetsRequirements(EntityId p_id) const
+{
+	if (not m_entityController.hasEntity(p_id))
+	{
+		return false;
+	}
+
+	const auto& l_attached = m_entityController.getEntity(p_id).attachedComponents;
+	return (l_attached & m_settings.requiredComponents) == m_settings.requiredComponents;
+}
+
+void BroadphaseSystem::createProxy(EntityId p_id)
+{
+	if (p_id >= m_proxyIndices.size())
+	{
+		return;
+	}
+
+	const auto l_proxy = getNumOfProxies();
+	m_proxyIndices[p_id] = l_proxy;
+
+	m_proxyEntities.push_back(p_id);
+	m_halfWidths.push_back(m_settings.defaultHalfExtent);
+	m_halfHeights.push_back(m_settings.defaultHalfExtent);
+	m_minX.push_back(0.0f);
+	m_maxX.push_back(0.0f);
+	m_minY.push_back(0.0f);
+	m_maxY.push_back(0.0f);
+
+	m_sortedSlots.push_back(static_cast<u32>(m_sortedProxies.size()));
+	m_sortedProxies.push_back(l_proxy);
+}
+
+void BroadphaseSystem::destroyProxy(EntityId p_id)
+{
+	const auto l_removedProxy = m_proxyIndices[p_id];
+	const auto l_lastProxy = getNumOfProxies() - 1u;
+
+	m_sortedProxies[m_sortedSlots[l_removedProxy]] = NO_PROXY;
+	m_nrOfEmptySortedSlots++;
+
+	if (l_removedProxy != l_lastProxy)
+	{
+		const auto l_movedEntity = m_proxyEntities[l_lastProxy];
+
+		m_proxyEntities[l_removedProxy] = l_movedEntity;
+		m_halfWidths[l_removedProxy] = m_halfWidths[l_lastProxy];
+		m_halfHeights[l_removedProxy] = m_halfHeights[l_lastProxy];
+		m_minX[l_removedProxy] = m_minX[l_lastProxy];
+		m_maxX[l_removedProxy] = m_maxX[l_lastProxy];
+		m_minY[l_removedProxy] = m_minY[l_lastProxy];
+		m_maxY[l_removedProxy] = m_maxY[l_lastProxy];
+		m_proxyIndices[l_movedEntity] = l_removedProxy;
+
+		m_sortedSlots[l_removedProxy] = m_sortedSlots[l_lastProxy];
+		m_sortedProxies[m_sortedSlots[l_removedProxy]] = l_removedProxy;
+	}
+
+	m_proxyEntities.pop_back();
+	m_halfWidths.pop_back();
+	m_halfHeights.pop_back();
+	m_minX.pop_back();
+	m_maxX.pop_back();
+	m_minY.pop_back();
+	m_maxY.pop_back();
+	m_sortedSlots.pop_back();
+
+	m_proxyIndices[p_id] = NO_PROXY;
+}
+
+bool BroadphaseSystem::isTracked(EntityId p_id) const
+{
+	return p_id < m_proxyIndices.size() and m_proxyIndices[p_id] != NO_PROXY;
+}
+
+u32 BroadphaseSystem::getNumOfProxies() const
+{
+	return static_cast<u32>(m_proxyEntities.size());
+}
+
+void BroadphaseSystem::setHalfExtents(EntityId p_id, f32 p_halfWidth, f32 p_halfHeight)
+{
+	if (isTracked(p_id))
+	{
+		m_halfWidths[m_proxyIndices[p_id]] = p_halfWidth;
+		m_halfHeights[m_proxyIndices[p_id]] = p_halfHeight;
+	}
+}
+
+void BroadphaseSystem::updateBounds()
+{
+	const auto l_positionsX = m_transforms.positionsX();
+	const auto l_positionsY = m_transforms.positionsY();
+	const auto l_nrOfProxies = getNumOfProxies();
+
+	for (auto i = 0u; i < l_nrOfProxies; i++)
+	{
+		const auto l_transformIndex = m_transforms.getIndex(m_proxyEntities[i]);
+
+		if (l_transformIndex == TransformStore::INVALID_INDEX)
+		{
+			//no position yet - keep proxy empty and out of the way
+			m_minX[i] = m_minY[i] = 1.0f;
+			m_maxX[i] = m_maxY[i] = -1.0f;
+			continue;
+		}
+
+		const auto l_x = l_positionsX[l_transformIndex];
+		const auto l_y = l_positionsY[l_transformIndex];
+
+		m_minX[i] = l_x - m_halfWidths[i];
+		m_maxX[i] = l_x + m_halfWidths[i];
+		m_minY[i] = l_y - m_halfHeights[i];
+		m_maxY[i] = l_y + m_halfHeights[i];
+	}
+}
+
+void BroadphaseSystem::removeEmptySortedSlots()
+{
+	if (m_nrOfEmptySortedSlots == 0u)
+	{
+		return;
+	}
+
+	auto l_nextSlot = 0u;
+
+	for (auto l_proxy : m_sortedProxies)
+	{
+		if (l_proxy != NO_PROXY)
+		{
+			m_sortedProxies[l_nextSlot] = l_proxy;
+			m_sortedSlots[l_proxy] = l_nextSlot++;
+		}
+	}
+
+	m_sortedProxies.resize(l_nextSlot);
+	m_nrOfEmptySortedSlots = 0u;
+}
+
+void BroadphaseSystem::sortProxiesAlongX()
+{
+	removeEmptySortedSlots();
+	const auto l_size = m_sortedProxies.size();
+
+	for (auto i = 1u; i < l_size; i++)
+	{
+		const auto l_proxy = m_sortedProxies[i];
+		const auto l_key = m_minX[l_proxy];
+		auto j = i;
+
+		while (j > 0u and m_minX[m_sortedProxies[j - 1u]] > l_key)
+		{
+			m_sortedProxies[j] = m_sortedProxies[j - 1u];
+			m_sortedSlots[m_sortedProxies[j]] = j;
+			j--;
+		}
+
+		m_sortedProxies[j] = l_proxy;
+		m_sortedSlots[l_proxy] = j;
+	}
+}
+
+void BroadphaseSystem::findOverlappingPairs()
+{
+	m_currentPairs.clear();
+	const auto l_size = m_sortedProxies.size();
+
+	for (auto i = 0u; i < l_size; i++)
+	{
+		const auto l_first = m_sortedProxies[i];
+		const auto l_maxX = m_maxX[l_first];
+
+		if (l_maxX < m_minX[l_first])
+		{
+			continue;
+		}
+
+		for (auto j = i + 1u; j < l_size; j++)
+		{
+			const auto l_second = m_sortedProxies[j];
+
+			if (m_minX[l_second] > l_maxX)
+			{
+				break;
+			}
+
+			if (m_minY[l_second] <= m_maxY[l_first] and m_minY[l_first] <= m_maxY[l_second] and
+				m_minX[l_second] <= m_maxX[l_second])
+			{
+				m_currentPairs.push_back(makePairKey(m_proxyEntities[l_first], m_proxyEntities[l_second]));
+			}
+		}
+	}
+
+	std::sort(m_currentPairs.begin(), m_currentPairs.end());
+}
+
+void BroadphaseSystem::emitEvents()
+{
+	m_events.clear();
+
+	auto l_current = m_currentPairs.begin();
+	auto l_previous = m_previousPairs.begin();
+
+	while (l_current != m_currentPairs.end() or l_previous != m_previousPairs.end())
+	{
+		if (l_previous == m_previousPairs.end() or (l_current != m_currentPairs.end() and *l_current < *l_previous))
+		{
+			m_events.push_back({ getFirst(*l_current), getSecond(*l_current), OverlapEventType::BEGIN });
+			l_current++;
+		}
+		else if (l_current == m_currentPairs.end() or *l_previous < *l_current)
+		{
+			m_events.push_back({ getFirst(*l_previous), getSecond(*l_previous), OverlapEventType::END });
+			l_previous++;
+		}
+		else
+		{
+			l_current++;
+			l_previous++;
+		}
+	}
+
+	std::swap(m_currentPairs, m_previousPairs);
+}
+
+const std::vector<OverlapEvent>& BroadphaseSystem::getEvents() const
+{
+	return m_events;
+}
+
+u32 BroadphaseSystem::getNumOfOverlappingPairs() const
+{
+	return static_cast<u32>(m_previousPairs.size());
+}
+
+BroadphaseSystem::PairKey BroadphaseSystem::makePairKey(EntityId p_first, EntityId p_second)
+{
+	const auto l_lower = std::min(p_first, p_second);
+	const auto l_higher = std::max(p_first, p_second);
+
+	return (static_cast<PairKey>(l_lower) << ID_BITS) | l_higher;
+}
+
+EntityId BroadphaseSystem::getFirst(PairKey p_key)
+{
+	return static_cast<EntityId>(p_key >> ID_BITS);
+}
+
+EntityId BroadphaseSystem::getSecond(PairKey p_key)
+{
+	return static_cast<EntityId>(p_key);
+}
+
+}
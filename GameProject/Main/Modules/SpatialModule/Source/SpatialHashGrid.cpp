@@ -0,0 +1,336 @@
+#include "SpatialHashGrid.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cassert>
+
+namespace engine
+{
+
+namespace
+{
+	constexpr u32 HASH_PRIME_X = 73856093u;
+	constexpr u32 HASH_PRIME_Y = 19349663u;
+	constexpr u32 NO_BUCKET = ~0u;
+
+	[[maybe_unused]] bool isPowerOfTwo(u32 p_value)
+	{
+		return p_value != 0u and (p_value & (p_value - 1u)) == 0u;
+	}
+}
+
+SpatialHashGrid::SpatialHashGrid(IEntityController& p_entityController,
+								 const TransformStore& p_transforms,
+								 const SpatialGridSettings& p_settings)
+	:m_entityController(p_entityController),
+	 m_transforms(p_transforms),
+	 m_cellSize(p_settings.cellSize),
+	 m_inverseCellSize(1.0f / p_settings.cellSize),
+	 m_bucketMask(p_settings.nrOfBuckets - 1u),
+	 m_trackedIndices(p_transforms.capacity() + 1u, NOT_TRACKED),
+	 m_bucketStarts(p_settings.nrOfBuckets + 1u, 0u),
+	 m_bucketCursors(p_settings.nrOfBuckets, 0u),
+	 m_elementBuckets(p_transforms.capacity()),
+	 m_elementCellsX(p_transforms.capacity()),
+	 m_elementCellsY(p_transforms.capacity()),
+	 m_sortedElements(p_transforms.capacity()),
+	 m_sortedEntities(p_transforms.capacity())
+{
+	assert(isPowerOfTwo(p_settings.nrOfBuckets) && "Number of buckets has to be power of two!");
+	m_trackedEntities.reserve(p_transforms.capacity());
+}
+
+void SpatialHashGrid::update(f32)
+{
+	rebuild();
+}
+
+const char* SpatialHashGrid::getName() const
+{
+	return "SpatialHashGrid";
+}
+
+void SpatialHashGrid::onEntityChange(EntityId p_id)
+{
+	const auto l_hasPosition = m_entityController.hasEntity(p_id) and
+							   m_entityController.getEntity(p_id).attachedComponents.isSet(ComponentType::POSITION);
+
+	if (l_hasPosition and not isTracked(p_id))
+	{
+		track(p_id);
+	}
+	else if (not l_hasPosition and isTracked(p_id))
+	{
+		untrack(p_id);
+	}
+}
+
+void SpatialHashGrid::track(EntityId p_id)
+{
+	if (p_id < m_trackedIndices.size())
+	{
+		m_trackedIndices[p_id] = static_cast<u32>(m_trackedEntities.size());
+		m_trackedEntities.push_back(p_id);
+	}
+}
+
+void SpatialHashGrid::untrack(EntityId p_id)
+{
+	const auto l_removedIndex = m_trackedIndices[p_id];
+	const auto l_lastId = m_trackedEntities.back();
+
+	m_trackedEntities[l_removedIndex] = l_lastId;
+	m_trackedIndices[l_lastId] = l_removedIndex;
+
+	m_trackedEntities.pop_back();
+	m_trackedIndices[p_id] = NOT_TRACKED;
+}
+
+bool SpatialHashGrid::isTracked(EntityId p_id) const
+{
+	return p_id < m_trackedIndices.size() and m_trackedIndices[p_id] != NOT_TRACKED;
+}
+
+u32 SpatialHashGrid::getNumOfTrackedEntities() const
+{
+	return static_cast<u32>(m_trackedEntities.size());
+}
+
+u32 SpatialHashGrid::getNumOfIndexedEntities() const
+{
+	return m_nrOfIndexed;
+}
+
+s32 SpatialHashGrid::toCell(f32 p_coordinate) const
+{
+	return static_cast<s32>(std::floor(p_coordinate * m_inverseCellSize));
+}
+
+u32 SpatialHashGrid::getBucket(s32 p_cellX, s32 p_cellY) const
+{
+	return ((static_cast<u32>(p_cellX) * HASH_PRIME_X) ^ (static_cast<u32>(p_cellY) * HASH_PRIME_Y)) & m_bucketMask;
+}
+
+void SpatialHashGrid::rebuild()
+{
+	countElementsPerBucket();
+	computeBucketStarts();
+	scatterElementsToBuckets();
+}
+
+void SpatialHashGrid::countElementsPerBucket()
+{
+	std::fill(m_bucketCursors.begin(), m_bucketCursors.end(), 0u);
+
+	const auto l_positionsX = m_transforms.positionsX();
+	const auto l_positionsY = m_transforms.positionsY();
+	const auto l_nrOfTracked = getNumOfTrackedEntities();
+
+	m_nrOfIndexed = 0u;
+
+	for (auto i = 0u; i < l_nrOfTracked; i++)
+	{
+		const auto l_transformIndex = m_transforms.getIndex(m_trackedEntities[i]);
+
+		if (l_transformIndex == TransformStore::INVALID_INDEX)
+		{
+			m_elementBuckets[i] = NO_BUCKET;
+			continue;
+		}
+
+		const auto l_cellX = toCell(l_positionsX[l_transformIndex]);
+		const auto l_cellY = toCell(l_positionsY[l_transformIndex]);
+		const auto l_bucket = getBucket(l_cellX, l_cellY);
+
+		m_elementBuckets[i] = l_bucket;
+		m_elementCellsX[i] = l_cellX;
+		m_elementCellsY[i] = l_cellY;
+
+		m_bucketCursors[l_bucket]++;
+		m_nrOfIndexed++;
+	}
+}
+
+void SpatialHashGrid::computeBucketStarts()
+{
+	auto l_start = 0u;
+	const auto l_nrOfBuckets = static_cast<u32>(m_bucketCursors.size());
+
+	for (auto i = 0u; i < l_nrOfBuckets; i++)
+	{
+		const auto l_count = m_bucketCursors[i];
+		m_bucketStarts[i] = l_start;
+		m_bucketCursors[i] = l_start;
+		l_start += l_count;
+	}
+
+	m_bucketStarts[l_nrOfBuckets] = l_start;
+}
+
+void SpatialHashGrid::scatterElementsToBuckets()
+{
+	const auto l_positionsX = m_transforms.positionsX();
+	const auto l_positionsY = m_transforms.positionsY();
+	const auto l_nrOfTracked = getNumOfTrackedEntities();
+
+	for (auto i = 0u; i < l_nrOfTracked; i++)
+	{
+		const auto l_bucket = m_elementBuckets[i];
+
+		if (l_bucket == NO_BUCKET)
+		{
+			continue;
+		}
+
+		const auto l_id = m_trackedEntities[i];
+		const auto l_transformIndex = m_transforms.getIndex(l_id);
+		const auto l_target = m_bucketCursors[l_bucket]++;
+
+		m_sortedEntities[l_target] = l_id;
+		m_sortedElements[l_target] = { l_positionsX[l_transformIndex], l_positionsY[l_transformIndex],
+									   m_elementCellsX[i], m_elementCellsY[i] };
+	}
+}
+
+template<typename Visitor>
+void SpatialHashGrid::visitCell(s32 p_cellX, s32 p_cellY, Visitor&& p_visitor) const
+{
+	const auto l_bucket = getBucket(p_cellX, p_cellY);
+	const auto l_end = m_bucketStarts[l_bucket + 1u];
+
+	for (auto i = m_bucketStarts[l_bucket]; i < l_end; i++)
+	{
+		const auto& l_element = m_sortedElements[i];
+
+		if (l_element.cellX == p_cellX and l_element.cellY == p_cellY)
+		{
+			p_visitor(i, l_element);
+		}
+	}
+}
+
+void SpatialHashGrid::queryRadius(f32 p_x, f32 p_y, f32 p_radius, std::vector<EntityId>& p_result) const
+{
+	const auto l_radiusSquared = p_radius * p_radius;
+	const auto l_minCellX = toCell(p_x - p_radius);
+	const auto l_maxCellX = toCell(p_x + p_radius);
+	const auto l_minCellY = toCell(p_y - p_radius);
+	const auto l_maxCellY = toCell(p_y + p_radius);
+
+	for (auto l_cellY = l_minCellY; l_cellY <= l_maxCellY; l_cellY++)
+	{
+		for (auto l_cellX = l_minCellX; l_cellX <= l_maxCellX; l_cellX++)
+		{
+			visitCell(l_cellX, l_cellY, [&](u32 p_index, const GridElement& p_element)
+			{
+				const auto l_dx = p_element.x - p_x;
+				const auto l_dy = p_element.y - p_y;
+
+				if (l_dx * l_dx + l_dy * l_dy <= l_radiusSquared)
+				{
+					p_result.push_back(m_sortedEntities[p_index]);
+				}
+			});
+		}
+	}
+}
+
+void SpatialHashGrid::queryAabb(f32 p_minX, f32 p_minY, f32 p_maxX, f32 p_maxY, std::vector<EntityId>& p_result) const
+{
+	const auto l_minCellX = toCell(p_minX);
+	const auto l_maxCellX = toCell(p_maxX);
+	const auto l_minCellY = toCell(p_minY);
+	const auto l_maxCellY = toCell(p_maxY);
+
+	for (auto l_cellY = l_minCellY; l_cellY <= l_maxCellY; l_cellY++)
+	{
+		for (auto l_cellX = l_minCellX; l_cellX <= l_maxCellX; l_cellX++)
+		{
+			visitCell(l_cellX, l_cellY, [&](u32 p_index, const GridElement& p_element)
+			{
+				if (p_element.x >= p_minX and p_element.x <= p_maxX and p_element.y >= p_minY and p_element.y <= p_maxY)
+				{
+					p_result.push_back(m_sortedEntities[p_index]);
+				}
+			});
+		}
+	}
+}
+
+void SpatialHashGrid::queryKNearest(const f32* p_queriesX, const f32* p_queriesY, u32 p_nrOfQueries,
+									u32 p_k, f32 p_maxRadius, EntityId* p_result) const
+{
+	assert(p_k <= MAX_K && "Too many neighbours requested!");
+
+	if (p_k == 0u)
+	{
+		return;
+	}
+
+	f32 l_distances[MAX_K];
+
+	for (auto i = 0u; i < p_nrOfQueries; i++)
+	{
+		findKNearest(p_queriesX[i], p_queriesY[i], p_k, p_maxRadius, l_distances, p_result + i * p_k);
+	}
+}
+
+void SpatialHashGrid::findKNearest(f32 p_x, f32 p_y, u32 p_k, f32 p_maxRadius, f32* p_distances, EntityId* p_result) const
+{
+	const auto l_maxRadiusSquared = p_maxRadius * p_maxRadius;
+	const auto l_centerX = toCell(p_x);
+	const auto l_centerY = toCell(p_y);
+	const auto l_maxRing = static_cast<s32>(std::ceil(p_maxRadius * m_inverseCellSize));
+	auto l_found = 0u;
+
+	auto l_insertCandidate = [&](u32 p_index, const GridElement& p_element)
+	{
+		const auto l_dx = p_element.x - p_x;
+		const auto l_dy = p_element.y - p_y;
+		const auto l_distance = l_dx * l_dx + l_dy * l_dy;
+
+		if (l_distance > l_maxRadiusSquared or (l_found == p_k and l_distance >= p_distances[p_k - 1u]))
+		{
+			return;
+		}
+
+		auto l_position = l_found < p_k ? l_found++ : p_k - 1u;
+
+		while (l_position > 0u and p_distances[l_position - 1u] > l_distance)
+		{
+			p_distances[l_position] = p_distances[l_position - 1u];
+			p_result[l_position] = p_result[l_position - 1u];
+			l_position--;
+		}
+
+		p_distances[l_position] = l_distance;
+		p_result[l_position] = m_sortedEntities[p_index];
+	};
+
+	for (auto l_ring = 0; l_ring <= l_maxRing; l_ring++)
+	{
+		for (auto l_cellY = l_centerY - l_ring; l_cellY <= l_centerY + l_ring; l_cellY++)
+		{
+			const auto l_isEdgeRow = l_cellY == l_centerY - l_ring or l_cellY == l_centerY + l_ring;
+			const auto l_stepX = l_isEdgeRow or l_ring == 0 ? 1 : 2 * l_ring;
+
+			for (auto l_cellX = l_centerX - l_ring; l_cellX <= l_centerX + l_ring; l_cellX += l_stepX)
+			{
+				visitCell(l_cellX, l_cellY, l_insertCandidate);
+			}
+		}
+
+		//everything outside visited rings is at least (ring * cellSize) away
+		const auto l_coveredDistance = static_cast<f32>(l_ring) * m_cellSize;
+		if (l_found == p_k and p_distances[p_k - 1u] <= l_coveredDistance * l_coveredDistance)
+		{
+			break;
+		}
+	}
+
+	for (auto i = l_found; i < p_k; i++)
+	{
+		p_result[i] = UNDEFINED_ENTITY_ID;
+	}
+}
+
+}
@@ -0,0 +1,3 @@
+#pragma once
+#include "SpatialHashGrid.hpp"
+#include "BroadphaseSystem.hpp"
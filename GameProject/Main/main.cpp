@@ -1,10 +1,263 @@
 #include <iostream>
-#include "DevTestModule.hpp"
-#include <SFML\Graphics.hpp>
-#include <Box2D\Box2D.h>
+#include <atomic>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <vector>
 #include "MemoryMgmt.hpp"
+#include "assert.h"
+#include "System.h"
+#include "World.h"
+#include "Prefab.h"
+#include "PositionComponent.h"
+#include "MovableComponent.h"
+#include "FixedTimestepLoop.h"
+#include "MetricsReporter.h"
+#include "Profiler.h"
+
+using namespace engine;
+
+namespace
+{
+	const u32 DEFAULT_NR_OF_ENTITIES = 10000u;
+	const u64 DEFAULT_NR_OF_TICKS = 600u;
+	const u32 DEFAULT_TICK_RATE = 60u;
+	const f32 METRICS_INTERVAL = 1.0f;
+
+	struct RunnerOptions
+	{
+		u32 nrOfEntities = DEFAULT_NR_OF_ENTITIES;
+		u64 nrOfTicks = DEFAULT_NR_OF_TICKS;
+		u32 tickRate = DEFAULT_TICK_RATE;
+		bool paceToRealTime = true;
+		const char* traceFile = nullptr;
+		const char* metricsFile = nullptr;
+	};
+
+	//POSITION and MOVABLE components from component pools - the only types spawned by the runner
+	class PooledComponentProvider : public IComponentProvider
+	{
+	public:
+		PooledComponentProvider(PoolSize p_size)
+			:m_positions(p_size),
+			 m_movables(p_size)
+		{
+		}
+
+		ComponentBase& createComponent(ComponentType p_type) override
+		{
+			ComponentBase* l_component = nullptr;
+			createComponents(p_type, 1u, &l_component);
+
+			return *l_component;
+		}
+
+		void createComponents(ComponentType p_type, u32 p_count, ComponentBase** p_components) override
+		{
+			getPool(p_type).getComponents(p_count, p_components);
+		}
+
+		bool removeComponent(ComponentBase& p_component) override
+		{
+			getPool(p_component.type).returnComponent(p_component);
+			return true;
+		}
+
+	private:
+		IComponentPool& getPool(ComponentType p_type)
+		{
+			assert(p_type == ComponentType::POSITION or p_type == ComponentType::MOVABLE);
+			return p_type == ComponentType::POSITION ? static_cast<IComponentPool&>(m_positions) : m_movables;
+		}
+
+		ComponentPool<PositionComponent> m_positions;
+		ComponentPool<MovableComponent> m_movables;
+	};
+
+	template<typename ComponentStruct>
+	ComponentStruct* findComponent(Entity& p_entity)
+	{
+		for (auto l_component = p_entity.components; l_component; l_component = l_component->nextComponent)
+		{
+			if (l_component->type == ComponentStruct::TYPE)
+				return static_cast<ComponentStruct*>(l_component);
+		}
+
+		return nullptr;
+	}
+
+	//moves every entity with POSITION + MOVABLE, components are found through entity's component list
+	class MovementSystem : public System
+	{
+	public:
+		MovementSystem(EntityPool& p_entities)
+			:m_entities(p_entities)
+		{
+		}
+
+		void update(f32 p_deltaTime) override
+		{
+			for (auto& l_entity : m_entities.getEntities())
+			{
+				auto l_position = findComponent<PositionComponent>(l_entity);
+				auto l_movable = findComponent<MovableComponent>(l_entity);
+
+				if (l_position and l_movable)
+				{
+					l_position->x += l_movable->velocityX * p_deltaTime;
+					l_position->y += l_movable->velocityY * p_deltaTime;
+				}
+			}
+		}
+
+		const char* getName() const override
+		{
+			return "MovementSystem";
+		}
+
+	private:
+		EntityPool& m_entities;
+	};
+
+	void printUsage()
+	{
+		std::cout << "Headless simulation runner (dedicated server / load testing)\n"
+				  << "  --entities N   number of simulated entities (default " << DEFAULT_NR_OF_ENTITIES << ")\n"
+				  << "  --ticks N      number of ticks to run, 0 - run until SIGINT/SIGTERM (default " << DEFAULT_NR_OF_TICKS << ")\n"
+				  << "  --rate N       ticks per second (default " << DEFAULT_TICK_RATE << ")\n"
+				  << "  --unpaced      run ticks back to back instead of real time\n"
+				  << "  --metrics FILE append metrics snapshot (JSON line) every second of simulation\n"
+				  << "  --trace FILE   write Chrome trace JSON of profiled zones (build with GAMEPROJECT_WITH_PROFILER)\n";
+	}
+
+	bool parseOptions(int argc, char* argv[], RunnerOptions& p_options)
+	{
+		for (auto i = 1; i < argc; i++)
+		{
+			const bool l_hasValue = i + 1 < argc;
+
+			if (std::strcmp(argv[i], "--entities") == 0 and l_hasValue)
+				p_options.nrOfEntities = static_cast<u32>(std::strtoul(argv[++i], nullptr, 10));
+			else if (std::strcmp(argv[i], "--ticks") == 0 and l_hasValue)
+				p_options.nrOfTicks = std::strtoull(argv[++i], nullptr, 10);
+			else if (std::strcmp(argv[i], "--rate") == 0 and l_hasValue)
+				p_options.tickRate = static_cast<u32>(std::strtoul(argv[++i], nullptr, 10));
+			else if (std::strcmp(argv[i], "--unpaced") == 0)
+				p_options.paceToRealTime = false;
+			else if (std::strcmp(argv[i], "--trace") == 0 and l_hasValue)
+				p_options.traceFile = argv[++i];
+			else if (std::strcmp(argv[i], "--metrics") == 0 and l_hasValue)
+				p_options.metricsFile = argv[++i];
+			else
+				return false;
+		}
+
+		return p_options.nrOfEntities > 0u and p_options.tickRate > 0u;
+	}
+
+	//every entity spawned from one prefab in a single batch, velocities spread so entities do not move together
+	void populate(World& p_world, u32 p_nrOfEntities)
+	{
+		Prefab l_prefab;
+		l_prefab.addComponent(PositionComponent());
+		l_prefab.addComponent(MovableComponent());
+
+		std::vector<EntityId> l_ids(p_nrOfEntities);
+		auto& l_entityController = p_world.getEntityController();
+		l_entityController.createEntitiesFromPrefab(l_prefab, p_nrOfEntities, l_ids.data());
+
+		for (auto i = 0u; i < p_nrOfEntities; i++)
+		{
+			auto& l_movable = *findComponent<MovableComponent>(l_entityController.getEntity(l_ids[i]));
+			l_movable.velocityX = static_cast<f32>(i % 7u);
+			l_movable.velocityY = static_cast<f32>(i % 5u);
+		}
+	}
+
+	void printStats(const TickStats& p_stats)
+	{
+		std::cout << "Ticks: " << p_stats.nrOfTicks << " (dropped: " << p_stats.nrOfDroppedTicks << ")\n"
+				  << "Tick time [ms] avg: " << p_stats.getAverageTickTime()
+				  << " min: " << p_stats.minTickTime
+				  << " max: " << p_stats.maxTickTime << "\n"
+				  << "Tick CPU time [ms] avg: " << p_stats.getAverageTickCpuTime()
+				  << " max: " << p_stats.maxTickCpuTime << "\n";
+	}
+
+	//loop which SIGINT/SIGTERM stop, so unlimited run still ends with stats and trace
+	std::atomic<FixedTimestepLoop*> s_runningLoop = nullptr;
+
+	void stopRunningLoop(int)
+	{
+		if (auto l_loop = s_runningLoop.load())
+		{
+			l_loop->requestStop();
+		}
+	}
+
+	bool writeTrace(const char* p_path)
+	{
+		std::ofstream l_file(p_path);
+		return l_file and profiler::exportChromeTrace(l_file);
+	}
+}
 
 int main(int argc, char* argv[])
 {
+	RunnerOptions l_options;
+
+	if (not parseOptions(argc, argv, l_options))
+	{
+		printUsage();
+		return 1;
+	}
+
+	profiler::setThreadName("simulation");
+
+	//declared before the world - attached pools remove their sampled gauges when destroyed
+	MetricsRegistry l_metrics;
+
+	WorldSettings l_worldSettings;
+	l_worldSettings.maxNrOfEntities = l_options.nrOfEntities;
+
+	World l_world(std::make_unique<PooledComponentProvider>(l_options.nrOfEntities), l_worldSettings);
+	l_world.attachMetrics(l_metrics, "world");
+	populate(l_world, l_options.nrOfEntities);
+
+	MovementSystem l_movement(l_world.getEntityPool());
+	auto& l_systems = l_world.getSystems();
+	l_systems.addSystem(l_movement);
+
+	MetricsReporter l_metricsReporter(l_metrics, l_options.metricsFile ? l_options.metricsFile : "", METRICS_INTERVAL);
+	if (l_options.metricsFile)
+	{
+		l_systems.addSystem(l_metricsReporter, std::numeric_limits<s32>::max());
+	}
+
+	FixedTimestepSettings l_settings;
+	l_settings.fixedTimeStep = 1.0f / static_cast<f32>(l_options.tickRate);
+
+	FixedTimestepLoop l_loop(l_systems, l_settings);
+	s_runningLoop = &l_loop;
+	std::signal(SIGINT, stopRunningLoop);
+	std::signal(SIGTERM, stopRunningLoop);
+
+	l_loop.run(l_options.nrOfTicks, l_options.paceToRealTime);
+
+	std::signal(SIGINT, SIG_DFL);
+	std::signal(SIGTERM, SIG_DFL);
+	s_runningLoop = nullptr;
+
+	printStats(l_loop.getStats());
+
+	if (l_options.traceFile and not writeTrace(l_options.traceFile))
+	{
+		std::cerr << "Cannot write trace to " << l_options.traceFile << "\n";
+		return 1;
+	}
+
 	return 0;
-}
\ No newline at end of file
+}
@@ -1,6 +1,6 @@
 #pragma once
-#include <gtest\gtest.h>
-#include <gmock\gmock.h>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
 #include "IComponentController.h"
 
 namespace engine
@@ -14,6 +14,8 @@ public:
 
 	MOCK_METHOD2(detachComponent, bool(Entity&, ComponentType));
 	MOCK_METHOD2(detachMultipleComponents, bool(Entity&, const ComponentIndicators&));
+
+	MOCK_METHOD3(attachPrefab, bool(Entity*, u32, const Prefab&));
 };
 
 }
\ No newline at end of file
@@ -0,0 +1,15 @@
+#pragma once
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "IComponentObserver.h"
+
+namespace engine
+{
+
+class ComponentObserverMock : public IComponentObserver
+{
+public:
+	MOCK_METHOD2(onComponentChange, void(Entity&, ComponentType));
+};
+
+}
@@ -1,6 +1,6 @@
 #pragma once
-#include <gtest\gtest.h>
-#include <gmock\gmock.h>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
 #include "IComponentPool.h"
 
 namespace engine
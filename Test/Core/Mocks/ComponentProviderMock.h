@@ -1,6 +1,6 @@
 #pragma once
-#include <gtest\gtest.h>
-#include <gmock\gmock.h>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
 #include "IComponentProvider.h"
 
 namespace engine
@@ -10,6 +10,7 @@ class ComponentProviderMock : public IComponentProvider
 {
 public:
 	MOCK_METHOD1(createComponent, ComponentBase&(ComponentType p_component));
+	MOCK_METHOD3(createComponents, void(ComponentType, u32, ComponentBase**));
 	MOCK_METHOD1(removeComponent, bool(ComponentBase&));
 };
 
@@ -1,6 +1,6 @@
 #pragma once
-#include <gtest\gtest.h>
-#include <gmock\gmock.h>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
 #include "IEntityChangeDistributor.h"
 
 namespace engine
@@ -10,6 +10,9 @@ class EntityChangeDistributorMock : public IEntityChangeDistributor
 {
 public:
 	MOCK_METHOD1(distributeEntityChange, void(EntityId));
+
+	MOCK_METHOD1(registerListener, void(IEntityChangeListener&));
+	MOCK_METHOD1(deregisterListener, void(IEntityChangeListener&));
 };
 
 }
\ No newline at end of file
@@ -0,0 +1,15 @@
+#pragma once
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "IEntityChangeListener.h"
+
+namespace engine
+{
+
+class EntityChangeListenerMock : public IEntityChangeListener
+{
+public:
+	MOCK_METHOD1(onEntityChange, void(EntityId));
+};
+
+}
@@ -1,6 +1,6 @@
 #pragma once
-#include <gtest\gtest.h>
-#include <gmock\gmock.h>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
 #include "IEntityController.h"
 
 namespace engine
@@ -11,6 +11,8 @@ class EntityControllerMock : public IEntityController
 public:
 	MOCK_METHOD0(createEntity, EntityId());
 	MOCK_METHOD1(createEntityWithComponents, EntityId(const ComponentIndicators&));
+	MOCK_METHOD1(createEntityFromPrefab, EntityId(const Prefab&));
+	MOCK_METHOD3(createEntitiesFromPrefab, void(const Prefab&, u32, EntityId*));
 
 	MOCK_METHOD1(removeEntity, bool(EntityId));
 
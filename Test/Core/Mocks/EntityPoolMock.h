@@ -1,7 +1,7 @@
 #pragma once
 #pragma once
-#include <gtest\gtest.h>
-#include <gmock\gmock.h>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
 #include "IEntityPool.h"
 
 namespace engine
@@ -10,6 +10,7 @@ namespace engine
 	{
 	public:	
 		MOCK_METHOD0(create, Entity&());
+		MOCK_METHOD1(createMultiple, Entity*(u32));
 		MOCK_METHOD1(removeEntity, bool(EntityId));
 		MOCK_METHOD1(getEntity, Entity&(EntityId));
 
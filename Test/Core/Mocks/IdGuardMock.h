@@ -1,6 +1,6 @@
 #pragma once
-#include <gtest\gtest.h>
-#include <gmock\gmock.h>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
 #include "IIdGuard.h"
 
 namespace engine
@@ -12,6 +12,8 @@ public:
 	MOCK_METHOD0(getNextId, Id());
 	MOCK_METHOD1(freeId, void(Id));
 	MOCK_METHOD0(reset, void());
+	MOCK_CONST_METHOD2(saveState, IdGuardState(Id*, u32));
+	MOCK_METHOD2(restoreState, void(const IdGuardState&, const Id*));
 };
 
 }
\ No newline at end of file
@@ -0,0 +1,18 @@
+#pragma once
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "ISystemController.h"
+
+namespace engine
+{
+
+class SystemControllerMock : public ISystemController
+{
+public:
+	MOCK_METHOD2(addSystem, void(ISystem&, s32));
+	MOCK_METHOD1(removeSystem, bool(ISystem&));
+	MOCK_METHOD1(update, void(f32));
+	MOCK_CONST_METHOD0(getNumOfSystems, u32());
+};
+
+}
@@ -0,0 +1,16 @@
+#pragma once
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "ISystem.h"
+
+namespace engine
+{
+
+class SystemMock : public ISystem
+{
+public:
+	MOCK_METHOD1(update, void(f32));
+	MOCK_CONST_METHOD0(getResourceAccess, ResourceAccess());
+};
+
+}
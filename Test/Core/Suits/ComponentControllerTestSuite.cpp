@@ -1,9 +1,10 @@
-#include <gtest\gtest.h>
-#include <gmock\gmock.h>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
 #include "Core.h"
 #include "ComponentController.h"
 #include "TestComponents.h"
 #include "ComponentProviderMock.h"
+#include "ComponentObserverMock.h"
 #include "UniquePtrMockWrapper.h"
 
 using namespace testing;
@@ -19,6 +20,7 @@ constexpr u32 ZERO_COMPONENTS = 0u;
 constexpr u32 ONE_COMPONENT = 1u;
 constexpr u32 TWO_COMPONENTS = 2u;
 constexpr u32 THREE_COMPONENTS = 3u;
+constexpr u32 ONE_ENTITY = 1u;
 
 }
 
@@ -343,4 +345,65 @@ TEST_F(ComponentControllerTestSuite, shouldDetachAllComponentsConnectedToEntity)
 	EXPECT_TRUE(detachMultipleComponents(createIndicatorsWithThreeComponents()));
 	checkNumberOfConnectedComponents(ZERO_COMPONENTS);
 	EXPECT_THAT(m_entity.components, IsNull());
-}
\ No newline at end of file
+}
+TEST_F(ComponentControllerTestSuite, shouldAttachComponentsOfPrefabInTypeOrderWithOneBatchPerType)
+{
+	Prefab l_prefab;
+	l_prefab.addComponent(COMPONENT_B.type);
+	l_prefab.addComponent(COMPONENT_A.type);
+
+	EXPECT_CALL(*m_componentProviderMock, createComponents(COMPONENT_A.type, ONE_ENTITY, _)).WillOnce(SetArgPointee<2>(&COMPONENT_A));
+	EXPECT_CALL(*m_componentProviderMock, createComponents(COMPONENT_B.type, ONE_ENTITY, _)).WillOnce(SetArgPointee<2>(&COMPONENT_B));
+
+	EXPECT_TRUE(m_sut.attachPrefab(&m_entity, ONE_ENTITY, l_prefab));
+
+	checkComponentConnectedAsFirst(COMPONENT_A);
+	checkComponentConnectedAsSecond(COMPONENT_B);
+	checkNumberOfConnectedComponents(TWO_COMPONENTS);
+	EXPECT_THAT(COMPONENT_B.nextComponent, IsNull());
+}
+
+TEST_F(ComponentControllerTestSuite, shouldReturnFalseIfPrefabHasNoComponents)
+{
+	EXPECT_FALSE(m_sut.attachPrefab(&m_entity, ONE_ENTITY, Prefab()));
+	checkNumberOfConnectedComponents(ZERO_COMPONENTS);
+}
+
+TEST_F(ComponentControllerTestSuite, attachedObserversShouldBeNotifiedAfterAttachAndBeforeDetach)
+{
+	StrictMock<ComponentObserverMock> l_observerMock;
+	ComponentObservers l_observers;
+	l_observers.onAdd(COMPONENT_A.type, l_observerMock);
+	l_observers.onRemove(COMPONENT_A.type, l_observerMock);
+	m_sut.attachObservers(l_observers);
+
+	EXPECT_CALL(l_observerMock, onComponentChange(Ref(m_entity), COMPONENT_A.type)).WillOnce(Invoke([this](Entity&, ComponentType)
+	{
+		checkComponentConnectedAsFirst(COMPONENT_A);
+	}));
+	attachComponent(COMPONENT_A);
+
+	EXPECT_CALL(l_observerMock, onComponentChange(Ref(m_entity), COMPONENT_A.type)).WillOnce(Invoke([this](Entity&, ComponentType)
+	{
+		checkComponentConnectedAsFirst(COMPONENT_A);
+	}));
+	detachComponent(COMPONENT_A);
+}
+
+TEST_F(ComponentControllerTestSuite, attachedObserversShouldSeePrefabComponentsAddedInTypeOrder)
+{
+	StrictMock<ComponentObserverMock> l_observerMock;
+	ComponentObservers l_observers;
+	l_observers.onAdd(COMPONENT_B.type, l_observerMock, createIndicatorsWithOneComponent());
+	m_sut.attachObservers(l_observers);
+
+	Prefab l_prefab;
+	l_prefab.addComponent(COMPONENT_A.type);
+	l_prefab.addComponent(COMPONENT_B.type);
+
+	EXPECT_CALL(*m_componentProviderMock, createComponents(COMPONENT_A.type, ONE_ENTITY, _)).WillOnce(SetArgPointee<2>(&COMPONENT_A));
+	EXPECT_CALL(*m_componentProviderMock, createComponents(COMPONENT_B.type, ONE_ENTITY, _)).WillOnce(SetArgPointee<2>(&COMPONENT_B));
+	EXPECT_CALL(l_observerMock, onComponentChange(Ref(m_entity), COMPONENT_B.type));
+
+	EXPECT_TRUE(m_sut.attachPrefab(&m_entity, ONE_ENTITY, l_prefab));
+}
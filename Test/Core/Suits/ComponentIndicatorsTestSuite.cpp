@@ -1,6 +1,5 @@
-#pragma once
-#include <gtest\gtest.h>
-#include <gmock\gmock.h>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
 #include "Core.h"
 
 using namespace testing;
@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "Core.h"
+#include "ComponentObservers.h"
+#include "ComponentObserverMock.h"
+#include "PositionComponent.h"
+#include "MovableComponent.h"
+
+using namespace testing;
+using namespace engine;
+
+namespace
+{
+const EntityId ENTITY_ID = 1u;
+}
+
+class ComponentObserversTestSuite : public Test
+{
+public:
+	ComponentObserversTestSuite()
+		:m_entity(ENTITY_ID)
+	{
+		m_position.set(ComponentType::POSITION);
+
+		m_positionAndVisible.set(ComponentType::POSITION);
+		m_positionAndVisible.set(ComponentType::VISIBLE);
+	}
+
+protected:
+	void notifyAdd(ComponentType p_type)
+	{
+		const auto l_before = m_entity.attachedComponents;
+		m_entity.attachedComponents.set(p_type);
+		m_sut.notifyAdd(m_entity, p_type, l_before);
+	}
+
+	void notifyRemove(ComponentType p_type)
+	{
+		m_sut.notifyRemove(m_entity, p_type, m_entity.attachedComponents);
+		m_entity.attachedComponents.set(p_type, false);
+	}
+
+	Entity m_entity;
+	ComponentIndicators m_position;
+	ComponentIndicators m_positionAndVisible;
+
+	StrictMock<ComponentObserverMock> m_observerMock;
+	StrictMock<ComponentObserverMock> m_secondObserverMock;
+	ComponentObservers m_sut;
+};
+
+TEST_F(ComponentObserversTestSuite, observersShouldBeEmptyWithoutSubscriptions)
+{
+	EXPECT_TRUE(m_sut.empty());
+
+	notifyAdd(ComponentType::POSITION);
+	notifyRemove(ComponentType::POSITION);
+}
+
+TEST_F(ComponentObserversTestSuite, onAddShouldNotifyOnlyAboutAddedType)
+{
+	m_sut.onAdd<MovableComponent>(m_observerMock);
+	EXPECT_FALSE(m_sut.empty());
+
+	notifyAdd(ComponentType::POSITION);
+
+	EXPECT_CALL(m_observerMock, onComponentChange(Ref(m_entity), ComponentType::MOVABLE));
+	notifyAdd(ComponentType::MOVABLE);
+
+	notifyRemove(ComponentType::MOVABLE);
+}
+
+TEST_F(ComponentObserversTestSuite, onAddWithRequiredComponentsShouldNotifyOnlyIfEntityAlreadyHasThem)
+{
+	m_sut.onAdd(ComponentType::VISIBLE, m_observerMock, m_position);
+
+	notifyAdd(ComponentType::VISIBLE);
+	notifyRemove(ComponentType::VISIBLE);
+
+	notifyAdd(ComponentType::POSITION);
+
+	EXPECT_CALL(m_observerMock, onComponentChange(Ref(m_entity), ComponentType::VISIBLE));
+	notifyAdd(ComponentType::VISIBLE);
+}
+
+TEST_F(ComponentObserversTestSuite, onRemoveShouldNotifyBeforeRemovalIfEntityHasRequiredComponents)
+{
+	m_sut.onRemove<PositionComponent>(m_observerMock, m_positionAndVisible);
+
+	notifyAdd(ComponentType::POSITION);
+	notifyRemove(ComponentType::POSITION);
+
+	notifyAdd(ComponentType::POSITION);
+	notifyAdd(ComponentType::VISIBLE);
+	notifyRemove(ComponentType::VISIBLE);
+	notifyAdd(ComponentType::VISIBLE);
+
+	EXPECT_CALL(m_observerMock, onComponentChange(Ref(m_entity), ComponentType::POSITION));
+	notifyRemove(ComponentType::POSITION);
+}
+
+TEST_F(ComponentObserversTestSuite, onMatchShouldNotifyOnceWhenEntityStartsToMatchMask)
+{
+	m_sut.onMatch(m_positionAndVisible, m_observerMock);
+
+	notifyAdd(ComponentType::VISIBLE);
+
+	EXPECT_CALL(m_observerMock, onComponentChange(Ref(m_entity), ComponentType::POSITION));
+	notifyAdd(ComponentType::POSITION);
+
+	notifyAdd(ComponentType::MOVABLE);
+}
+
+TEST_F(ComponentObserversTestSuite, observersShouldBeNotifiedInOrderOfSubscriptionUntilUnsubscribed)
+{
+	m_sut.onAdd(ComponentType::POSITION, m_observerMock);
+	m_sut.onMatch(m_position, m_secondObserverMock);
+
+	{
+		InSequence l_sequence;
+		EXPECT_CALL(m_observerMock, onComponentChange(_, ComponentType::POSITION));
+		EXPECT_CALL(m_secondObserverMock, onComponentChange(_, ComponentType::POSITION));
+	}
+	notifyAdd(ComponentType::POSITION);
+	notifyRemove(ComponentType::POSITION);
+
+	m_sut.unsubscribe(m_observerMock);
+
+	EXPECT_CALL(m_secondObserverMock, onComponentChange(_, ComponentType::POSITION));
+	notifyAdd(ComponentType::POSITION);
+}
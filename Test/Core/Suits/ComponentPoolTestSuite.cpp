@@ -1,5 +1,6 @@
-#include <gtest\gtest.h>
-#include <gmock\gmock.h>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <array>
 #include "Core.h"
 #include "TestComponents.h"
 #include "ComponentPool.h"
@@ -42,3 +43,15 @@ TEST_F(ComponentPoolTestSuite, componentsCanBeAddAndRemove)
 	m_sut.returnComponent(l_first);
 	EXPECT_EQ(EMPTY, m_sut.size());
 }
+
+TEST_F(ComponentPoolTestSuite, componentsRequestedTogetherShouldBeConstructedNextToEachOther)
+{
+	std::array<ComponentBase*, TWO_ELEMENTS> l_components;
+
+	m_sut.getComponents(TWO_ELEMENTS, l_components.data());
+
+	EXPECT_EQ(TWO_ELEMENTS, m_sut.size());
+	EXPECT_EQ(static_cast<testComponents::ComponentA*>(l_components[0]) + 1, static_cast<testComponents::ComponentA*>(l_components[1]));
+	EXPECT_EQ(ComponentType::POSITION, l_components[1]->type);
+	EXPECT_EQ(1, static_cast<testComponents::ComponentA*>(l_components[1])->value);
+}
@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "Core.h"
+#include "Stopwatch.h"
+#include "DeltaSnapshotter.h"
+#include "MovableComponent.h"
+
+using namespace testing;
+using namespace engine;
+
+namespace
+{
+	const bool ENABLED = true;
+	const bool DISABLED = false;
+
+	const PoolSize NR_OF_ENTITIES = 10000u;
+	const u32 TICKS = 600u;
+	const f32 DELTA_TIME = 1.0f / 60.0f;
+
+	//TESTS:
+	const bool captureDeltaEveryTickForTenThousandEntities = DISABLED;
+	const bool rewindFullHistoryForTenThousandEntities = DISABLED;
+}
+
+class DeltaSnapshotterPerformanceTestSuite : public Test
+{
+public:
+	DeltaSnapshotterPerformanceTestSuite()
+		:m_entities(NR_OF_ENTITIES),
+		 m_movables(NR_OF_ENTITIES),
+		 m_transforms(NR_OF_ENTITIES)
+	{
+		for (auto i = 1u; i <= NR_OF_ENTITIES; i++)
+		{
+			m_entities.allocate(i);
+			m_movables.allocate().connectedEntity = i;
+			m_transforms.add(i, 0.0f, 0.0f, static_cast<f32>(i % 7), static_cast<f32>(i % 5));
+		}
+
+		m_sut.registerPool(m_entities);
+		m_sut.registerPool(m_movables);
+		m_sut.registerTransformStore(m_transforms);
+		m_sut.captureBaseline();
+	}
+
+	void startStopwatch()
+	{
+		m_stopwatch.start();
+	}
+
+	void stopStopwatch()
+	{
+		m_stopwatch.stop();
+		std::cout << "Measured time: " << m_stopwatch.getElapsedTime().count() << "ms \n\n";
+	}
+
+	//every position changes - worst case for chunk diffing
+	void simulate(u32 p_nrOfTicks)
+	{
+		for (auto i = 0u; i < p_nrOfTicks; i++)
+		{
+			m_transforms.integrate(DELTA_TIME);
+			m_sut.captureDelta();
+		}
+	}
+
+protected:
+	ContinuousPool<Entity> m_entities;
+	ContinuousPool<MovableComponent> m_movables;
+	TransformStore m_transforms;
+	DeltaSnapshotter m_sut;
+	testTool::Stopwatch m_stopwatch;
+};
+
+TEST_F(DeltaSnapshotterPerformanceTestSuite, captureDeltaEveryTickForTenThousandEntities)
+{
+	if (not captureDeltaEveryTickForTenThousandEntities)
+		return;
+
+	std::cout << "Integrate and capture delta, " << TICKS << " ticks: \n";
+	startStopwatch();
+	simulate(TICKS);
+	stopStopwatch();
+
+	std::cout << "Delta size: " << m_sut.getDelta(0u).size() << " bytes \n\n";
+}
+
+TEST_F(DeltaSnapshotterPerformanceTestSuite, rewindFullHistoryForTenThousandEntities)
+{
+	if (not rewindFullHistoryForTenThousandEntities)
+		return;
+
+	simulate(delta::DEFAULT_HISTORY_SIZE);
+
+	std::cout << "Rewind " << delta::DEFAULT_HISTORY_SIZE << " ticks: \n";
+	startStopwatch();
+	EXPECT_TRUE(m_sut.rewind(delta::DEFAULT_HISTORY_SIZE));
+	stopStopwatch();
+}
@@ -0,0 +1,228 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <cstring>
+#include "Core.h"
+#include "DeltaSnapshotter.h"
+#include "MovableComponent.h"
+
+using namespace testing;
+using namespace engine;
+
+namespace
+{
+const PoolSize CAPACITY = 200u;
+const u32 NR_OF_ENTITIES = 100u;
+const u32 HISTORY_SIZE = 4u;
+
+const f32 VELOCITY_X = 2.0f;
+const f32 VELOCITY_Y = -1.0f;
+const f32 DELTA_TIME = 0.5f;
+}
+
+struct DeltaTestWorld
+{
+	DeltaTestWorld(u32 p_historySize = HISTORY_SIZE)
+		:movables(CAPACITY),
+		 transforms(CAPACITY),
+		 snapshotter(p_historySize)
+	{
+		snapshotter.registerPool(movables);
+		snapshotter.registerTransformStore(transforms);
+	}
+
+	void populate()
+	{
+		for (auto i = 1u; i <= NR_OF_ENTITIES; i++)
+		{
+			auto& l_movable = movables.allocate();
+			l_movable.velocityX = static_cast<f32>(i);
+			l_movable.connectedEntity = i;
+
+			transforms.add(i, static_cast<f32>(i), 0.0f, VELOCITY_X, VELOCITY_Y);
+		}
+	}
+
+	ContinuousPool<MovableComponent> movables;
+	TransformStore transforms;
+	DeltaSnapshotter snapshotter;
+};
+
+class DeltaSnapshotterTestSuite : public Test
+{
+public:
+	DeltaSnapshotterTestSuite()
+	{
+		m_sut.populate();
+		m_sut.snapshotter.captureBaseline();
+	}
+
+	std::vector<f32> copyPositionsX(const TransformStore& p_store)
+	{
+		return std::vector<f32>(p_store.positionsX(), p_store.positionsX() + p_store.size());
+	}
+
+protected:
+	DeltaTestWorld m_sut;
+};
+
+TEST_F(DeltaSnapshotterTestSuite, deltaOfUnchangedStateHasNoRecords)
+{
+	const auto& l_delta = m_sut.snapshotter.captureDelta();
+
+	ASSERT_EQ(sizeof(delta::DeltaHeader), l_delta.size());
+
+	delta::DeltaHeader l_header;
+	std::memcpy(&l_header, l_delta.data(), sizeof(l_header));
+	EXPECT_EQ(0u, l_header.nrOfRecords);
+	EXPECT_EQ(1u, l_header.frame);
+}
+
+TEST_F(DeltaSnapshotterTestSuite, deltaContainsOnlyChangedChunks)
+{
+	m_sut.transforms.setPosition(1u, 50.0f, 50.0f);
+	const auto& l_delta = m_sut.snapshotter.captureDelta();
+
+	delta::DeltaHeader l_header;
+	std::memcpy(&l_header, l_delta.data(), sizeof(l_header));
+	EXPECT_EQ(2u, l_header.nrOfRecords);
+	EXPECT_LT(l_delta.size(), 2u * delta::CHUNK_SIZE);
+}
+
+TEST_F(DeltaSnapshotterTestSuite, rewindRestoresPreviousFrames)
+{
+	const auto l_initialPositions = copyPositionsX(m_sut.transforms);
+
+	m_sut.transforms.integrate(DELTA_TIME);
+	m_sut.snapshotter.captureDelta();
+	const auto l_firstFramePositions = copyPositionsX(m_sut.transforms);
+
+	m_sut.transforms.integrate(DELTA_TIME);
+	m_sut.snapshotter.captureDelta();
+	ASSERT_EQ(2u, m_sut.snapshotter.getNumOfStoredDeltas());
+
+	ASSERT_TRUE(m_sut.snapshotter.rewind(1u));
+	EXPECT_EQ(l_firstFramePositions, copyPositionsX(m_sut.transforms));
+	EXPECT_EQ(1u, m_sut.snapshotter.getFrame());
+
+	ASSERT_TRUE(m_sut.snapshotter.rewind(1u));
+	EXPECT_EQ(l_initialPositions, copyPositionsX(m_sut.transforms));
+	EXPECT_EQ(0u, m_sut.snapshotter.getNumOfStoredDeltas());
+}
+
+TEST_F(DeltaSnapshotterTestSuite, rewindDropsChangesNotCapturedYet)
+{
+	const auto l_initialPositions = copyPositionsX(m_sut.transforms);
+
+	m_sut.transforms.integrate(DELTA_TIME);
+	m_sut.snapshotter.captureDelta();
+	m_sut.transforms.integrate(DELTA_TIME);
+
+	ASSERT_TRUE(m_sut.snapshotter.rewind(1u));
+	EXPECT_EQ(l_initialPositions, copyPositionsX(m_sut.transforms));
+}
+
+TEST_F(DeltaSnapshotterTestSuite, rewindRestoresPoolSizeAndEntityIds)
+{
+	m_sut.movables.allocate().connectedEntity = NR_OF_ENTITIES + 1u;
+	m_sut.transforms.add(NR_OF_ENTITIES + 1u, 1.0f, 1.0f);
+	m_sut.transforms.remove(1u);
+	m_sut.snapshotter.captureDelta();
+
+	ASSERT_TRUE(m_sut.snapshotter.rewind(1u));
+
+	EXPECT_EQ(NR_OF_ENTITIES, m_sut.movables.size());
+	EXPECT_EQ(NR_OF_ENTITIES, m_sut.transforms.size());
+	EXPECT_TRUE(m_sut.transforms.has(1u));
+	EXPECT_FALSE(m_sut.transforms.has(NR_OF_ENTITIES + 1u));
+}
+
+TEST_F(DeltaSnapshotterTestSuite, cannotRewindMoreFramesThanStored)
+{
+	for (auto i = 0u; i < HISTORY_SIZE + 2u; i++)
+	{
+		m_sut.transforms.integrate(DELTA_TIME);
+		m_sut.snapshotter.captureDelta();
+	}
+
+	EXPECT_EQ(HISTORY_SIZE, m_sut.snapshotter.getNumOfStoredDeltas());
+	EXPECT_FALSE(m_sut.snapshotter.rewind(HISTORY_SIZE + 1u));
+	EXPECT_TRUE(m_sut.snapshotter.rewind(HISTORY_SIZE));
+}
+
+TEST_F(DeltaSnapshotterTestSuite, ownDeltaRedoesRewoundFrame)
+{
+	m_sut.transforms.integrate(DELTA_TIME);
+	const auto l_delta = m_sut.snapshotter.captureDelta();
+	const auto l_framePositions = copyPositionsX(m_sut.transforms);
+
+	ASSERT_TRUE(m_sut.snapshotter.rewind(1u));
+	ASSERT_TRUE(m_sut.snapshotter.applyDelta(l_delta.data(), l_delta.size()));
+
+	EXPECT_EQ(l_framePositions, copyPositionsX(m_sut.transforms));
+	EXPECT_EQ(1u, m_sut.snapshotter.getFrame());
+	EXPECT_EQ(1u, m_sut.snapshotter.getNumOfStoredDeltas());
+}
+
+TEST_F(DeltaSnapshotterTestSuite, rewindAfterRedoShouldReturnToFrameBeforeRedoneOne)
+{
+	m_sut.transforms.integrate(DELTA_TIME);
+	m_sut.snapshotter.captureDelta();
+	const auto l_firstFramePositions = copyPositionsX(m_sut.transforms);
+
+	m_sut.transforms.integrate(DELTA_TIME);
+	const auto l_secondDelta = m_sut.snapshotter.captureDelta();
+	const auto l_secondFramePositions = copyPositionsX(m_sut.transforms);
+
+	ASSERT_TRUE(m_sut.snapshotter.rewind(1u));
+	ASSERT_TRUE(m_sut.snapshotter.applyDelta(l_secondDelta.data(), l_secondDelta.size()));
+	EXPECT_EQ(l_secondFramePositions, copyPositionsX(m_sut.transforms));
+
+	ASSERT_TRUE(m_sut.snapshotter.rewind(1u));
+	EXPECT_EQ(1u, m_sut.snapshotter.getFrame());
+	EXPECT_EQ(l_firstFramePositions, copyPositionsX(m_sut.transforms));
+}
+
+TEST_F(DeltaSnapshotterTestSuite, deltaNotFollowingCurrentFrameIsRejected)
+{
+	m_sut.transforms.integrate(DELTA_TIME);
+	const auto l_firstDelta = m_sut.snapshotter.captureDelta();
+	m_sut.transforms.integrate(DELTA_TIME);
+	const auto l_secondDelta = m_sut.snapshotter.captureDelta();
+	const auto l_positions = copyPositionsX(m_sut.transforms);
+
+	EXPECT_FALSE(m_sut.snapshotter.applyDelta(l_secondDelta.data(), l_secondDelta.size()));
+	EXPECT_FALSE(m_sut.snapshotter.applyDelta(l_firstDelta.data(), l_firstDelta.size()));
+
+	ASSERT_TRUE(m_sut.snapshotter.rewind(2u));
+	EXPECT_FALSE(m_sut.snapshotter.applyDelta(l_secondDelta.data(), l_secondDelta.size()));
+	EXPECT_EQ(0u, m_sut.snapshotter.getFrame());
+
+	EXPECT_TRUE(m_sut.snapshotter.applyDelta(l_firstDelta.data(), l_firstDelta.size()));
+	EXPECT_TRUE(m_sut.snapshotter.applyDelta(l_secondDelta.data(), l_secondDelta.size()));
+	EXPECT_EQ(l_positions, copyPositionsX(m_sut.transforms));
+}
+
+TEST_F(DeltaSnapshotterTestSuite, deltaOfOtherSnapshotterIsRejected)
+{
+	DeltaTestWorld l_other;
+	l_other.snapshotter.captureBaseline();
+	const auto l_positions = copyPositionsX(l_other.transforms);
+
+	m_sut.transforms.integrate(DELTA_TIME);
+	const auto& l_delta = m_sut.snapshotter.captureDelta();
+
+	EXPECT_FALSE(l_other.snapshotter.applyDelta(l_delta.data(), l_delta.size()));
+	EXPECT_EQ(l_positions, copyPositionsX(l_other.transforms));
+}
+
+TEST_F(DeltaSnapshotterTestSuite, corruptedDeltaIsRejected)
+{
+	m_sut.transforms.integrate(DELTA_TIME);
+	auto l_delta = m_sut.snapshotter.captureDelta();
+	ASSERT_TRUE(m_sut.snapshotter.rewind(1u));
+
+	EXPECT_FALSE(m_sut.snapshotter.applyDelta(l_delta.data(), sizeof(delta::DeltaHeader) - 1u));
+
+	l_delta[0] ^= 0xFFu;
+	EXPECT_FALSE(m_sut.snapshotter.applyDelta(l_delta.data(), l_delta.size()));
+}
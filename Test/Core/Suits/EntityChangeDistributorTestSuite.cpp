@@ -1,12 +1,15 @@
-#include <gtest\gtest.h>
-#include <gmock\gmock.h>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
 #include "Core.h"
+#include "EntityChangeDistributor.h"
+#include "EntityChangeListenerMock.h"
 
 using namespace testing;
 using namespace engine;
 
 namespace
 {
+const EntityId ENTITY_ID = 1u;
 }
 
 class EntityChangeDistributorTestSuite : public Test
@@ -14,5 +17,58 @@ class EntityChangeDistributorTestSuite : public Test
 public:
 
 protected:
+	StrictMock<EntityChangeListenerMock> m_firstListener;
+	StrictMock<EntityChangeListenerMock> m_secondListener;
 
-};
\ No newline at end of file
+	EntityChangeDistributor m_sut;
+};
+
+TEST_F(EntityChangeDistributorTestSuite, changeShouldBeDistributedToAllRegisteredListeners)
+{
+	m_sut.registerListener(m_firstListener);
+	m_sut.registerListener(m_secondListener);
+
+	EXPECT_CALL(m_firstListener, onEntityChange(ENTITY_ID));
+	EXPECT_CALL(m_secondListener, onEntityChange(ENTITY_ID));
+
+	m_sut.distributeEntityChange(ENTITY_ID);
+}
+
+TEST_F(EntityChangeDistributorTestSuite, listenerShouldBeNotifiedOnceEvenIfRegisteredTwice)
+{
+	m_sut.registerListener(m_firstListener);
+	m_sut.registerListener(m_firstListener);
+
+	EXPECT_CALL(m_firstListener, onEntityChange(ENTITY_ID)).Times(1);
+
+	m_sut.distributeEntityChange(ENTITY_ID);
+}
+
+TEST_F(EntityChangeDistributorTestSuite, deregisteredListenerShouldNotBeNotified)
+{
+	m_sut.registerListener(m_firstListener);
+	m_sut.registerListener(m_secondListener);
+	m_sut.deregisterListener(m_firstListener);
+
+	EXPECT_CALL(m_secondListener, onEntityChange(ENTITY_ID));
+
+	m_sut.distributeEntityChange(ENTITY_ID);
+}
+
+TEST_F(EntityChangeDistributorTestSuite, attachedMetricsShouldCountChangesAndListeners)
+{
+	MetricsRegistry l_registry;
+	m_sut.attachMetrics(l_registry, "changes");
+
+	m_sut.registerListener(m_firstListener);
+	m_sut.registerListener(m_secondListener);
+	m_sut.deregisterListener(m_secondListener);
+
+	EXPECT_CALL(m_firstListener, onEntityChange(ENTITY_ID)).Times(2);
+
+	m_sut.distributeEntityChange(ENTITY_ID);
+	m_sut.distributeEntityChange(ENTITY_ID);
+
+	EXPECT_EQ(2u, l_registry.getCounter("changes.changes").get());
+	EXPECT_EQ(1, l_registry.getGauge("changes.listeners").get());
+}
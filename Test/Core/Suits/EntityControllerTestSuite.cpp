@@ -1,5 +1,6 @@
-#include <gtest\gtest.h>
-#include <gmock\gmock.h>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <array>
 #include "Core.h"
 #include "EntityController.h"
 #include "IdGuardMock.h"
@@ -21,6 +22,8 @@ constexpr bool ATTACHED = true;
 constexpr bool DETACHED = true;
 constexpr bool REMOVED = false;
 constexpr EntityId ENTITY_ID = 1u;
+constexpr EntityId OTHER_ENTITY_ID = 2u;
+constexpr PoolSize RELATIONS_CAPACITY = 4u;
 }
 
 class EntityControllerTestSuite : public Test
@@ -127,6 +130,83 @@ TEST_F(EntityControllerTestSuite, removeEnityWithMultipleComponentsShouldNotTrig
 	m_sut.removeEntity(ENTITY_ID);
 }
 
+TEST_F(EntityControllerTestSuite, removeEntityShouldDropRelationsFromAttachedStoreOnlyIfEntityWasRemoved)
+{
+	RelationStore l_relations(RELATIONS_CAPACITY);
+	l_relations.add(ENTITY_ID, RelationType::TARGETS, OTHER_ENTITY_ID);
+	l_relations.add(OTHER_ENTITY_ID, RelationType::OWNED_BY, ENTITY_ID);
+	m_sut.attachRelations(l_relations);
+
+	expectGetEntityFromPool();
+	expectDettachMultipleComponents(not DETACHED);
+	EXPECT_CALL(*m_entityPoolMock, removeEntity(ENTITY_ID)).WillOnce(Return(false));
+	m_sut.removeEntity(ENTITY_ID);
+
+	EXPECT_EQ(2u, l_relations.size());
+
+	expectGetEntityFromPool();
+	expectDettachMultipleComponents(not DETACHED);
+	EXPECT_CALL(*m_entityPoolMock, removeEntity(ENTITY_ID)).WillOnce(Return(true));
+	m_sut.removeEntity(ENTITY_ID);
+
+	EXPECT_EQ(0u, l_relations.size());
+	EXPECT_THAT(l_relations.getSources(RelationType::TARGETS, OTHER_ENTITY_ID), IsEmpty());
+	EXPECT_THAT(l_relations.getTargets(OTHER_ENTITY_ID, RelationType::OWNED_BY), IsEmpty());
+}
+
+TEST_F(EntityControllerTestSuite, removeEntityShouldRemoveItFromAttachedHierarchyOnlyIfEntityWasRemoved)
+{
+	TransformHierarchy l_hierarchy(RELATIONS_CAPACITY);
+	l_hierarchy.add(ENTITY_ID);
+	l_hierarchy.add(OTHER_ENTITY_ID);
+	l_hierarchy.setParent(OTHER_ENTITY_ID, ENTITY_ID);
+	m_sut.attachHierarchy(l_hierarchy);
+
+	expectGetEntityFromPool();
+	expectDettachMultipleComponents(not DETACHED);
+	EXPECT_CALL(*m_entityPoolMock, removeEntity(ENTITY_ID)).WillOnce(Return(false));
+	m_sut.removeEntity(ENTITY_ID);
+
+	EXPECT_TRUE(l_hierarchy.has(ENTITY_ID));
+
+	expectGetEntityFromPool();
+	expectDettachMultipleComponents(not DETACHED);
+	EXPECT_CALL(*m_entityPoolMock, removeEntity(ENTITY_ID)).WillOnce(Return(true));
+	m_sut.removeEntity(ENTITY_ID);
+
+	EXPECT_FALSE(l_hierarchy.has(ENTITY_ID));
+	EXPECT_EQ(UNDEFINED_ENTITY_ID, l_hierarchy.getParent(OTHER_ENTITY_ID));
+}
+
+TEST_F(EntityControllerTestSuite, attachedMetricsShouldCountCreatesRemovesAndSuccessfulAttachesAndDetaches)
+{
+	MetricsRegistry l_registry;
+	m_sut.attachMetrics(l_registry, "entities");
+
+	expectCreateEntity();
+	m_sut.createEntity();
+
+	expectGetEntityFromPool();
+	expectAttachComponent(ATTACHED);
+	expectDistributeChange();
+	connectComponent();
+
+	expectGetEntityFromPool();
+	expectAttachComponent(not ATTACHED);
+	connectComponent();
+
+	expectGetEntityFromPool();
+	expectDettachMultipleComponents(DETACHED);
+	EXPECT_CALL(*m_entityPoolMock, removeEntity(ENTITY_ID)).WillOnce(Return(true));
+	expectDistributeChange();
+	m_sut.removeEntity(ENTITY_ID);
+
+	EXPECT_EQ(1u, l_registry.getCounter("entities.creates").get());
+	EXPECT_EQ(1u, l_registry.getCounter("entities.removes").get());
+	EXPECT_EQ(1u, l_registry.getCounter("entities.attaches").get());
+	EXPECT_EQ(1u, l_registry.getCounter("entities.detaches").get());
+}
+
 TEST_F(EntityControllerTestSuite, getEntityShouldReturnRefToEntityFromPool)
 {
 	expectGetEntityFromPool();
@@ -225,4 +305,31 @@ TEST_F(EntityControllerTestSuite, shouldCreateEnityFunctionCalledWithoutRequeste
 	expectAttachMultipleComponents(not ATTACHED);
 
 	m_sut.createEntityWithComponents(m_componentIndicators);
-}
\ No newline at end of file
+}
+TEST_F(EntityControllerTestSuite, shouldCreateEntityFromPrefabAndDistributeChange)
+{
+	Prefab l_prefab;
+
+	expectCreateEntity();
+	EXPECT_CALL(*m_componentControllerMock, attachPrefab(&m_entity, 1u, Ref(l_prefab))).WillOnce(Return(ATTACHED));
+	expectDistributeChange();
+
+	EXPECT_EQ(ENTITY_ID, m_sut.createEntityFromPrefab(l_prefab));
+}
+
+TEST_F(EntityControllerTestSuite, shouldCreateEntitiesFromPrefabInOneBatchAndReturnTheirIds)
+{
+	Prefab l_prefab;
+	std::array<Entity, 2> l_entities{ Entity(ENTITY_ID), Entity(ENTITY_ID + 1u) };
+	std::array<EntityId, 2> l_ids{};
+
+	EXPECT_CALL(*m_entityPoolMock, createMultiple(2u)).WillOnce(Return(l_entities.data()));
+	EXPECT_CALL(*m_componentControllerMock, attachPrefab(l_entities.data(), 2u, Ref(l_prefab))).WillOnce(Return(ATTACHED));
+	EXPECT_CALL(m_changeDistributorMock, distributeEntityChange(ENTITY_ID));
+	EXPECT_CALL(m_changeDistributorMock, distributeEntityChange(ENTITY_ID + 1u));
+
+	m_sut.createEntitiesFromPrefab(l_prefab, 2u, l_ids.data());
+
+	EXPECT_EQ(ENTITY_ID, l_ids[0]);
+	EXPECT_EQ(ENTITY_ID + 1u, l_ids[1]);
+}
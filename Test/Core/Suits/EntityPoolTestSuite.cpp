@@ -1,5 +1,5 @@
-#include <gtest\gtest.h>
-#include <gmock\gmock.h>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
 #include "Core.h"
 #include "EntityPool.h"
 #include "IdGuardMock.h"
@@ -72,6 +72,20 @@ TEST_F(EntityPoolTestSuite, shouldAddEntityToPoolWhenCreateIsCalled)
 	EXPECT_EQ(ONE_ELEMENT, m_sut.size());
 }
 
+TEST_F(EntityPoolTestSuite, createMultipleShouldStoreConsecutiveEntitiesWithIdsFromGuard)
+{
+	EXPECT_CALL(*m_idGuardMock, getNextId()).WillOnce(Return(ENTITY_ID_1)).WillOnce(Return(ENTITY_ID_2));
+
+	auto l_entities = m_sut.createMultiple(TWO_ELEMENTS);
+
+	EXPECT_EQ(TWO_ELEMENTS, m_sut.size());
+	EXPECT_EQ(&(*m_sut.getPool().begin()), l_entities);
+	EXPECT_EQ(ENTITY_ID_1, l_entities[0].id);
+	EXPECT_EQ(ENTITY_ID_2, l_entities[1].id);
+	EXPECT_TRUE(m_sut.hasEntity(ENTITY_ID_1));
+	EXPECT_TRUE(m_sut.hasEntity(ENTITY_ID_2));
+}
+
 TEST_F(EntityPoolTestSuite, hasEntityIdshouldReturnFalseIfEntityWasNotCreated)
 {
 	EXPECT_FALSE(m_sut.hasEntity(ENTITY_ID_1));
@@ -115,6 +129,18 @@ TEST_F(EntityPoolTestSuite, removeEntityShouldReturnFalseIfEntityWasNotStored)
 	EXPECT_FALSE(m_sut.removeEntity(ENTITY_ID_1));
 }
 
+TEST_F(EntityPoolTestSuite, createShouldNotReuseDataOfPreviouslyRemovedEntity)
+{
+	auto& l_entity = addEntityToPool(ENTITY_ID_1);
+	l_entity.attachedComponents.set(ComponentType::POSITION);
+	removeEntityFromPool(ENTITY_ID_1);
+
+	auto& l_newEntity = addEntityToPool(ENTITY_ID_2);
+
+	EXPECT_FALSE(l_newEntity.attachedComponents.any());
+	EXPECT_EQ(nullptr, l_newEntity.components);
+}
+
 TEST_F(EntityPoolTestSuite, clearShouldRemoveAllData)
 {
 	addEntityToPool(ENTITY_ID_1);
@@ -125,4 +151,15 @@ TEST_F(EntityPoolTestSuite, clearShouldRemoveAllData)
 
 	EXPECT_FALSE(m_sut.hasEntity(ENTITY_ID_1));
 	EXPECT_EQ(EMPTY, m_sut.size());
-}
\ No newline at end of file
+}
+
+TEST_F(EntityPoolTestSuite, rebuildStoredIdsShouldFollowEntitiesChangedInPlace)
+{
+	addEntityToPool(ENTITY_ID_1);
+
+	m_sut.getEntities().data()[0].id = ENTITY_ID_2;
+	m_sut.rebuildStoredIds();
+
+	EXPECT_FALSE(m_sut.hasEntity(ENTITY_ID_1));
+	EXPECT_TRUE(m_sut.hasEntity(ENTITY_ID_2));
+}
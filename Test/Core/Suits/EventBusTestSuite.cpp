@@ -0,0 +1,181 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include "Core.h"
+#include "AllocationHook.h"
+#include "EventBus.h"
+
+using namespace testing;
+using namespace testTool;
+using namespace engine;
+
+namespace
+{
+const u32 CAPACITY_PER_THREAD = 4u;
+const u32 NR_OF_THREADS = 2u;
+const u32 FIRST_THREAD = 0u;
+const u32 SECOND_THREAD = 1u;
+const u32 BIG_CAPACITY = 10000u;
+const u32 ODD_CAPACITY = 3u;
+const u32 NR_OF_FRAMES = 5u;
+
+const EntityId ENTITY_ID_1 = 1u;
+const EntityId ENTITY_ID_2 = 2u;
+const EntityId ENTITY_ID_3 = 3u;
+const f32 DAMAGE = 15.0f;
+
+struct DamageEvent
+{
+	EntityId target;
+	f32 amount;
+};
+
+struct DeathEvent
+{
+	EntityId entity;
+};
+
+std::vector<EntityId> getDamagedEntities(const EventBus& p_bus)
+{
+	std::vector<EntityId> l_entities;
+	p_bus.forEach<DamageEvent>([&l_entities](const DamageEvent& p_event){ l_entities.push_back(p_event.target); });
+
+	return l_entities;
+}
+}
+
+class EventBusTestSuite : public Test
+{
+public:
+	EventBusTestSuite()
+		:m_sut(NR_OF_THREADS)
+	{
+		m_sut.registerEvent<DamageEvent>(CAPACITY_PER_THREAD);
+		m_sut.registerEvent<DeathEvent>(CAPACITY_PER_THREAD);
+	}
+
+protected:
+	EventBus m_sut;
+};
+
+TEST_F(EventBusTestSuite, eventTypeShouldBeRegisteredOnlyOnce)
+{
+	EXPECT_TRUE(m_sut.isRegistered<DamageEvent>());
+	EXPECT_FALSE(m_sut.registerEvent<DamageEvent>(CAPACITY_PER_THREAD));
+	EXPECT_EQ(NR_OF_THREADS, m_sut.getQueue<DamageEvent>().getNumOfThreads());
+	EXPECT_EQ(CAPACITY_PER_THREAD, m_sut.getQueue<DamageEvent>().getCapacityPerThread());
+}
+
+TEST_F(EventBusTestSuite, publishedEventsShouldBeVisibleOnlyAfterSwapOfBuffers)
+{
+	EXPECT_TRUE(m_sut.publish(DamageEvent{ENTITY_ID_1, DAMAGE}));
+	EXPECT_TRUE(m_sut.publish(DamageEvent{ENTITY_ID_2, DAMAGE}));
+	EXPECT_THAT(getDamagedEntities(m_sut), IsEmpty());
+
+	m_sut.swapBuffers();
+
+	EXPECT_THAT(getDamagedEntities(m_sut), ElementsAre(ENTITY_ID_1, ENTITY_ID_2));
+	EXPECT_EQ(DAMAGE, m_sut.getEvents<DamageEvent>(FIRST_THREAD).begin()->amount);
+	EXPECT_EQ(0u, m_sut.getQueue<DeathEvent>().size());
+}
+
+TEST_F(EventBusTestSuite, eventsShouldBeReadOnlyInOneFrame)
+{
+	m_sut.publish(DamageEvent{ENTITY_ID_1, DAMAGE});
+	m_sut.swapBuffers();
+
+	m_sut.publish(DamageEvent{ENTITY_ID_2, DAMAGE});
+	EXPECT_THAT(getDamagedEntities(m_sut), ElementsAre(ENTITY_ID_1));
+
+	m_sut.swapBuffers();
+	EXPECT_THAT(getDamagedEntities(m_sut), ElementsAre(ENTITY_ID_2));
+
+	m_sut.swapBuffers();
+	EXPECT_THAT(getDamagedEntities(m_sut), IsEmpty());
+}
+
+TEST_F(EventBusTestSuite, eventsShouldBeKeptPerProducerThreadAndReadProducerAfterProducer)
+{
+	m_sut.publish(DamageEvent{ENTITY_ID_1, DAMAGE}, SECOND_THREAD);
+	m_sut.publish(DamageEvent{ENTITY_ID_2, DAMAGE}, FIRST_THREAD);
+	m_sut.publish(DeathEvent{ENTITY_ID_3}, SECOND_THREAD);
+	m_sut.swapBuffers();
+
+	EXPECT_EQ(1u, m_sut.getEvents<DamageEvent>(FIRST_THREAD).size());
+	EXPECT_EQ(1u, m_sut.getEvents<DamageEvent>(SECOND_THREAD).size());
+	EXPECT_THAT(getDamagedEntities(m_sut), ElementsAre(ENTITY_ID_2, ENTITY_ID_1));
+	EXPECT_EQ(ENTITY_ID_3, m_sut.getEvents<DeathEvent>(SECOND_THREAD).begin()->entity);
+}
+
+TEST_F(EventBusTestSuite, eventsOverCapacityShouldBeDroppedAndCounted)
+{
+	for (auto i = 0u; i < CAPACITY_PER_THREAD; i++)
+	{
+		EXPECT_TRUE(m_sut.publish(DeathEvent{ENTITY_ID_1}));
+	}
+
+	EXPECT_FALSE(m_sut.publish(DeathEvent{ENTITY_ID_2}));
+	EXPECT_TRUE(m_sut.publish(DeathEvent{ENTITY_ID_2}, SECOND_THREAD));
+	m_sut.swapBuffers();
+
+	EXPECT_EQ(CAPACITY_PER_THREAD + 1u, m_sut.getQueue<DeathEvent>().size());
+	EXPECT_EQ(1u, m_sut.getQueue<DeathEvent>().getNumOfDroppedEvents());
+
+	m_sut.swapBuffers();
+	EXPECT_EQ(0u, m_sut.getQueue<DeathEvent>().getNumOfDroppedEvents());
+}
+
+TEST_F(EventBusTestSuite, producerThreadsShouldPublishConcurrentlyWithoutLosingEvents)
+{
+	EventBus l_bus(NR_OF_THREADS);
+	l_bus.registerEvent<DamageEvent>(BIG_CAPACITY);
+
+	auto l_producer = [&l_bus](u32 p_threadIndex)
+	{
+		for (auto i = 0u; i < BIG_CAPACITY; i++)
+		{
+			l_bus.publish(DamageEvent{i + 1u, DAMAGE}, p_threadIndex);
+		}
+	};
+
+	std::thread l_thread(l_producer, SECOND_THREAD);
+	l_producer(FIRST_THREAD);
+	l_thread.join();
+	l_bus.swapBuffers();
+
+	EXPECT_EQ(NR_OF_THREADS * BIG_CAPACITY, l_bus.getQueue<DamageEvent>().size());
+	EXPECT_EQ(BIG_CAPACITY, l_bus.getEvents<DamageEvent>(SECOND_THREAD).end()[-1].target);
+}
+
+TEST_F(EventBusTestSuite, buffersOfEveryProducerShouldStartOnItsOwnCacheLine)
+{
+	EventBus l_bus(NR_OF_THREADS);
+	l_bus.registerEvent<DeathEvent>(ODD_CAPACITY);
+	l_bus.swapBuffers();
+
+	const auto l_first = reinterpret_cast<std::uintptr_t>(l_bus.getEvents<DeathEvent>(FIRST_THREAD).begin());
+	const auto l_second = reinterpret_cast<std::uintptr_t>(l_bus.getEvents<DeathEvent>(SECOND_THREAD).begin());
+
+	EXPECT_EQ(0u, l_first % core::CACHE_LINE_SIZE);
+	EXPECT_EQ(0u, l_second % core::CACHE_LINE_SIZE);
+	EXPECT_EQ(core::CACHE_LINE_SIZE, l_second - l_first);
+}
+
+TEST_F(EventBusTestSuite, publishAndSwapShouldNotAllocate)
+{
+	AllocationScope l_allocations;
+
+	for (auto l_frame = 0u; l_frame < NR_OF_FRAMES; l_frame++)
+	{
+		for (auto i = 0u; i <= CAPACITY_PER_THREAD; i++)
+		{
+			m_sut.publish(DamageEvent{ENTITY_ID_1, DAMAGE}, l_frame % NR_OF_THREADS);
+		}
+
+		m_sut.swapBuffers();
+	}
+
+	EXPECT_EQ(0u, l_allocations.getNumOfAllocations());
+}
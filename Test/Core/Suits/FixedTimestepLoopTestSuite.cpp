@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <chrono>
+#include <thread>
+#include "Core.h"
+#include "FixedTimestepLoop.h"
+#include "SystemControllerMock.h"
+
+using namespace testing;
+using namespace engine;
+
+namespace
+{
+const f32 TIME_STEP = 0.125f;
+const u32 MAX_TICKS = 3u;
+const f32 MAX_ELAPSED_TIME = 1.0f;
+const auto WAITING_TICK_DURATION = std::chrono::milliseconds(20);
+
+FixedTimestepSettings createSettings(bool p_dropExcessTime)
+{
+	FixedTimestepSettings l_settings;
+	l_settings.fixedTimeStep = TIME_STEP;
+	l_settings.maxTicksPerAdvance = MAX_TICKS;
+	l_settings.dropExcessTime = p_dropExcessTime;
+	l_settings.maxElapsedTime = MAX_ELAPSED_TIME;
+
+	return l_settings;
+}
+}
+
+class FixedTimestepLoopTestSuite : public Test
+{
+public:
+	FixedTimestepLoopTestSuite()
+		:m_sut(m_systemsMock, createSettings(true))
+	{
+	}
+
+protected:
+	StrictMock<SystemControllerMock> m_systemsMock;
+	FixedTimestepLoop m_sut;
+};
+
+TEST_F(FixedTimestepLoopTestSuite, advanceShouldNotTickWhenLessThanTimeStepElapsed)
+{
+	EXPECT_EQ(0u, m_sut.advance(TIME_STEP / 2.0f));
+	EXPECT_FLOAT_EQ(0.5f, m_sut.getInterpolationAlpha());
+}
+
+TEST_F(FixedTimestepLoopTestSuite, advanceShouldUpdateSystemsWithFixedTimeStep)
+{
+	EXPECT_CALL(m_systemsMock, update(TIME_STEP)).Times(2);
+
+	EXPECT_EQ(2u, m_sut.advance(TIME_STEP * 2.5f));
+	EXPECT_FLOAT_EQ(0.5f, m_sut.getInterpolationAlpha());
+	EXPECT_EQ(2u, m_sut.getStats().nrOfTicks);
+}
+
+TEST_F(FixedTimestepLoopTestSuite, accumulatedTimeShouldBeConsumedByLaterAdvances)
+{
+	EXPECT_CALL(m_systemsMock, update(TIME_STEP)).Times(1);
+
+	EXPECT_EQ(0u, m_sut.advance(TIME_STEP * 0.75f));
+	EXPECT_EQ(1u, m_sut.advance(TIME_STEP * 0.75f));
+}
+
+TEST_F(FixedTimestepLoopTestSuite, excessTimeShouldBeDroppedWhenCatchUpCapIsReached)
+{
+	EXPECT_CALL(m_systemsMock, update(TIME_STEP)).Times(MAX_TICKS);
+
+	EXPECT_EQ(MAX_TICKS, m_sut.advance(TIME_STEP * 5.5f));
+	EXPECT_EQ(2u, m_sut.getStats().nrOfDroppedTicks);
+	EXPECT_FLOAT_EQ(0.5f, m_sut.getInterpolationAlpha());
+}
+
+TEST_F(FixedTimestepLoopTestSuite, excessTimeShouldBeKeptWithoutSpiralProtection)
+{
+	FixedTimestepLoop l_loop(m_systemsMock, createSettings(false));
+	EXPECT_CALL(m_systemsMock, update(TIME_STEP)).Times(MAX_TICKS + 2u);
+
+	EXPECT_EQ(MAX_TICKS, l_loop.advance(TIME_STEP * 5.0f));
+	EXPECT_EQ(2u, l_loop.advance(0.0f));
+	EXPECT_EQ(0u, l_loop.getStats().nrOfDroppedTicks);
+}
+
+TEST_F(FixedTimestepLoopTestSuite, elapsedTimeShouldBeClamped)
+{
+	FixedTimestepSettings l_settings = createSettings(false);
+	l_settings.maxTicksPerAdvance = 0u;
+	FixedTimestepLoop l_loop(m_systemsMock, l_settings);
+
+	const u32 l_ticksInMaxElapsedTime = static_cast<u32>(MAX_ELAPSED_TIME / TIME_STEP);
+	EXPECT_CALL(m_systemsMock, update(TIME_STEP)).Times(l_ticksInMaxElapsedTime);
+
+	EXPECT_EQ(l_ticksInMaxElapsedTime, l_loop.advance(MAX_ELAPSED_TIME * 10.0f));
+}
+
+TEST_F(FixedTimestepLoopTestSuite, unpacedRunShouldExecuteRequestedNumberOfTicks)
+{
+	const u64 l_nrOfTicks = 10u;
+	EXPECT_CALL(m_systemsMock, update(TIME_STEP)).Times(l_nrOfTicks);
+
+	EXPECT_EQ(l_nrOfTicks, m_sut.run(l_nrOfTicks, false));
+
+	const auto& l_stats = m_sut.getStats();
+	EXPECT_EQ(l_nrOfTicks, l_stats.nrOfTicks);
+	EXPECT_LE(l_stats.minTickTime, l_stats.maxTickTime);
+	EXPECT_GE(l_stats.totalTickTime, 0.0);
+	EXPECT_GE(l_stats.totalTickCpuTime, 0.0);
+}
+
+TEST_F(FixedTimestepLoopTestSuite, waitingInTickShouldCountOnlyToWallTime)
+{
+	EXPECT_CALL(m_systemsMock, update(TIME_STEP)).WillOnce(Invoke([](f32) { std::this_thread::sleep_for(WAITING_TICK_DURATION); }));
+
+	m_sut.tick();
+
+	const auto& l_stats = m_sut.getStats();
+	EXPECT_GE(l_stats.lastTickTime, static_cast<f64>(WAITING_TICK_DURATION.count()));
+	EXPECT_LT(l_stats.lastTickCpuTime, l_stats.lastTickTime / 2.0);
+	EXPECT_EQ(l_stats.lastTickCpuTime, l_stats.getAverageTickCpuTime());
+}
+
+TEST_F(FixedTimestepLoopTestSuite, runShouldStopWhenRequested)
+{
+	EXPECT_CALL(m_systemsMock, update(TIME_STEP)).Times(2).WillOnce(Return()).WillOnce(Invoke([this](f32) { m_sut.requestStop(); }));
+
+	EXPECT_EQ(2u, m_sut.run(0u, false));
+}
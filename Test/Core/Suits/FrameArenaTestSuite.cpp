@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <cstdint>
+#include <thread>
+#include "Core.h"
+#include "FrameArena.h"
+
+using namespace testing;
+using namespace engine;
+
+namespace
+{
+const std::size_t BYTES_PER_THREAD = 1024u;
+const u32 NR_OF_THREADS = 4u;
+const u32 MAIN_THREAD = 0u;
+const u32 WORKER_THREAD = 1u;
+
+const std::size_t SMALL_ALLOCATION = 100u;
+const std::size_t BIG_ALLOCATION = 1000u;
+const std::size_t ALIGNMENT = 32u;
+
+const u32 NR_OF_ELEMENTS = 64u;
+const u32 NR_OF_ALLOCATIONS_PER_THREAD = 10u;
+
+bool isAligned(const void* p_address, std::size_t p_alignment)
+{
+	return reinterpret_cast<std::uintptr_t>(p_address) % p_alignment == 0u;
+}
+}
+
+class FrameArenaTestSuite : public Test
+{
+public:
+	FrameArenaTestSuite()
+		:m_sut(BYTES_PER_THREAD, NR_OF_THREADS)
+	{
+	}
+
+protected:
+	FrameArena m_sut;
+};
+
+TEST_F(FrameArenaTestSuite, AllocationsAreAlignedAndDoNotOverlap)
+{
+	auto l_first = static_cast<u8*>(m_sut.allocate(1u));
+	auto l_second = static_cast<u8*>(m_sut.allocate(SMALL_ALLOCATION, ALIGNMENT));
+
+	ASSERT_NE(nullptr, l_first);
+	ASSERT_NE(nullptr, l_second);
+	EXPECT_TRUE(isAligned(l_first, FrameArena::DEFAULT_ALIGNMENT));
+	EXPECT_TRUE(isAligned(l_second, ALIGNMENT));
+	EXPECT_GT(l_second, l_first);
+}
+
+TEST_F(FrameArenaTestSuite, AllocationFailsWhenSubArenaIsExhausted)
+{
+	EXPECT_NE(nullptr, m_sut.allocate(BIG_ALLOCATION));
+	EXPECT_EQ(nullptr, m_sut.allocate(BIG_ALLOCATION));
+
+	const auto l_stats = m_sut.getStats(MAIN_THREAD);
+	EXPECT_EQ(1u, l_stats.nrOfFailedAllocations);
+	EXPECT_GT(l_stats.highWaterMark, l_stats.capacity);
+}
+
+TEST_F(FrameArenaTestSuite, SubArenasAreIndependent)
+{
+	EXPECT_NE(nullptr, m_sut.allocate(BIG_ALLOCATION, FrameArena::DEFAULT_ALIGNMENT, MAIN_THREAD));
+	EXPECT_NE(nullptr, m_sut.allocate(BIG_ALLOCATION, FrameArena::DEFAULT_ALIGNMENT, WORKER_THREAD));
+
+	EXPECT_EQ(BIG_ALLOCATION, m_sut.getStats(MAIN_THREAD).usedBytes);
+	EXPECT_EQ(BIG_ALLOCATION, m_sut.getStats(WORKER_THREAD).usedBytes);
+}
+
+TEST_F(FrameArenaTestSuite, ResetReleasesWholeFrameAndKeepsHighWaterMark)
+{
+	auto l_first = m_sut.allocate(BIG_ALLOCATION);
+	m_sut.reset();
+
+	EXPECT_EQ(0u, m_sut.getStats(MAIN_THREAD).usedBytes);
+	EXPECT_EQ(BIG_ALLOCATION, m_sut.getHighWaterMark());
+
+	EXPECT_EQ(l_first, m_sut.allocate(SMALL_ALLOCATION));
+	EXPECT_EQ(SMALL_ALLOCATION, m_sut.getStats(MAIN_THREAD).usedBytes);
+	EXPECT_EQ(BIG_ALLOCATION, m_sut.getHighWaterMark());
+}
+
+TEST_F(FrameArenaTestSuite, ResetStatsLowersHighWaterMarkToCurrentUsage)
+{
+	m_sut.allocate(BIG_ALLOCATION);
+	m_sut.reset();
+	m_sut.allocate(SMALL_ALLOCATION);
+
+	m_sut.resetStats();
+
+	EXPECT_EQ(SMALL_ALLOCATION, m_sut.getHighWaterMark());
+}
+
+TEST_F(FrameArenaTestSuite, ThreadsCanAllocateFromOwnSubArenasConcurrently)
+{
+	std::vector<std::thread> l_threads;
+
+	for (auto l_threadIndex = 0u; l_threadIndex < NR_OF_THREADS; l_threadIndex++)
+	{
+		l_threads.emplace_back([this, l_threadIndex]()
+		{
+			for (auto i = 0u; i < NR_OF_ALLOCATIONS_PER_THREAD; i++)
+			{
+				auto l_values = m_sut.allocateArray<u32>(1u, l_threadIndex);
+				*l_values = l_threadIndex;
+			}
+		});
+	}
+
+	for (auto& l_thread : l_threads)
+	{
+		l_thread.join();
+	}
+
+	for (auto l_threadIndex = 0u; l_threadIndex < NR_OF_THREADS; l_threadIndex++)
+	{
+		EXPECT_EQ(0u, m_sut.getStats(l_threadIndex).nrOfFailedAllocations);
+		EXPECT_GT(m_sut.getStats(l_threadIndex).usedBytes, 0u);
+	}
+}
+
+TEST_F(FrameArenaTestSuite, FrameAllocatorBacksStlContainer)
+{
+	FrameVector<u32> l_values{ FrameAllocator<u32>(m_sut, WORKER_THREAD) };
+	l_values.reserve(NR_OF_ELEMENTS);
+
+	for (auto i = 0u; i < NR_OF_ELEMENTS; i++)
+	{
+		l_values.push_back(i);
+	}
+
+	EXPECT_EQ(NR_OF_ELEMENTS * sizeof(u32), m_sut.getStats(WORKER_THREAD).usedBytes);
+	EXPECT_EQ(0u, m_sut.getStats(MAIN_THREAD).usedBytes);
+	EXPECT_EQ(NR_OF_ELEMENTS - 1u, l_values.back());
+}
+
+TEST_F(FrameArenaTestSuite, FrameAllocatorThrowsWhenArenaIsExhausted)
+{
+	FrameVector<u8> l_values{ FrameAllocator<u8>(m_sut) };
+
+	EXPECT_THROW(l_values.reserve(BYTES_PER_THREAD + 1u), std::bad_alloc);
+}
@@ -1,5 +1,5 @@
-#include <gtest\gtest.h>
-#include <gmock\gmock.h>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
 #include "Core.h"
 #include "IdGuard.h"
 
@@ -23,6 +23,8 @@ public:
 	}
 
 protected:
+	//outlives m_sut - attached guard removes its sampled gauges when destroyed
+	MetricsRegistry m_registry;
 	IdGuard m_sut;
 };
 
@@ -97,6 +99,46 @@ TEST_F(IdGuardTestSuite, shouldBePossibleToFreeIdWhenLastCorrectIdHasBeenReturne
 	EXPECT_EQ(l_id1, l_freedId);
 }
 
+TEST_F(IdGuardTestSuite, idFreedTwiceShouldBeReturnedOnlyOnce)
+{
+	auto l_id = m_sut.getNextId();
+	m_sut.getNextId();
+
+	m_sut.freeId(l_id);
+	m_sut.freeId(l_id);
+
+	EXPECT_EQ(l_id, m_sut.getNextId());
+	EXPECT_EQ(ID_2 + 1u, m_sut.getNextId());
+}
+
+TEST_F(IdGuardTestSuite, idWhichWasNotGivenShouldNotBeFreed)
+{
+	m_sut.getNextId();
+
+	m_sut.freeId(ID_2);
+	m_sut.freeId(engine::UNDEFINED_ID);
+
+	EXPECT_EQ(ID_2, m_sut.getNextId());
+	EXPECT_EQ(ID_2 + 1u, m_sut.getNextId());
+}
+
+TEST_F(IdGuardTestSuite, restoredFreedIdsShouldBeProtectedAgainstDoubleFree)
+{
+	m_sut.getNextId();
+	m_sut.getNextId();
+	m_sut.freeId(ID_1);
+
+	Id l_freedIds[MAX_ID] = {};
+	auto l_state = m_sut.saveState(l_freedIds, MAX_ID);
+
+	m_sut.reset();
+	m_sut.restoreState(l_state, l_freedIds);
+	m_sut.freeId(ID_1);
+
+	EXPECT_EQ(ID_1, m_sut.getNextId());
+	EXPECT_EQ(ID_2 + 1u, m_sut.getNextId());
+}
+
 TEST_F(IdGuardTestSuite, resetShouldClearGuardState)
 {
 	auto l_firstId = m_sut.getNextId();
@@ -131,6 +173,87 @@ TEST_F(IdGuardTestSuite, resetShouldClearOverloadState)
 	EXPECT_EQ(l_firstId, l_idGuard.getNextId());
 }
 
+TEST_F(IdGuardTestSuite, saveStateShouldWriteCountersAndFreedIds)
+{
+	m_sut.getNextId();
+	m_sut.getNextId();
+	m_sut.freeId(ID_1);
+
+	Id l_freedIds[MAX_ID] = {};
+	auto l_state = m_sut.saveState(l_freedIds, MAX_ID);
+
+	EXPECT_EQ(ID_2, l_state.currentId);
+	EXPECT_EQ(1u, l_state.nrOfFreedIds);
+	EXPECT_EQ(0u, l_state.overflowed);
+	EXPECT_EQ(ID_1, l_freedIds[0]);
+}
+
+TEST_F(IdGuardTestSuite, restoreStateShouldBringBackSavedIdSequence)
+{
+	m_sut.getNextId();
+	m_sut.getNextId();
+	m_sut.freeId(ID_1);
+
+	Id l_freedIds[MAX_ID] = {};
+	auto l_state = m_sut.saveState(l_freedIds, MAX_ID);
+
+	auto l_firstId = m_sut.getNextId();
+	auto l_secondId = m_sut.getNextId();
+
+	m_sut.reset();
+	m_sut.restoreState(l_state, l_freedIds);
+
+	EXPECT_EQ(l_firstId, m_sut.getNextId());
+	EXPECT_EQ(l_secondId, m_sut.getNextId());
+}
+
+TEST_F(IdGuardTestSuite, attachedMetricsShouldSampleFreeListLengthAndCurrentId)
+{
+	m_sut.attachMetrics(m_registry, "ids");
+	metrics::MetricsSnapshot l_snapshot;
+
+	auto l_id = m_sut.getNextId();
+	m_sut.getNextId();
+	m_sut.freeId(l_id);
+	m_registry.takeSnapshot(l_snapshot);
+
+	EXPECT_EQ(1, l_snapshot.find("ids.freedIds")->value);
+	EXPECT_EQ(static_cast<s64>(ID_2), l_snapshot.find("ids.currentId")->value);
+
+	m_sut.getNextId();
+	m_registry.takeSnapshot(l_snapshot);
+
+	EXPECT_EQ(0, l_snapshot.find("ids.freedIds")->value);
+	EXPECT_EQ(0, l_snapshot.find("ids.overflowed")->value);
+}
+
+TEST_F(IdGuardTestSuite, attachedMetricsShouldReportOverflow)
+{
+	m_sut.attachMetrics(m_registry, "ids");
+
+	for (auto i = 0u; i <= MAX_ID; i++)
+	{
+		m_sut.getNextId();
+	}
+
+	metrics::MetricsSnapshot l_snapshot;
+	m_registry.takeSnapshot(l_snapshot);
+
+	EXPECT_EQ(1, l_snapshot.find("ids.overflowed")->value);
+}
+
+#if defined(ENGINE_METRICS)
+TEST_F(IdGuardTestSuite, attachedMetricsShouldCountRecycledIds)
+{
+	m_sut.attachMetrics(m_registry, "ids");
+
+	m_sut.freeId(m_sut.getNextId());
+	m_sut.getNextId();
+
+	EXPECT_EQ(1u, m_registry.getCounter("ids.recycledIds").get());
+}
+#endif
+
 /*
 Note:
 Guard should not be recovered after oveflow - this situation indicates a problem in other parts!
@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <vector>
+#include "Core.h"
+#include "IntegrationKernels.h"
+
+using namespace testing;
+using namespace engine;
+
+namespace
+{
+//odd count - kernels have to process vectorized part and scalar tail
+const u32 NR_OF_ELEMENTS = 37u;
+const f32 DELTA_TIME = 1.0f / 60.0f;
+}
+
+class IntegrationKernelsTestSuite : public TestWithParam<SimdLevel>
+{
+public:
+	IntegrationKernelsTestSuite()
+		:m_positionsX(NR_OF_ELEMENTS),
+		 m_positionsY(NR_OF_ELEMENTS),
+		 m_velocitiesX(NR_OF_ELEMENTS),
+		 m_velocitiesY(NR_OF_ELEMENTS)
+	{
+		for (auto i = 0u; i < NR_OF_ELEMENTS; i++)
+		{
+			m_positionsX[i] = static_cast<f32>(i) * 1.5f;
+			m_positionsY[i] = static_cast<f32>(i) * -0.25f;
+			m_velocitiesX[i] = static_cast<f32>(i % 7) - 3.0f;
+			m_velocitiesY[i] = static_cast<f32>(i % 5) * 0.75f;
+		}
+	}
+
+protected:
+	void integrate(IntegrationKernel p_kernel, std::vector<f32>& p_positionsX, std::vector<f32>& p_positionsY)
+	{
+		p_kernel(p_positionsX.data(), p_positionsY.data(), m_velocitiesX.data(), m_velocitiesY.data(), NR_OF_ELEMENTS, DELTA_TIME);
+	}
+
+	std::vector<f32> m_positionsX;
+	std::vector<f32> m_positionsY;
+	std::vector<f32> m_velocitiesX;
+	std::vector<f32> m_velocitiesY;
+};
+
+TEST_P(IntegrationKernelsTestSuite, kernelShouldGiveTheSameResultAsScalarFallback)
+{
+	if (not kernels::isSimdLevelSupported(GetParam()))
+	{
+		return;
+	}
+
+	auto l_expectedX = m_positionsX;
+	auto l_expectedY = m_positionsY;
+	integrate(&kernels::integrateScalar, l_expectedX, l_expectedY);
+
+	integrate(kernels::getIntegrationKernel(GetParam()), m_positionsX, m_positionsY);
+
+	EXPECT_EQ(l_expectedX, m_positionsX);
+	EXPECT_EQ(l_expectedY, m_positionsY);
+}
+
+TEST_P(IntegrationKernelsTestSuite, kernelShouldNotTouchElementsAfterCount)
+{
+	if (not kernels::isSimdLevelSupported(GetParam()))
+	{
+		return;
+	}
+
+	const auto l_count = NR_OF_ELEMENTS - 1u;
+	const auto l_lastX = m_positionsX.back();
+
+	kernels::getIntegrationKernel(GetParam())(m_positionsX.data(), m_positionsY.data(), m_velocitiesX.data(), m_velocitiesY.data(), l_count, DELTA_TIME);
+
+	EXPECT_EQ(l_lastX, m_positionsX.back());
+}
+
+INSTANTIATE_TEST_CASE_P(AllSimdLevels, IntegrationKernelsTestSuite, Values(SimdLevel::SCALAR, SimdLevel::SSE2, SimdLevel::AVX2));
+
+TEST(IntegrationKernelsDispatchTestSuite, scalarLevelIsAlwaysSupported)
+{
+	EXPECT_TRUE(kernels::isSimdLevelSupported(SimdLevel::SCALAR));
+	EXPECT_EQ(&kernels::integrateScalar, kernels::getIntegrationKernel(SimdLevel::SCALAR));
+}
+
+TEST(IntegrationKernelsDispatchTestSuite, bestKernelMatchesDetectedLevel)
+{
+	EXPECT_EQ(kernels::getIntegrationKernel(kernels::detectSimdLevel()), kernels::getBestIntegrationKernel());
+}
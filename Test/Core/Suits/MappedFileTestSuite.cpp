@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <filesystem>
+#include <fstream>
+#include "Core.h"
+#include "MappedFile.h"
+
+using namespace testing;
+using namespace engine;
+
+namespace
+{
+const std::string FILE_NAME = "mappedFileTestSuite.bin";
+const std::string NOT_EXISTING_FILE = "notExistingMappedFile.bin";
+const std::string CONTENT = "mapped content";
+const u8 CHANGED_BYTE = 'X';
+}
+
+class MappedFileTestSuite : public Test
+{
+public:
+	MappedFileTestSuite()
+		:m_path((std::filesystem::temp_directory_path() / FILE_NAME).string())
+	{
+		std::ofstream l_file(m_path, std::ios::binary);
+		l_file << CONTENT;
+	}
+
+	~MappedFileTestSuite()
+	{
+		m_sut.close();
+		std::filesystem::remove(m_path);
+	}
+
+protected:
+	std::string m_path;
+	MappedFile m_sut;
+};
+
+TEST_F(MappedFileTestSuite, FileContentIsAvailableAfterOpen)
+{
+	ASSERT_TRUE(m_sut.open(m_path));
+
+	EXPECT_TRUE(m_sut.isOpen());
+	ASSERT_EQ(CONTENT.size(), m_sut.size());
+	EXPECT_EQ(CONTENT, std::string(reinterpret_cast<const char*>(m_sut.data()), m_sut.size()));
+}
+
+TEST_F(MappedFileTestSuite, ChangesInMemoryAreNotWrittenToFile)
+{
+	ASSERT_TRUE(m_sut.open(m_path));
+	m_sut.data()[0] = CHANGED_BYTE;
+	m_sut.close();
+
+	ASSERT_TRUE(m_sut.open(m_path));
+	EXPECT_EQ(static_cast<u8>(CONTENT[0]), m_sut.data()[0]);
+}
+
+TEST_F(MappedFileTestSuite, NotExistingFileCannotBeOpened)
+{
+	EXPECT_FALSE(m_sut.open((std::filesystem::temp_directory_path() / NOT_EXISTING_FILE).string()));
+	EXPECT_FALSE(m_sut.isOpen());
+}
@@ -0,0 +1,160 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <sstream>
+#include <thread>
+#include <vector>
+#include "Core.h"
+#include "MetricsRegistry.h"
+
+using namespace testing;
+using namespace engine;
+
+namespace
+{
+const std::string COUNTER_NAME = "test.counter";
+const std::string GAUGE_NAME = "test.gauge";
+const std::string HISTOGRAM_NAME = "test.histogram";
+
+const u32 NR_OF_THREADS = 4u;
+const u32 INCREMENTS_PER_THREAD = 10000u;
+}
+
+class MetricsRegistryTestSuite : public Test
+{
+public:
+	MetricsRegistryTestSuite() = default;
+
+protected:
+	MetricsRegistry m_sut;
+};
+
+TEST_F(MetricsRegistryTestSuite, metricWithTheSameNameShouldBeRegisteredOnce)
+{
+	auto& l_first = m_sut.getCounter(COUNTER_NAME);
+	auto& l_second = m_sut.getCounter(COUNTER_NAME);
+
+	EXPECT_EQ(&l_first, &l_second);
+	EXPECT_EQ(1u, m_sut.getNumOfMetrics());
+}
+
+TEST_F(MetricsRegistryTestSuite, counterShouldNotLoseIncrementsFromConcurrentThreads)
+{
+	auto& l_counter = m_sut.getCounter(COUNTER_NAME);
+	std::vector<std::thread> l_threads;
+
+	for (auto i = 0u; i < NR_OF_THREADS; i++)
+	{
+		l_threads.emplace_back([&l_counter]()
+		{
+			for (auto j = 0u; j < INCREMENTS_PER_THREAD; j++)
+			{
+				l_counter.add();
+			}
+		});
+	}
+
+	for (auto& l_thread : l_threads)
+	{
+		l_thread.join();
+	}
+
+	EXPECT_EQ(NR_OF_THREADS * INCREMENTS_PER_THREAD, l_counter.get());
+}
+
+TEST_F(MetricsRegistryTestSuite, gaugeSetMaxShouldKeepHighestValue)
+{
+	auto& l_gauge = m_sut.getGauge(GAUGE_NAME);
+
+	l_gauge.setMax(5);
+	l_gauge.setMax(3);
+
+	EXPECT_EQ(5, l_gauge.get());
+}
+
+TEST_F(MetricsRegistryTestSuite, histogramShouldPutValuesIntoPowerOfTwoBuckets)
+{
+	auto& l_histogram = m_sut.getHistogram(HISTOGRAM_NAME);
+
+	l_histogram.record(0u);
+	l_histogram.record(3u);
+	l_histogram.record(4u);
+	l_histogram.record(7u);
+
+	EXPECT_EQ(1u, l_histogram.getBucket(0u));
+	EXPECT_EQ(1u, l_histogram.getBucket(2u));
+	EXPECT_EQ(2u, l_histogram.getBucket(3u));
+	EXPECT_EQ(4u, l_histogram.getCount());
+	EXPECT_EQ(14u, l_histogram.getSum());
+}
+
+TEST_F(MetricsRegistryTestSuite, histogramPercentileShouldReturnUpperBoundOfBucket)
+{
+	auto& l_histogram = m_sut.getHistogram(HISTOGRAM_NAME);
+
+	for (auto i = 0u; i < 99u; i++)
+	{
+		l_histogram.record(2u);
+	}
+	l_histogram.record(1000u);
+
+	EXPECT_EQ(3u, l_histogram.getPercentile(0.5));
+	EXPECT_EQ(3u, l_histogram.getPercentile(0.99));
+	EXPECT_EQ(1023u, l_histogram.getPercentile(1.0));
+}
+
+TEST_F(MetricsRegistryTestSuite, snapshotShouldContainAllMetricsAndReuseItsStorage)
+{
+	m_sut.getCounter(COUNTER_NAME).add(3u);
+	m_sut.getGauge(GAUGE_NAME).set(-2);
+	m_sut.getHistogram(HISTOGRAM_NAME).record(4u);
+
+	metrics::MetricsSnapshot l_snapshot;
+	m_sut.takeSnapshot(l_snapshot);
+	const auto l_storage = l_snapshot.samples.data();
+	m_sut.takeSnapshot(l_snapshot);
+
+	ASSERT_EQ(3u, l_snapshot.samples.size());
+	EXPECT_EQ(l_storage, l_snapshot.samples.data());
+
+	EXPECT_EQ(COUNTER_NAME, l_snapshot.samples[0].name);
+	EXPECT_EQ(3, l_snapshot.samples[0].value);
+	EXPECT_EQ(-2, l_snapshot.samples[1].value);
+	EXPECT_EQ(metrics::MetricType::HISTOGRAM, l_snapshot.samples[2].type);
+	EXPECT_EQ(1, l_snapshot.samples[2].value);
+	EXPECT_EQ(4u, l_snapshot.samples[2].sum);
+}
+
+TEST_F(MetricsRegistryTestSuite, sampledGaugeShouldBeReadWhenSnapshotIsTakenUntilOwnerRemovesIt)
+{
+	s64 l_value = 1;
+	m_sut.addSampledGauge(GAUGE_NAME, &l_value, [&l_value]() { return l_value; });
+	l_value = 5;
+
+	metrics::MetricsSnapshot l_snapshot;
+	m_sut.takeSnapshot(l_snapshot);
+
+	ASSERT_NE(nullptr, l_snapshot.find(GAUGE_NAME));
+	EXPECT_EQ(metrics::MetricType::GAUGE, l_snapshot.find(GAUGE_NAME)->type);
+	EXPECT_EQ(5, l_snapshot.find(GAUGE_NAME)->value);
+
+	m_sut.removeSampledGauges(&l_value);
+	m_sut.takeSnapshot(l_snapshot);
+
+	EXPECT_EQ(nullptr, l_snapshot.find(GAUGE_NAME));
+}
+
+TEST_F(MetricsRegistryTestSuite, writeSnapshotShouldWriteOneJsonLine)
+{
+	m_sut.getCounter(COUNTER_NAME).add(3u);
+	m_sut.getHistogram(HISTOGRAM_NAME).record(4u);
+
+	metrics::MetricsSnapshot l_snapshot;
+	m_sut.takeSnapshot(l_snapshot);
+
+	std::stringstream l_output;
+	ASSERT_TRUE(MetricsRegistry::writeSnapshot(l_output, l_snapshot));
+
+	const auto l_line = l_output.str();
+	EXPECT_THAT(l_line, StartsWith("{\"timestamp\":"));
+	EXPECT_THAT(l_line, HasSubstr("\"metrics\":{\"test.counter\":3,\"test.histogram\":{\"count\":1,\"sum\":4,\"p50\":7,\"p99\":7}}}\n"));
+}
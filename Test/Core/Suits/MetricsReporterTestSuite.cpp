@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include "Core.h"
+#include "MetricsReporter.h"
+
+using namespace testing;
+using namespace engine;
+
+namespace
+{
+const std::string FILE_NAME = "metricsReporterTestSuite.jsonl";
+const std::string COUNTER_NAME = "test.changes";
+const f32 INTERVAL = 1.0f;
+const f32 DELTA_TIME = 0.25f;
+
+u32 countLines(const std::string& p_path)
+{
+	std::ifstream l_file(p_path);
+	std::string l_line;
+	u32 l_nrOfLines = 0u;
+
+	while (std::getline(l_file, l_line))
+	{
+		l_nrOfLines++;
+	}
+
+	return l_nrOfLines;
+}
+}
+
+class MetricsReporterTestSuite : public Test
+{
+public:
+	MetricsReporterTestSuite()
+		:m_path((std::filesystem::temp_directory_path() / FILE_NAME).string()),
+		 m_sut(m_registry, m_path, INTERVAL)
+	{
+		std::filesystem::remove(m_path);
+	}
+
+	~MetricsReporterTestSuite()
+	{
+		std::filesystem::remove(m_path);
+	}
+
+protected:
+	std::string m_path;
+	MetricsRegistry m_registry;
+	MetricsReporter m_sut;
+};
+
+TEST_F(MetricsReporterTestSuite, snapshotShouldBeAppendedToFileOncePerInterval)
+{
+	m_registry.getCounter(COUNTER_NAME).add();
+
+	for (auto i = 0u; i < 9u; i++)
+	{
+		m_sut.update(DELTA_TIME);
+	}
+
+	EXPECT_EQ(2u, countLines(m_path));
+	ASSERT_EQ(1u, m_sut.getLastSnapshot().samples.size());
+	EXPECT_EQ(1, m_sut.getLastSnapshot().samples[0].value);
+}
+
+TEST_F(MetricsReporterTestSuite, trackedCounterShouldRecordIncrementsOfEveryTick)
+{
+	auto& l_counter = m_registry.getCounter(COUNTER_NAME);
+	l_counter.add(100u);
+	m_sut.trackPerTick(COUNTER_NAME);
+
+	l_counter.add(2u);
+	m_sut.update(DELTA_TIME);
+	l_counter.add(6u);
+	m_sut.update(DELTA_TIME);
+
+	auto& l_perTick = m_registry.getHistogram(COUNTER_NAME + ".perTick");
+	EXPECT_EQ(2u, l_perTick.getCount());
+	EXPECT_EQ(8u, l_perTick.getSum());
+}
+
+TEST_F(MetricsReporterTestSuite, dumpShouldFailWhenFileCannotBeOpened)
+{
+	MetricsReporter l_reporter(m_registry, (std::filesystem::temp_directory_path() / "notExistingDirectory" / FILE_NAME).string(), INTERVAL);
+
+	EXPECT_FALSE(l_reporter.dump());
+}
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <cstdint>
+#include <cstring>
+#include "Core.h"
+#include "PageBackedMemoryResource.h"
+#include "Pool.h"
+
+using namespace testing;
+using namespace engine;
+
+namespace
+{
+const std::size_t SMALL_BLOCK = 100u;
+const std::size_t BIG_BLOCK = 3u * 1024u * 1024u;
+const std::size_t ALIGNMENT = 64u;
+const PoolSize POOL_SIZE = 100000u;
+const EntityId ENTITY_ID = 7u;
+
+bool isAligned(const void* p_address, std::size_t p_alignment)
+{
+	return reinterpret_cast<std::uintptr_t>(p_address) % p_alignment == 0u;
+}
+
+PageBackingSettings createSettings(PageSize p_pageSize, s32 p_numaNode = ANY_NUMA_NODE)
+{
+	PageBackingSettings l_settings;
+	l_settings.pageSize = p_pageSize;
+	l_settings.numaNode = p_numaNode;
+	return l_settings;
+}
+}
+
+class PageBackedMemoryResourceTestSuite : public Test
+{
+};
+
+TEST_F(PageBackedMemoryResourceTestSuite, StandardPagesAreUsedWhenRequested)
+{
+	PageBackedMemoryResource l_sut(createSettings(PageSize::STANDARD));
+
+	auto l_memory = l_sut.allocate(SMALL_BLOCK, ALIGNMENT);
+	ASSERT_NE(nullptr, l_memory);
+	EXPECT_TRUE(isAligned(l_memory, PageBackedMemoryResource::STANDARD_PAGE_SIZE));
+	EXPECT_EQ(PageBacking::STANDARD_PAGES, l_sut.getLastBacking());
+
+	std::memset(l_memory, 0xFF, SMALL_BLOCK);
+	l_sut.deallocate(l_memory, SMALL_BLOCK, ALIGNMENT);
+
+	EXPECT_EQ(1u, l_sut.getStats().nrOfStandardPageAllocations);
+}
+
+TEST_F(PageBackedMemoryResourceTestSuite, LargePagesFallBackGracefully)
+{
+	PageBackedMemoryResource l_sut(createSettings(PageSize::LARGE));
+
+	auto l_memory = l_sut.allocate(BIG_BLOCK, ALIGNMENT);
+	ASSERT_NE(nullptr, l_memory);
+	std::memset(l_memory, 0xFF, BIG_BLOCK);
+
+	if (l_sut.getLastBacking() != PageBacking::STANDARD_PAGES)
+	{
+		EXPECT_TRUE(isAligned(l_memory, PageBackedMemoryResource::HUGE_PAGE_SIZE));
+	}
+
+	const auto l_stats = l_sut.getStats();
+	EXPECT_EQ(1u, l_stats.nrOfStandardPageAllocations + l_stats.nrOfTransparentHugePageAllocations + l_stats.nrOfExplicitHugePageAllocations);
+
+	l_sut.deallocate(l_memory, BIG_BLOCK, ALIGNMENT);
+}
+
+TEST_F(PageBackedMemoryResourceTestSuite, NumaBindingToCurrentNodeDoesNotBreakAllocation)
+{
+	PageBackedMemoryResource l_sut(createSettings(PageSize::LARGE, PageBackedMemoryResource::getCurrentNumaNode()));
+
+	auto l_memory = l_sut.allocate(BIG_BLOCK, ALIGNMENT);
+	ASSERT_NE(nullptr, l_memory);
+	std::memset(l_memory, 0xFF, BIG_BLOCK);
+
+	l_sut.deallocate(l_memory, BIG_BLOCK, ALIGNMENT);
+}
+
+TEST_F(PageBackedMemoryResourceTestSuite, ContinuousPoolCanBeBackedByLargePages)
+{
+	PageBackedMemoryResource l_resource(createSettings(PageSize::LARGE));
+	ContinuousPool<Entity> l_pool(POOL_SIZE, l_resource);
+
+	l_pool.allocate(ENTITY_ID);
+
+	EXPECT_EQ(ENTITY_ID, l_pool.begin()->id);
+	EXPECT_EQ(&l_resource, &l_pool.getMemoryResource());
+}
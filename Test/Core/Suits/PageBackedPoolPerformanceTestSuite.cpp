@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+#include "Core.h"
+#include "Stopwatch.h"
+#include "TestEnities.h"
+#include "PageBackedMemoryResource.h"
+
+using namespace testing;
+using namespace engine;
+using namespace testEntity;
+
+namespace
+{
+	const bool ENABLED = true;
+	const bool DISABLED = false;
+
+	const PoolSize POOL_SIZE = 4000000u;
+	const u32 LOOPS = 10u;
+
+	//TESTS:
+	const bool compareStandardAndHugePages = DISABLED;
+}
+
+class PageBackedPoolPerformanceTestSuite : public Test
+{
+public:
+	PageBackedPoolPerformanceTestSuite() = default;
+
+	void startStopwatch()
+	{
+		m_stopwatch.start();
+	}
+
+	void stopStopwatch()
+	{
+		m_stopwatch.stop();
+		std::cout << "Measured time: " << m_stopwatch.getElapsedTime().count() << "ms \n\n";
+	}
+
+	void fillPool(ContinuousPool<Entity64>& p_pool)
+	{
+		for (auto i = 0u; i < POOL_SIZE; i++)
+		{
+			p_pool.allocate().content[0] = static_cast<Byte>(i);
+		}
+	}
+
+	std::vector<Entity64*> createShuffledAccessOrder(ContinuousPool<Entity64>& p_pool)
+	{
+		std::vector<Entity64*> l_order;
+		l_order.reserve(p_pool.size());
+
+		for (auto& l_element : p_pool)
+		{
+			l_order.push_back(&l_element);
+		}
+
+		std::shuffle(l_order.begin(), l_order.end(), std::mt19937(3u));
+		return l_order;
+	}
+
+	void measurePool(PageSize p_pageSize, const char* p_name)
+	{
+		PageBackingSettings l_settings;
+		l_settings.pageSize = p_pageSize;
+		l_settings.numaNode = PageBackedMemoryResource::getCurrentNumaNode();
+
+		PageBackedMemoryResource l_resource(l_settings);
+		ContinuousPool<Entity64> l_pool(POOL_SIZE, l_resource);
+		fillPool(l_pool);
+		auto l_order = createShuffledAccessOrder(l_pool);
+
+		std::cout << p_name << " (backing: " << static_cast<int>(l_resource.getLastBacking()) << "), sequential iteration: \n";
+		u32 l_checksum = 0u;
+
+		startStopwatch();
+		for (auto i = 0u; i < LOOPS; i++)
+			for (auto& l_element : l_pool)
+				l_checksum += static_cast<u8>(l_element.content[0]);
+		stopStopwatch();
+
+		std::cout << p_name << ", random access: \n";
+
+		startStopwatch();
+		for (auto i = 0u; i < LOOPS; i++)
+			for (auto l_element : l_order)
+				l_checksum += static_cast<u8>(l_element->content[0]);
+		stopStopwatch();
+
+		std::cout << "Checksum: " << l_checksum << "\n\n";
+	}
+
+protected:
+	testTool::Stopwatch m_stopwatch;
+};
+
+TEST_F(PageBackedPoolPerformanceTestSuite, compareStandardAndHugePages)
+{
+	if (not compareStandardAndHugePages)
+		return;
+
+	measurePool(PageSize::STANDARD, "4KB pages");
+	measurePool(PageSize::LARGE, "2MB pages");
+}
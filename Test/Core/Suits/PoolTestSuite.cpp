@@ -1,6 +1,5 @@
-#pragma once
-#include <gtest\gtest.h>
-#include <gmock\gmock.h>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
 #include "TestEnities.h"
 #include "HelperClasses.h"
 #include "TestComponents.h"
@@ -45,6 +44,8 @@ protected:
 	void addThreeElementsToPool();
 	Entity& addElementToPool(EntityId p_entityId);
 
+	//outlives m_sut - attached pool removes its sampled gauges when destroyed
+	MetricsRegistry m_registry;
 	ContinuousPool<Entity> m_sut;
 	SpecialFuncCounter m_counters;
 };
@@ -582,3 +583,79 @@ TEST_F(PoolTestSuite, SafeIterCanBeCreatedFromIter)
 	EXPECT_NE(m_sut.begin(), l_safeIter.getIter());
 	EXPECT_EQ(l_iter, l_safeIter.getIter());
 }
+
+TEST_F(PoolTestSuite, PoolCanWorkOnExternalStorage)
+{
+	Entity l_storage[THREE_ELEMENTS] = { Entity(ENTITY_ID_1), Entity(ENTITY_ID_2) };
+	ContinuousPool<Entity> l_pool(l_storage, THREE_ELEMENTS, TWO_ELEMENTS);
+
+	EXPECT_TRUE(l_pool.hasExternalStorage());
+	EXPECT_EQ(TWO_ELEMENTS, l_pool.size());
+	EXPECT_EQ(THREE_ELEMENTS, l_pool.maxSize());
+	EXPECT_EQ(ENTITY_ID_2, (l_pool.begin() + 1u)->id);
+
+	l_pool.allocate(ENTITY_ID_3);
+	EXPECT_EQ(ENTITY_ID_3, l_storage[2].id);
+
+	l_pool.takeBack(*l_pool.begin());
+	EXPECT_EQ(ENTITY_ID_3, l_storage[0].id);
+}
+
+TEST_F(PoolTestSuite, PoolCanBeSwitchedToExternalStorage)
+{
+	addThreeElementsToPool();
+	auto l_safeIter = m_sut.makeSafeIter();
+	Entity l_storage[ONE_ELEMENT] = { Entity(ENTITY_ID_4) };
+
+	m_sut.useExternalStorage(l_storage, ONE_ELEMENT, ONE_ELEMENT);
+
+	EXPECT_FALSE(l_safeIter.isValid());
+	EXPECT_TRUE(m_sut.hasExternalStorage());
+	EXPECT_EQ(ONE_ELEMENT, m_sut.size());
+	EXPECT_EQ(l_storage, m_sut.data());
+	EXPECT_EQ(ENTITY_ID_4, m_sut.begin()->id);
+}
+
+TEST_F(PoolTestSuite, AttachedMetricsShouldSampleSizeAndCapacityWhenSnapshotIsTaken)
+{
+	m_sut.attachMetrics(m_registry, "pool");
+	addThreeElementsToPool();
+
+	metrics::MetricsSnapshot l_snapshot;
+	m_registry.takeSnapshot(l_snapshot);
+
+	ASSERT_NE(nullptr, l_snapshot.find("pool.size"));
+	EXPECT_EQ(THREE_ELEMENTS, l_snapshot.find("pool.size")->value);
+	EXPECT_EQ(POOL_SIZE, l_snapshot.find("pool.capacity")->value);
+}
+
+TEST_F(PoolTestSuite, DestroyedPoolShouldRemoveItsSampledMetrics)
+{
+	MetricsRegistry l_registry;
+	{
+		ContinuousPool<Entity> l_pool(POOL_SIZE);
+		l_pool.attachMetrics(l_registry, "destroyed");
+	}
+
+	metrics::MetricsSnapshot l_snapshot;
+	l_registry.takeSnapshot(l_snapshot);
+
+	EXPECT_EQ(nullptr, l_snapshot.find("destroyed.size"));
+}
+
+#if defined(ENGINE_METRICS)
+TEST_F(PoolTestSuite, AttachedMetricsShouldFollowSizeHighWaterAndTakeBacks)
+{
+	m_sut.attachMetrics(m_registry, "pool");
+
+	addThreeElementsToPool();
+	m_sut.takeBack(*m_sut.begin());
+
+	EXPECT_EQ(THREE_ELEMENTS, m_registry.getGauge("pool.highWater").get());
+	EXPECT_EQ(ONE_ELEMENT, m_registry.getCounter("pool.takeBacks").get());
+
+	m_sut.reset();
+
+	EXPECT_EQ(THREE_ELEMENTS, m_registry.getGauge("pool.highWater").get());
+}
+#endif
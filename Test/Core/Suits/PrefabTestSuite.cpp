@@ -0,0 +1,164 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <memory>
+#include <vector>
+#include "Core.h"
+#include "Prefab.h"
+#include "PositionComponent.h"
+#include "MovableComponent.h"
+#include "EntityPool.h"
+#include "IdGuard.h"
+#include "EntityController.h"
+#include "ComponentController.h"
+#include "EntityChangeDistributor.h"
+
+using namespace testing;
+using namespace engine;
+
+namespace
+{
+const f32 POSITION_X = 10.0f;
+const f32 POSITION_Y = -5.0f;
+const f32 VELOCITY_X = 300.0f;
+const f32 VELOCITY_Y = 0.5f;
+const u32 NR_OF_BULLETS = 10000u;
+
+//POSITION and MOVABLE components taken from component pools, so prefab batches land in consecutive memory
+class PooledComponentProvider : public IComponentProvider
+{
+public:
+	PooledComponentProvider(PoolSize p_size)
+		:m_positions(p_size),
+		 m_movables(p_size)
+	{
+	}
+
+	ComponentBase& createComponent(ComponentType p_type) override
+	{
+		ComponentBase* l_component = nullptr;
+		createComponents(p_type, 1u, &l_component);
+
+		return *l_component;
+	}
+
+	void createComponents(ComponentType p_type, u32 p_count, ComponentBase** p_components) override
+	{
+		getPool(p_type).getComponents(p_count, p_components);
+	}
+
+	bool removeComponent(ComponentBase& p_component) override
+	{
+		getPool(p_component.type).returnComponent(p_component);
+		return true;
+	}
+
+private:
+	IComponentPool& getPool(ComponentType p_type)
+	{
+		return p_type == ComponentType::POSITION ? static_cast<IComponentPool&>(m_positions) : m_movables;
+	}
+
+	ComponentPool<PositionComponent> m_positions;
+	ComponentPool<MovableComponent> m_movables;
+};
+}
+
+class PrefabTestSuite : public Test
+{
+public:
+	PrefabTestSuite()
+	{
+		m_position.x = POSITION_X;
+		m_position.y = POSITION_Y;
+
+		m_movable.velocityX = VELOCITY_X;
+		m_movable.velocityY = VELOCITY_Y;
+	}
+
+protected:
+	PositionComponent m_position;
+	MovableComponent m_movable;
+
+	Prefab m_sut;
+};
+
+TEST_F(PrefabTestSuite, addedComponentsShouldBeSetInMask)
+{
+	EXPECT_TRUE(m_sut.addComponent(ComponentType::VISIBLE));
+	EXPECT_TRUE(m_sut.addComponent(m_position));
+
+	EXPECT_TRUE(m_sut.getComponents().isSet(ComponentType::VISIBLE));
+	EXPECT_TRUE(m_sut.getComponents().isSet(ComponentType::POSITION));
+	EXPECT_EQ(2u, m_sut.getComponents().getNumOfSetComponents());
+}
+
+TEST_F(PrefabTestSuite, componentShouldNotBeAddedTwiceOrWithUndefinedType)
+{
+	EXPECT_TRUE(m_sut.addComponent(m_position));
+
+	EXPECT_FALSE(m_sut.addComponent(ComponentType::POSITION));
+	EXPECT_FALSE(m_sut.addComponent(m_position));
+	EXPECT_FALSE(m_sut.addComponent(ComponentType::UndefinedComponent));
+}
+
+TEST_F(PrefabTestSuite, onlyComponentsAddedWithValuesShouldHaveDefaults)
+{
+	m_sut.addComponent(ComponentType::VISIBLE);
+	m_sut.addComponent(m_movable);
+
+	EXPECT_FALSE(m_sut.hasDefaults(ComponentType::VISIBLE));
+	EXPECT_TRUE(m_sut.hasDefaults(ComponentType::MOVABLE));
+	EXPECT_FALSE(m_sut.hasDefaults(ComponentType::POSITION));
+}
+
+TEST_F(PrefabTestSuite, applyDefaultsShouldCopyDataWithoutTouchingLinks)
+{
+	m_sut.addComponent(m_position);
+	m_sut.addComponent(m_movable);
+
+	MovableComponent l_next;
+	PositionComponent l_component;
+	l_component.connectedEntity = 1u;
+	l_component.nextComponent = &l_next;
+
+	m_sut.applyDefaults(l_component);
+
+	EXPECT_EQ(POSITION_X, l_component.x);
+	EXPECT_EQ(POSITION_Y, l_component.y);
+	EXPECT_EQ(ComponentType::POSITION, l_component.type);
+	EXPECT_EQ(1u, l_component.connectedEntity);
+	EXPECT_EQ(&l_next, l_component.nextComponent);
+}
+
+TEST_F(PrefabTestSuite, bulletsShouldBeSpawnedInOneBatchWithDefaultValuesInConsecutiveComponents)
+{
+	EntityChangeDistributor l_changeDistributor;
+	EntityController l_controller(std::make_unique<EntityPool>(NR_OF_BULLETS, std::make_unique<IdGuard>(NR_OF_BULLETS)),
+								  std::make_unique<ComponentController>(std::make_unique<PooledComponentProvider>(NR_OF_BULLETS)),
+								  l_changeDistributor);
+	std::vector<EntityId> l_ids(NR_OF_BULLETS);
+
+	m_sut.addComponent(m_position);
+	m_sut.addComponent(m_movable);
+
+	l_controller.createEntitiesFromPrefab(m_sut, NR_OF_BULLETS, l_ids.data());
+
+	auto& l_first = l_controller.getEntity(l_ids.front());
+	auto& l_last = l_controller.getEntity(l_ids.back());
+	auto l_firstPosition = static_cast<PositionComponent*>(l_first.components);
+	auto l_lastPosition = static_cast<PositionComponent*>(l_last.components);
+	auto l_lastMovable = static_cast<MovableComponent*>(l_last.components->nextComponent);
+
+	EXPECT_EQ(m_sut.getComponents(), l_last.attachedComponents);
+	EXPECT_EQ(l_firstPosition + (NR_OF_BULLETS - 1u), l_lastPosition);
+	EXPECT_EQ(POSITION_X, l_lastPosition->x);
+	EXPECT_EQ(POSITION_Y, l_lastPosition->y);
+	EXPECT_EQ(ComponentType::MOVABLE, l_lastMovable->type);
+	EXPECT_EQ(VELOCITY_X, l_lastMovable->velocityX);
+	EXPECT_EQ(VELOCITY_Y, l_lastMovable->velocityY);
+	EXPECT_THAT(l_lastMovable->nextComponent, IsNull());
+
+	EXPECT_TRUE(l_controller.removeEntity(l_ids.back()));
+	EXPECT_EQ(l_ids.back(), l_controller.createEntityFromPrefab(m_sut));
+	EXPECT_EQ(l_lastPosition, l_controller.getEntity(l_ids.back()).components);
+}
@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <sstream>
+#include <thread>
+#include "Core.h"
+#include "Profiler.h"
+
+using namespace testing;
+using namespace engine;
+
+namespace
+{
+const char* const ZONE_NAME = "ProfilerTestSuite::zone";
+const char* const INNER_ZONE_NAME = "ProfilerTestSuite::innerZone";
+const char* const THREAD_NAME = "ProfilerTestSuite::thread";
+const u64 START = 1000u;
+const u64 END = 3500u;
+}
+
+class ProfilerTestSuite : public Test
+{
+public:
+	ProfilerTestSuite()
+	{
+		profiler::clear();
+	}
+
+	~ProfilerTestSuite()
+	{
+		profiler::clear();
+	}
+};
+
+TEST_F(ProfilerTestSuite, recordedZoneShouldKeepNameStartAndDuration)
+{
+	profiler::recordZone(ZONE_NAME, START, END);
+
+	auto l_zones = profiler::collectZones();
+
+	ASSERT_EQ(1u, l_zones.size());
+	EXPECT_STREQ(ZONE_NAME, l_zones[0].name);
+	EXPECT_EQ(START, l_zones[0].start);
+	EXPECT_EQ(END - START, l_zones[0].duration);
+}
+
+TEST_F(ProfilerTestSuite, nestedZoneShouldBeRecordedFirstAndLieInsideOuterZone)
+{
+	{
+		profiler::Zone l_outer(ZONE_NAME);
+		profiler::Zone l_inner(INNER_ZONE_NAME);
+	}
+
+	auto l_zones = profiler::collectZones();
+
+	ASSERT_EQ(2u, l_zones.size());
+	EXPECT_STREQ(INNER_ZONE_NAME, l_zones[0].name);
+	EXPECT_STREQ(ZONE_NAME, l_zones[1].name);
+	EXPECT_LE(l_zones[1].start, l_zones[0].start);
+	EXPECT_GE(l_zones[1].start + l_zones[1].duration, l_zones[0].start + l_zones[0].duration);
+}
+
+TEST_F(ProfilerTestSuite, zonesOfDifferentThreadsShouldHaveDifferentThreadIds)
+{
+	profiler::recordZone(ZONE_NAME, START, END);
+
+	std::thread l_thread([]() { profiler::recordZone(INNER_ZONE_NAME, START, END); });
+	l_thread.join();
+
+	auto l_zones = profiler::collectZones();
+
+	ASSERT_EQ(2u, l_zones.size());
+	EXPECT_NE(l_zones[0].threadId, l_zones[1].threadId);
+}
+
+TEST_F(ProfilerTestSuite, buffersOfFinishedThreadsShouldBeReusedWhenRegistryIsFull)
+{
+	const u64 l_nrOfThreads = 2u * profiler::MAX_NR_OF_THREAD_BUFFERS;
+
+	for (u64 i = 0u; i < l_nrOfThreads; i++)
+	{
+		std::thread l_thread([i]() { profiler::recordZone(ZONE_NAME, i, i + 1u); });
+		l_thread.join();
+	}
+
+	auto l_zones = profiler::collectZones();
+
+	EXPECT_LE(l_zones.size(), profiler::MAX_NR_OF_THREAD_BUFFERS);
+	EXPECT_THAT(l_zones, Contains(Field(&profiler::RecordedZone::start, l_nrOfThreads - 1u)));
+}
+
+TEST_F(ProfilerTestSuite, fullRingShouldKeepOnlyNewestZones)
+{
+	const u64 l_nrOfZones = profiler::EVENTS_PER_THREAD + 10u;
+
+	for (u64 i = 0u; i < l_nrOfZones; i++)
+	{
+		profiler::recordZone(ZONE_NAME, i, i + 1u);
+	}
+
+	auto l_zones = profiler::collectZones();
+
+	ASSERT_EQ(profiler::EVENTS_PER_THREAD, l_zones.size());
+	EXPECT_EQ(10u, l_zones.front().start);
+	EXPECT_EQ(l_nrOfZones - 1u, l_zones.back().start);
+}
+
+TEST_F(ProfilerTestSuite, clearShouldDropRecordedZones)
+{
+	profiler::recordZone(ZONE_NAME, START, END);
+	profiler::clear();
+
+	EXPECT_TRUE(profiler::collectZones().empty());
+}
+
+TEST_F(ProfilerTestSuite, exportChromeTraceShouldWriteCompleteEventsInMicroseconds)
+{
+	profiler::setThreadName(THREAD_NAME);
+	profiler::recordZone(ZONE_NAME, START, END);
+	profiler::recordZone(INNER_ZONE_NAME, END, END + END);
+
+	std::stringstream l_output;
+
+	ASSERT_TRUE(profiler::exportChromeTrace(l_output));
+
+	const auto l_trace = l_output.str();
+	EXPECT_THAT(l_trace, StartsWith("{\"traceEvents\":["));
+	EXPECT_THAT(l_trace, HasSubstr("{\"name\":\"ProfilerTestSuite::zone\",\"ph\":\"X\",\"ts\":0.000,\"dur\":2.500,"));
+	EXPECT_THAT(l_trace, HasSubstr("{\"name\":\"ProfilerTestSuite::innerZone\",\"ph\":\"X\",\"ts\":2.500,\"dur\":3.500,"));
+	EXPECT_THAT(l_trace, HasSubstr("\"ph\":\"M\""));
+	EXPECT_THAT(l_trace, HasSubstr(THREAD_NAME));
+}
+
+TEST_F(ProfilerTestSuite, profileZoneMacroShouldRecordOnlyWhenProfilingIsEnabled)
+{
+	{
+		ENGINE_PROFILE_ZONE(ZONE_NAME);
+	}
+
+#if defined(ENGINE_PROFILING)
+	EXPECT_EQ(1u, profiler::collectZones().size());
+#else
+	EXPECT_TRUE(profiler::collectZones().empty());
+#endif
+}
@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "Core.h"
+#include "RelationStore.h"
+#include "TrackingMemoryResource.h"
+
+using namespace testing;
+using namespace engine;
+
+namespace
+{
+const PoolSize CAPACITY = 8u;
+
+const u32 EMPTY = 0u;
+
+const EntityId TANK = 1u;
+const EntityId SOLDIER_1 = 2u;
+const EntityId SOLDIER_2 = 3u;
+const EntityId SOLDIER_3 = 4u;
+const EntityId SQUAD = 5u;
+const EntityId OUT_OF_RANGE_ID = CAPACITY + 1u;
+
+const PoolSize BIG_CAPACITY = 1000000u;
+//per relation type bookkeeping only - nothing sized by capacity
+const std::size_t MAX_EMPTY_STORE_BYTES = 4096u;
+}
+
+class RelationStoreTestSuite : public Test
+{
+public:
+	RelationStoreTestSuite()
+		:m_sut(CAPACITY)
+	{
+	}
+
+protected:
+	void addSquad()
+	{
+		m_sut.add(SOLDIER_1, RelationType::MEMBER_OF, SQUAD);
+		m_sut.add(SOLDIER_2, RelationType::MEMBER_OF, SQUAD);
+		m_sut.add(SOLDIER_3, RelationType::MEMBER_OF, SQUAD);
+	}
+
+	RelationStore m_sut;
+};
+
+TEST_F(RelationStoreTestSuite, addedRelationShouldBeVisibleFromBothSides)
+{
+	EXPECT_TRUE(m_sut.add(SOLDIER_1, RelationType::TARGETS, TANK));
+
+	EXPECT_TRUE(m_sut.has(SOLDIER_1, RelationType::TARGETS, TANK));
+	EXPECT_FALSE(m_sut.has(TANK, RelationType::TARGETS, SOLDIER_1));
+	EXPECT_FALSE(m_sut.has(SOLDIER_1, RelationType::OWNED_BY, TANK));
+	EXPECT_THAT(m_sut.getTargets(SOLDIER_1, RelationType::TARGETS), ElementsAre(TANK));
+	EXPECT_THAT(m_sut.getSources(RelationType::TARGETS, TANK), ElementsAre(SOLDIER_1));
+	EXPECT_EQ(1u, m_sut.size());
+}
+
+TEST_F(RelationStoreTestSuite, addShouldFailForDuplicatedSelfOrInvalidRelations)
+{
+	ASSERT_TRUE(m_sut.add(SOLDIER_1, RelationType::TARGETS, TANK));
+
+	EXPECT_FALSE(m_sut.add(SOLDIER_1, RelationType::TARGETS, TANK));
+	EXPECT_FALSE(m_sut.add(TANK, RelationType::TARGETS, TANK));
+	EXPECT_FALSE(m_sut.add(UNDEFINED_ENTITY_ID, RelationType::TARGETS, TANK));
+	EXPECT_FALSE(m_sut.add(SOLDIER_1, RelationType::TARGETS, OUT_OF_RANGE_ID));
+	EXPECT_EQ(1u, m_sut.size());
+}
+
+TEST_F(RelationStoreTestSuite, queryShouldReturnAllSourcesOfRelationWithTarget)
+{
+	addSquad();
+	m_sut.add(SOLDIER_1, RelationType::TARGETS, TANK);
+	m_sut.add(SOLDIER_3, RelationType::TARGETS, TANK);
+
+	EXPECT_THAT(m_sut.getSources(RelationType::MEMBER_OF, SQUAD), UnorderedElementsAre(SOLDIER_1, SOLDIER_2, SOLDIER_3));
+	EXPECT_THAT(m_sut.getSources(RelationType::TARGETS, TANK), UnorderedElementsAre(SOLDIER_1, SOLDIER_3));
+	EXPECT_THAT(m_sut.getSources(RelationType::TARGETS, SQUAD), IsEmpty());
+	EXPECT_THAT(m_sut.getSources(RelationType::TARGETS, OUT_OF_RANGE_ID), IsEmpty());
+}
+
+TEST_F(RelationStoreTestSuite, removedRelationShouldDisappearFromBothSidesWithoutBreakingOthers)
+{
+	addSquad();
+
+	EXPECT_TRUE(m_sut.remove(SOLDIER_1, RelationType::MEMBER_OF, SQUAD));
+	EXPECT_FALSE(m_sut.remove(SOLDIER_1, RelationType::MEMBER_OF, SQUAD));
+
+	EXPECT_THAT(m_sut.getTargets(SOLDIER_1, RelationType::MEMBER_OF), IsEmpty());
+	EXPECT_THAT(m_sut.getSources(RelationType::MEMBER_OF, SQUAD), UnorderedElementsAre(SOLDIER_2, SOLDIER_3));
+
+	//slots of moved entries have to be updated for later removals
+	EXPECT_TRUE(m_sut.remove(SOLDIER_3, RelationType::MEMBER_OF, SQUAD));
+	EXPECT_THAT(m_sut.getSources(RelationType::MEMBER_OF, SQUAD), ElementsAre(SOLDIER_2));
+	EXPECT_TRUE(m_sut.has(SOLDIER_2, RelationType::MEMBER_OF, SQUAD));
+	EXPECT_EQ(1u, m_sut.size());
+}
+
+TEST_F(RelationStoreTestSuite, removeEntityShouldDropRelationsInBothDirections)
+{
+	addSquad();
+	m_sut.add(SOLDIER_1, RelationType::TARGETS, TANK);
+	m_sut.add(SOLDIER_2, RelationType::TARGETS, TANK);
+	m_sut.add(TANK, RelationType::OWNED_BY, SOLDIER_2);
+	m_sut.add(TANK, RelationType::TARGETS, SOLDIER_3);
+
+	m_sut.removeEntity(SOLDIER_2);
+
+	EXPECT_THAT(m_sut.getSources(RelationType::MEMBER_OF, SQUAD), UnorderedElementsAre(SOLDIER_1, SOLDIER_3));
+	EXPECT_THAT(m_sut.getSources(RelationType::TARGETS, TANK), ElementsAre(SOLDIER_1));
+	EXPECT_THAT(m_sut.getTargets(TANK, RelationType::OWNED_BY), IsEmpty());
+	EXPECT_THAT(m_sut.getTargets(TANK, RelationType::TARGETS), ElementsAre(SOLDIER_3));
+	EXPECT_THAT(m_sut.getTargets(SOLDIER_2, RelationType::TARGETS), IsEmpty());
+	EXPECT_EQ(4u, m_sut.size());
+
+	m_sut.removeEntity(SQUAD);
+	m_sut.removeEntity(TANK);
+
+	EXPECT_EQ(EMPTY, m_sut.size());
+	EXPECT_THAT(m_sut.getTargets(SOLDIER_1, RelationType::MEMBER_OF), IsEmpty());
+	EXPECT_THAT(m_sut.getSources(RelationType::TARGETS, SOLDIER_3), IsEmpty());
+}
+
+TEST_F(RelationStoreTestSuite, listsShouldBeAllocatedOnlyForRelatedEntities)
+{
+	TrackingMemoryResource l_memory;
+	RelationStore l_sut(BIG_CAPACITY, l_memory);
+
+	EXPECT_LT(l_memory.getStats().currentBytes, MAX_EMPTY_STORE_BYTES);
+	EXPECT_THAT(l_sut.getTargets(BIG_CAPACITY, RelationType::TARGETS), IsEmpty());
+
+	ASSERT_TRUE(l_sut.add(BIG_CAPACITY, RelationType::TARGETS, TANK));
+	EXPECT_TRUE(l_sut.has(BIG_CAPACITY, RelationType::TARGETS, TANK));
+	EXPECT_LT(l_memory.getStats().peakBytes, MAX_EMPTY_STORE_BYTES);
+
+	l_sut.removeEntity(BIG_CAPACITY);
+	EXPECT_THAT(l_sut.getSources(RelationType::TARGETS, TANK), IsEmpty());
+	EXPECT_EQ(EMPTY, l_sut.size());
+}
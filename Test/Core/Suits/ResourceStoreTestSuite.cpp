@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <random>
+#include "Core.h"
+#include "ResourceStore.h"
+
+using namespace testing;
+using namespace engine;
+
+namespace
+{
+const f32 ELAPSED_TIME = 12.5f;
+const f32 GRAVITY = -9.81f;
+const u32 SEED = 7u;
+
+struct GameTime
+{
+	GameTime(f32 p_elapsed)
+		:elapsed(p_elapsed)
+	{
+	}
+
+	f32 elapsed;
+};
+
+struct PhysicsSettings
+{
+	f32 gravity = GRAVITY;
+};
+
+struct Counted
+{
+	Counted(u32& p_nrOfDestroyed)
+		:nrOfDestroyed(p_nrOfDestroyed)
+	{
+	}
+
+	~Counted()
+	{
+		++nrOfDestroyed;
+	}
+
+	u32& nrOfDestroyed;
+};
+}
+
+class ResourceStoreTestSuite : public Test
+{
+public:
+	ResourceStoreTestSuite() = default;
+
+protected:
+	ResourceStore m_sut;
+};
+
+TEST_F(ResourceStoreTestSuite, emplacedResourceShouldBeAccessibleByType)
+{
+	EXPECT_FALSE(m_sut.has<GameTime>());
+	EXPECT_THAT(m_sut.tryGet<GameTime>(), IsNull());
+
+	auto& l_time = m_sut.emplace<GameTime>(ELAPSED_TIME);
+	m_sut.emplace<PhysicsSettings>();
+	m_sut.emplace<std::mt19937>(SEED);
+
+	EXPECT_TRUE(m_sut.has<GameTime>());
+	EXPECT_EQ(&l_time, &m_sut.get<GameTime>());
+	EXPECT_EQ(ELAPSED_TIME, m_sut.get<GameTime>().elapsed);
+	EXPECT_EQ(GRAVITY, m_sut.get<PhysicsSettings>().gravity);
+	EXPECT_EQ(std::mt19937(SEED)(), m_sut.get<std::mt19937>()());
+	EXPECT_EQ(3u, m_sut.size());
+}
+
+TEST_F(ResourceStoreTestSuite, emplaceShouldReplaceResourceOfTheSameType)
+{
+	u32 l_nrOfDestroyed = 0u;
+	m_sut.emplace<Counted>(l_nrOfDestroyed);
+	m_sut.emplace<Counted>(l_nrOfDestroyed);
+
+	EXPECT_EQ(1u, l_nrOfDestroyed);
+	EXPECT_EQ(1u, m_sut.size());
+
+	EXPECT_TRUE(m_sut.remove<Counted>());
+	EXPECT_FALSE(m_sut.remove<Counted>());
+	EXPECT_EQ(2u, l_nrOfDestroyed);
+	EXPECT_EQ(0u, m_sut.size());
+}
+
+TEST_F(ResourceStoreTestSuite, storesShouldNotShareResources)
+{
+	ResourceStore l_otherStore;
+	m_sut.emplace<GameTime>(ELAPSED_TIME);
+	l_otherStore.emplace<GameTime>(0.0f);
+
+	EXPECT_EQ(ELAPSED_TIME, m_sut.get<GameTime>().elapsed);
+	EXPECT_EQ(0.0f, l_otherStore.get<GameTime>().elapsed);
+}
+
+TEST_F(ResourceStoreTestSuite, accessShouldConflictOnlyIfOneSideWritesResourceUsedByOther)
+{
+	const auto l_readTime = ResourceAccess().read<GameTime>();
+	const auto l_writeTime = ResourceAccess().write<GameTime>();
+	const auto l_readTimeWriteSettings = ResourceAccess().read<GameTime>().write<PhysicsSettings>();
+
+	EXPECT_FALSE(l_readTime.conflictsWith(l_readTime));
+	EXPECT_FALSE(l_readTime.conflictsWith(l_readTimeWriteSettings));
+	EXPECT_TRUE(l_readTime.conflictsWith(l_writeTime));
+	EXPECT_TRUE(l_writeTime.conflictsWith(l_readTime));
+	EXPECT_TRUE(l_writeTime.conflictsWith(l_writeTime));
+	EXPECT_TRUE(l_readTimeWriteSettings.conflictsWith(l_readTimeWriteSettings));
+
+	EXPECT_TRUE(l_writeTime.reads<GameTime>());
+	EXPECT_FALSE(l_readTime.writes<GameTime>());
+}
+
+TEST_F(ResourceStoreTestSuite, exclusiveAccessShouldConflictWithEveryAccess)
+{
+	const auto l_exclusive = ResourceAccess::exclusive();
+
+	EXPECT_TRUE(l_exclusive.isExclusive());
+	EXPECT_FALSE(ResourceAccess().isExclusive());
+	EXPECT_TRUE(l_exclusive.conflictsWith(ResourceAccess()));
+	EXPECT_TRUE(ResourceAccess().read<GameTime>().conflictsWith(l_exclusive));
+	EXPECT_TRUE(l_exclusive.conflictsWith(l_exclusive));
+	EXPECT_FALSE(ResourceAccess().conflictsWith(ResourceAccess()));
+}
@@ -0,0 +1,229 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "Core.h"
+#include "AllocationHook.h"
+#include "PreallocatedComponentProvider.h"
+#include "MemoryMgmt.hpp"
+#include "IdGuard.h"
+#include "EntityController.h"
+#include "ComponentController.h"
+#include "EntityChangeDistributor.h"
+
+using namespace testing;
+using namespace testTool;
+using namespace engine;
+
+/*
+	Steady state frame has to run without heap allocations - containers may grow during warm-up
+	frames only. Every test runs the same frame several times and checks allocations of the last ones.
+*/
+
+namespace
+{
+const u32 NR_OF_ENTITIES = 1000u;
+const u32 NR_OF_WARM_UP_FRAMES = 2u;
+const u32 NR_OF_MEASURED_FRAMES = 5u;
+const ComponentType COMPONENT_TYPE = ComponentType::POSITION;
+const ComponentType SECOND_COMPONENT_TYPE = ComponentType::MOVABLE;
+}
+
+class SteadyStateAllocationTestSuite : public Test
+{
+public:
+	SteadyStateAllocationTestSuite()
+		:m_sut(std::make_unique<EntityPool>(NR_OF_ENTITIES, std::make_unique<IdGuard>(NR_OF_ENTITIES)),
+			   std::make_unique<ComponentController>(std::make_unique<PreallocatedComponentProvider>(NR_OF_ENTITIES)),
+			   m_changeDistributor)
+	{
+		m_ids.reserve(NR_OF_ENTITIES);
+	}
+
+protected:
+	template<typename Frame>
+	u64 countAllocationsOfSteadyState(Frame p_frame)
+	{
+		for (auto i = 0u; i < NR_OF_WARM_UP_FRAMES; i++)
+		{
+			p_frame();
+		}
+
+		AllocationScope l_allocations;
+
+		for (auto i = 0u; i < NR_OF_MEASURED_FRAMES; i++)
+		{
+			p_frame();
+		}
+
+		return l_allocations.getNumOfAllocations();
+	}
+
+	void createEntities()
+	{
+		for (auto i = 0u; i < NR_OF_ENTITIES; i++)
+		{
+			m_ids.push_back(m_sut.createEntity());
+		}
+	}
+
+	void removeEntities()
+	{
+		for (auto l_id : m_ids)
+		{
+			m_sut.removeEntity(l_id);
+		}
+
+		m_ids.clear();
+	}
+
+	EntityChangeDistributor m_changeDistributor;
+	EntityController m_sut;
+	std::vector<EntityId> m_ids;
+};
+
+TEST_F(SteadyStateAllocationTestSuite, allocationScopeShouldCountAllocationsOfItsThreadOnly)
+{
+	std::atomic<bool> l_start = false;
+	std::thread l_thread([&l_start]()
+	{
+		while (not l_start)
+		{
+			std::this_thread::yield();
+		}
+
+		std::make_unique<u64>(0u);
+	});
+
+	AllocationScope l_allocations;
+
+	l_start = true;
+	l_thread.join();
+	EXPECT_EQ(0u, l_allocations.getNumOfAllocations());
+
+	auto l_value = std::make_unique<u64>(0u);
+	EXPECT_EQ(1u, l_allocations.getNumOfAllocations());
+	EXPECT_EQ(sizeof(u64), l_allocations.getAllocatedBytes());
+
+	l_value.reset();
+	EXPECT_EQ(1u, l_allocations.getNumOfDeallocations());
+}
+
+TEST_F(SteadyStateAllocationTestSuite, idGuardShouldNotAllocateWhenFreedIdsAreReused)
+{
+	IdGuard l_idGuard(NR_OF_ENTITIES);
+	std::vector<Id> l_ids(NR_OF_ENTITIES);
+
+	auto l_allocations = countAllocationsOfSteadyState([&l_idGuard, &l_ids]()
+	{
+		for (auto& l_id : l_ids)
+		{
+			l_id = l_idGuard.getNextId();
+		}
+
+		for (auto l_id : l_ids)
+		{
+			l_idGuard.freeId(l_id);
+		}
+	});
+
+	EXPECT_EQ(0u, l_allocations);
+}
+
+TEST_F(SteadyStateAllocationTestSuite, createAndRemoveEntitiesShouldNotAllocateAfterWarmUp)
+{
+	auto l_allocations = countAllocationsOfSteadyState([this]()
+	{
+		createEntities();
+		removeEntities();
+	});
+
+	EXPECT_EQ(0u, l_allocations);
+}
+
+TEST_F(SteadyStateAllocationTestSuite, attachAndDetachComponentsShouldNotAllocateAfterWarmUp)
+{
+	createEntities();
+
+	auto l_allocations = countAllocationsOfSteadyState([this]()
+	{
+		for (auto l_id : m_ids)
+		{
+			m_sut.connectComponentToEntity(l_id, COMPONENT_TYPE);
+			m_sut.connectComponentToEntity(l_id, SECOND_COMPONENT_TYPE);
+		}
+
+		for (auto l_id : m_ids)
+		{
+			m_sut.disconnectComponentFromEntity(l_id, COMPONENT_TYPE);
+			m_sut.disconnectComponentFromEntity(l_id, SECOND_COMPONENT_TYPE);
+		}
+	});
+
+	EXPECT_EQ(0u, l_allocations);
+}
+
+TEST_F(SteadyStateAllocationTestSuite, removingEntitiesWithComponentsShouldNotAllocateAfterWarmUp)
+{
+	auto l_allocations = countAllocationsOfSteadyState([this]()
+	{
+		createEntities();
+
+		for (auto l_id : m_ids)
+		{
+			m_sut.connectComponentToEntity(l_id, COMPONENT_TYPE);
+		}
+
+		removeEntities();
+	});
+
+	EXPECT_EQ(0u, l_allocations);
+}
+
+TEST_F(SteadyStateAllocationTestSuite, prefabInstantiationShouldNotAllocateAfterWarmUp)
+{
+	Prefab l_prefab;
+	l_prefab.addComponent(COMPONENT_TYPE);
+	l_prefab.addComponent(SECOND_COMPONENT_TYPE);
+
+	auto l_allocations = countAllocationsOfSteadyState([this, &l_prefab]()
+	{
+		m_ids.resize(NR_OF_ENTITIES);
+		m_sut.createEntitiesFromPrefab(l_prefab, NR_OF_ENTITIES, m_ids.data());
+
+		removeEntities();
+	});
+
+	EXPECT_EQ(0u, l_allocations);
+}
+
+TEST_F(SteadyStateAllocationTestSuite, poolIterationShouldNotAllocateAfterWarmUp)
+{
+	ContinuousPool<Entity> l_pool(NR_OF_ENTITIES);
+	u64 l_sum = 0u;
+
+	for (auto i = 0u; i < NR_OF_ENTITIES; i++)
+	{
+		l_pool.allocate().id = i;
+	}
+
+	auto l_allocations = countAllocationsOfSteadyState([&l_pool, &l_sum]()
+	{
+		for (const auto& l_entity : l_pool)
+		{
+			l_sum += l_entity.id;
+		}
+
+		auto l_safeIter = l_pool.makeSafeIter();
+		for (auto& l_iter = l_safeIter.getIter(); l_iter != l_pool.end(); l_iter++)
+		{
+			l_sum += l_iter->id;
+		}
+	});
+
+	EXPECT_EQ(0u, l_allocations);
+	EXPECT_NE(0u, l_sum);
+}
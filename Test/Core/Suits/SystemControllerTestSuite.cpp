@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "Core.h"
+#include "SystemController.h"
+#include "SystemMock.h"
+
+using namespace testing;
+using namespace engine;
+
+namespace
+{
+const f32 DELTA_TIME = 0.5f;
+const s32 LOW_PRIORITY = -1;
+const s32 HIGH_PRIORITY = 1;
+
+struct GameTime
+{
+	f32 elapsed = 0.0f;
+};
+
+struct PhysicsSettings
+{
+	f32 gravity = 0.0f;
+};
+
+class UndeclaredAccessSystem : public ISystem
+{
+public:
+	void update(f32) override {}
+};
+}
+
+class SystemControllerTestSuite : public Test
+{
+public:
+	SystemControllerTestSuite() = default;
+
+protected:
+	StrictMock<SystemMock> m_firstSystem;
+	StrictMock<SystemMock> m_secondSystem;
+	StrictMock<SystemMock> m_thirdSystem;
+	SystemController m_sut;
+};
+
+TEST_F(SystemControllerTestSuite, updateShouldCallSystemsInRegistrationOrder)
+{
+	m_sut.addSystem(m_firstSystem);
+	m_sut.addSystem(m_secondSystem);
+
+	InSequence l_sequence;
+	EXPECT_CALL(m_firstSystem, update(DELTA_TIME));
+	EXPECT_CALL(m_secondSystem, update(DELTA_TIME));
+
+	m_sut.update(DELTA_TIME);
+}
+
+TEST_F(SystemControllerTestSuite, updateShouldCallSystemsWithLowerPriorityFirst)
+{
+	m_sut.addSystem(m_firstSystem, HIGH_PRIORITY);
+	m_sut.addSystem(m_secondSystem);
+	m_sut.addSystem(m_thirdSystem, LOW_PRIORITY);
+
+	InSequence l_sequence;
+	EXPECT_CALL(m_thirdSystem, update(DELTA_TIME));
+	EXPECT_CALL(m_secondSystem, update(DELTA_TIME));
+	EXPECT_CALL(m_firstSystem, update(DELTA_TIME));
+
+	m_sut.update(DELTA_TIME);
+}
+
+TEST_F(SystemControllerTestSuite, systemsWithEqualPriorityShouldKeepRegistrationOrder)
+{
+	m_sut.addSystem(m_firstSystem, HIGH_PRIORITY);
+	m_sut.addSystem(m_secondSystem, LOW_PRIORITY);
+	m_sut.addSystem(m_thirdSystem, HIGH_PRIORITY);
+
+	InSequence l_sequence;
+	EXPECT_CALL(m_secondSystem, update(DELTA_TIME));
+	EXPECT_CALL(m_firstSystem, update(DELTA_TIME));
+	EXPECT_CALL(m_thirdSystem, update(DELTA_TIME));
+
+	m_sut.update(DELTA_TIME);
+}
+
+TEST_F(SystemControllerTestSuite, removedSystemShouldNotBeUpdated)
+{
+	m_sut.addSystem(m_firstSystem);
+	m_sut.addSystem(m_secondSystem);
+
+	EXPECT_TRUE(m_sut.removeSystem(m_firstSystem));
+	EXPECT_FALSE(m_sut.removeSystem(m_firstSystem));
+	EXPECT_EQ(1u, m_sut.getNumOfSystems());
+
+	EXPECT_CALL(m_secondSystem, update(DELTA_TIME));
+	m_sut.update(DELTA_TIME);
+}
+
+TEST_F(SystemControllerTestSuite, systemsWithConflictingResourceAccessShouldBeInSeparateBatchesInUpdateOrder)
+{
+	StrictMock<SystemMock> l_fourthSystem;
+	m_sut.addSystem(m_firstSystem);
+	m_sut.addSystem(m_secondSystem);
+	m_sut.addSystem(m_thirdSystem);
+	m_sut.addSystem(l_fourthSystem);
+
+	EXPECT_CALL(m_firstSystem, getResourceAccess()).WillOnce(Return(ResourceAccess().read<GameTime>()));
+	EXPECT_CALL(m_secondSystem, getResourceAccess()).WillOnce(Return(ResourceAccess().read<GameTime>().read<PhysicsSettings>()));
+	EXPECT_CALL(m_thirdSystem, getResourceAccess()).WillOnce(Return(ResourceAccess().write<PhysicsSettings>()));
+	EXPECT_CALL(l_fourthSystem, getResourceAccess()).WillOnce(Return(ResourceAccess().write<GameTime>().read<PhysicsSettings>()));
+
+	auto l_batches = m_sut.getParallelBatches();
+
+	ASSERT_EQ(3u, l_batches.size());
+	EXPECT_THAT(l_batches[0], ElementsAre(&m_firstSystem, &m_secondSystem));
+	EXPECT_THAT(l_batches[1], ElementsAre(&m_thirdSystem));
+	EXPECT_THAT(l_batches[2], ElementsAre(&l_fourthSystem));
+}
+
+TEST_F(SystemControllerTestSuite, systemWithoutDeclaredResourceAccessShouldRunInItsOwnBatch)
+{
+	UndeclaredAccessSystem l_undeclaredSystem;
+	m_sut.addSystem(m_firstSystem);
+	m_sut.addSystem(l_undeclaredSystem);
+	m_sut.addSystem(m_secondSystem);
+
+	EXPECT_CALL(m_firstSystem, getResourceAccess()).WillOnce(Return(ResourceAccess()));
+	EXPECT_CALL(m_secondSystem, getResourceAccess()).WillOnce(Return(ResourceAccess()));
+
+	auto l_batches = m_sut.getParallelBatches();
+
+	ASSERT_EQ(3u, l_batches.size());
+	EXPECT_THAT(l_batches[0], ElementsAre(&m_firstSystem));
+	EXPECT_THAT(l_batches[1], ElementsAre(&l_undeclaredSystem));
+	EXPECT_THAT(l_batches[2], ElementsAre(&m_secondSystem));
+}
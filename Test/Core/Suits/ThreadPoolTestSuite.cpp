@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "Core.h"
+#include "ThreadPool.h"
+
+using namespace testing;
+using namespace engine;
+
+namespace
+{
+const u32 NR_OF_WORKERS = 3u;
+const u32 NR_OF_RUNS = 1000u;
+}
+
+class ThreadPoolTestSuite : public Test
+{
+public:
+	ThreadPoolTestSuite()
+		:m_sut(NR_OF_WORKERS)
+	{
+	}
+
+protected:
+	ThreadPool m_sut;
+};
+
+TEST_F(ThreadPoolTestSuite, callingThreadShouldBeCountedAsOneOfThreads)
+{
+	EXPECT_EQ(NR_OF_WORKERS + 1u, m_sut.getNrOfThreads());
+}
+
+TEST_F(ThreadPoolTestSuite, everyTaskShouldRunOnceBeforeRunReturns)
+{
+	std::vector<std::atomic<u32>> l_calls(m_sut.getNrOfThreads());
+
+	m_sut.run(m_sut.getNrOfThreads(), [&l_calls](u32 p_taskIndex) { l_calls[p_taskIndex]++; });
+
+	for (const auto& l_call : l_calls)
+	{
+		EXPECT_EQ(1u, l_call.load());
+	}
+}
+
+TEST_F(ThreadPoolTestSuite, firstTaskShouldRunOnCallingThread)
+{
+	std::thread::id l_firstTaskThread;
+
+	m_sut.run(2u, [&l_firstTaskThread](u32 p_taskIndex)
+	{
+		if (p_taskIndex == 0u)
+			l_firstTaskThread = std::this_thread::get_id();
+	});
+
+	EXPECT_EQ(std::this_thread::get_id(), l_firstTaskThread);
+}
+
+TEST_F(ThreadPoolTestSuite, tasksOfOneRunShouldRunAtTheSameTime)
+{
+	std::atomic<u32> l_arrived{0u};
+	const auto l_nrOfTasks = m_sut.getNrOfThreads();
+
+	//every task waits for all others - would never return if tasks were run one after another
+	m_sut.run(l_nrOfTasks, [&l_arrived, l_nrOfTasks](u32)
+	{
+		l_arrived++;
+
+		while (l_arrived.load() < l_nrOfTasks)
+		{
+			std::this_thread::yield();
+		}
+	});
+
+	EXPECT_EQ(l_nrOfTasks, l_arrived.load());
+}
+
+TEST_F(ThreadPoolTestSuite, workersShouldBeReusedByManyRunsOfDifferentSize)
+{
+	std::atomic<u32> l_calls{0u};
+	u32 l_expectedCalls = 0u;
+
+	for (auto i = 0u; i < NR_OF_RUNS; i++)
+	{
+		const auto l_nrOfTasks = 1u + i % m_sut.getNrOfThreads();
+		l_expectedCalls += l_nrOfTasks;
+
+		m_sut.run(l_nrOfTasks, [&l_calls](u32) { l_calls++; });
+	}
+
+	EXPECT_EQ(l_expectedCalls, l_calls.load());
+}
+
+TEST_F(ThreadPoolTestSuite, poolWithoutWorkersShouldRunTaskOnCallingThread)
+{
+	ThreadPool l_pool(0u);
+	u32 l_calls = 0u;
+
+	l_pool.run(l_pool.getNrOfThreads(), [&l_calls](u32) { l_calls++; });
+
+	EXPECT_EQ(1u, l_pool.getNrOfThreads());
+	EXPECT_EQ(1u, l_calls);
+}
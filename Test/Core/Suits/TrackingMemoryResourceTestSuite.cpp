@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <memory_resource>
+#include <vector>
+#include "Core.h"
+#include "TrackingMemoryResource.h"
+#include "ComponentPool.h"
+#include "EntityPool.h"
+#include "IdGuard.h"
+#include "TestComponents.h"
+
+using namespace testing;
+using namespace engine;
+
+namespace
+{
+const PoolSize POOL_SIZE = 16u;
+const std::size_t SMALL_BLOCK = 64u;
+const std::size_t BIG_BLOCK = 256u;
+const std::size_t ALIGNMENT = 16u;
+const std::size_t ARENA_SIZE = 64u * 1024u;
+}
+
+class TrackingMemoryResourceTestSuite : public Test
+{
+protected:
+	TrackingMemoryResource m_sut;
+};
+
+TEST_F(TrackingMemoryResourceTestSuite, CurrentAndPeakUsageAreTracked)
+{
+	auto l_small = m_sut.allocate(SMALL_BLOCK, ALIGNMENT);
+	auto l_big = m_sut.allocate(BIG_BLOCK, ALIGNMENT);
+	m_sut.deallocate(l_big, BIG_BLOCK, ALIGNMENT);
+
+	auto l_stats = m_sut.getStats();
+	EXPECT_EQ(SMALL_BLOCK, l_stats.currentBytes);
+	EXPECT_EQ(SMALL_BLOCK + BIG_BLOCK, l_stats.peakBytes);
+	EXPECT_EQ(SMALL_BLOCK + BIG_BLOCK, l_stats.totalAllocatedBytes);
+	EXPECT_EQ(2u, l_stats.nrOfAllocations);
+	EXPECT_EQ(1u, l_stats.nrOfDeallocations);
+
+	m_sut.deallocate(l_small, SMALL_BLOCK, ALIGNMENT);
+	EXPECT_EQ(0u, m_sut.getStats().currentBytes);
+}
+
+TEST_F(TrackingMemoryResourceTestSuite, ContinuousPoolTakesStorageFromGivenResource)
+{
+	{
+		ContinuousPool<Entity> l_pool(POOL_SIZE, m_sut);
+
+		EXPECT_EQ(&m_sut, &l_pool.getMemoryResource());
+		EXPECT_GE(m_sut.getStats().currentBytes, POOL_SIZE * sizeof(Entity));
+	}
+
+	EXPECT_EQ(0u, m_sut.getStats().currentBytes);
+}
+
+TEST_F(TrackingMemoryResourceTestSuite, SafeIteratorsOfContinuousPoolAreRegisteredInGivenResource)
+{
+	ContinuousPool<Entity> l_pool(POOL_SIZE, m_sut);
+	const auto l_allocationsOfStorage = m_sut.getStats().nrOfAllocations;
+
+	auto l_safeIter = l_pool.makeSafeIter();
+
+	EXPECT_EQ(l_allocationsOfStorage + 1u, m_sut.getStats().nrOfAllocations);
+}
+
+TEST_F(TrackingMemoryResourceTestSuite, ComponentPoolTakesStorageFromGivenResource)
+{
+	ComponentPool<testComponents::ComponentA> l_pool(POOL_SIZE, m_sut);
+
+	EXPECT_GE(m_sut.getStats().currentBytes, POOL_SIZE * sizeof(testComponents::ComponentA));
+}
+
+TEST_F(TrackingMemoryResourceTestSuite, IdGuardKeepsFreedIdsInGivenResource)
+{
+	IdGuard l_idGuard(POOL_SIZE, m_sut);
+
+	//heap of freed ids and flags of freed ids
+	l_idGuard.freeId(l_idGuard.getNextId());
+	EXPECT_EQ(2u, m_sut.getStats().nrOfAllocations);
+
+	//storage of freed ids is kept for reuse
+	l_idGuard.freeId(l_idGuard.getNextId());
+	EXPECT_EQ(2u, m_sut.getStats().nrOfAllocations);
+	EXPECT_LT(0u, m_sut.getStats().currentBytes);
+}
+
+TEST_F(TrackingMemoryResourceTestSuite, EntityPoolCanBeBackedByFixedArena)
+{
+	std::vector<unsigned char> l_buffer(ARENA_SIZE);
+	std::pmr::monotonic_buffer_resource l_arena(l_buffer.data(), l_buffer.size(), std::pmr::null_memory_resource());
+	TrackingMemoryResource l_entityMemory(l_arena);
+	TrackingMemoryResource l_idMemory(l_arena);
+
+	EntityPool l_entityPool(POOL_SIZE, std::make_unique<IdGuard>(POOL_SIZE, l_idMemory), l_entityMemory);
+
+	for (auto i = 0u; i < POOL_SIZE; i++)
+	{
+		l_entityPool.create();
+	}
+
+	l_entityPool.removeEntity(POOL_SIZE);
+
+	EXPECT_EQ(POOL_SIZE - 1u, l_entityPool.size());
+	EXPECT_GT(l_entityMemory.getStats().peakBytes, POOL_SIZE * sizeof(Entity));
+	//heap of freed ids and flags of freed ids
+	EXPECT_EQ(2u, l_idMemory.getStats().nrOfAllocations);
+}
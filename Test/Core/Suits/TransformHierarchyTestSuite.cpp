@@ -0,0 +1,265 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <random>
+#include <vector>
+#include "Core.h"
+#include "TransformHierarchy.h"
+#include "ThreadPool.h"
+
+using namespace testing;
+using namespace engine;
+
+namespace
+{
+const PoolSize CAPACITY = 8u;
+const PoolSize BIG_CAPACITY = 2000u;
+const u32 NR_OF_REPARENTS = 3000u;
+const u32 NR_OF_THREADS = 4u;
+
+const u32 EMPTY = 0u;
+const u32 ROOT_DEPTH = 0u;
+
+const EntityId TANK = 1u;
+const EntityId TURRET = 2u;
+const EntityId BARREL = 3u;
+const EntityId HULL = 4u;
+const EntityId ITEM = 5u;
+const EntityId OUT_OF_RANGE_ID = CAPACITY + 1u;
+
+const f32 HALF_PI = 1.57079632679f;
+const f32 TOLERANCE = 0.0001f;
+
+const Transform2D TANK_LOCAL{100.0f, 50.0f, HALF_PI};
+const Transform2D TURRET_LOCAL{10.0f, 0.0f, 0.0f};
+const Transform2D BARREL_LOCAL{5.0f, 0.0f, HALF_PI};
+}
+
+class TransformHierarchyTestSuite : public Test
+{
+public:
+	TransformHierarchyTestSuite()
+		:m_sut(CAPACITY)
+	{
+	}
+
+protected:
+	void addTank()
+	{
+		m_sut.add(TANK, TANK_LOCAL);
+		m_sut.add(TURRET, TURRET_LOCAL);
+		m_sut.add(BARREL, BARREL_LOCAL);
+
+		m_sut.setParent(TURRET, TANK);
+		m_sut.setParent(BARREL, TURRET);
+	}
+
+	void expectWorld(EntityId p_id, f32 p_x, f32 p_y, f32 p_rotation)
+	{
+		const auto& l_world = m_sut.getWorld(p_id);
+
+		EXPECT_NEAR(p_x, l_world.x, TOLERANCE);
+		EXPECT_NEAR(p_y, l_world.y, TOLERANCE);
+		EXPECT_NEAR(p_rotation, l_world.rotation, TOLERANCE);
+	}
+
+	//every parent has to lie in lower level, so one forward pass over storage is enough
+	void expectDepthOrder(const TransformHierarchy& p_hierarchy)
+	{
+		for (auto i = 0u; i < p_hierarchy.size(); i++)
+		{
+			const auto l_id = p_hierarchy.getEntityId(i);
+			const auto l_parent = p_hierarchy.getParent(l_id);
+
+			ASSERT_EQ(i, p_hierarchy.getIndex(l_id));
+
+			if (l_parent == UNDEFINED_ENTITY_ID)
+			{
+				EXPECT_EQ(ROOT_DEPTH, p_hierarchy.getDepth(l_id));
+			}
+			else
+			{
+				EXPECT_LT(p_hierarchy.getIndex(l_parent), i);
+				EXPECT_EQ(p_hierarchy.getDepth(l_parent) + 1u, p_hierarchy.getDepth(l_id));
+			}
+
+			if (i > 0u)
+			{
+				EXPECT_LE(p_hierarchy.getDepth(p_hierarchy.getEntityId(i - 1u)), p_hierarchy.getDepth(l_id));
+			}
+		}
+	}
+
+	TransformHierarchy m_sut;
+};
+
+TEST_F(TransformHierarchyTestSuite, addedEntityShouldBeRootWithWorldEqualToLocal)
+{
+	EXPECT_EQ(EMPTY, m_sut.size());
+	EXPECT_TRUE(m_sut.add(TANK, TANK_LOCAL));
+
+	EXPECT_TRUE(m_sut.has(TANK));
+	EXPECT_EQ(UNDEFINED_ENTITY_ID, m_sut.getParent(TANK));
+	EXPECT_EQ(ROOT_DEPTH, m_sut.getDepth(TANK));
+
+	m_sut.propagate();
+	expectWorld(TANK, TANK_LOCAL.x, TANK_LOCAL.y, TANK_LOCAL.rotation);
+}
+
+TEST_F(TransformHierarchyTestSuite, addShouldFailForDuplicatedOrInvalidIds)
+{
+	ASSERT_TRUE(m_sut.add(TANK));
+
+	EXPECT_FALSE(m_sut.add(TANK));
+	EXPECT_FALSE(m_sut.add(UNDEFINED_ENTITY_ID));
+	EXPECT_FALSE(m_sut.add(OUT_OF_RANGE_ID));
+	EXPECT_EQ(1u, m_sut.size());
+}
+
+TEST_F(TransformHierarchyTestSuite, setParentShouldLinkChildrenAsSiblings)
+{
+	m_sut.add(TANK);
+	m_sut.add(TURRET);
+	m_sut.add(HULL);
+
+	EXPECT_TRUE(m_sut.setParent(TURRET, TANK));
+	EXPECT_TRUE(m_sut.setParent(HULL, TANK));
+
+	const auto& l_tank = m_sut.getLinks(TANK);
+	EXPECT_EQ(HULL, l_tank.firstChild);
+	EXPECT_EQ(TURRET, m_sut.getLinks(HULL).nextSibling);
+	EXPECT_EQ(UNDEFINED_ENTITY_ID, m_sut.getLinks(TURRET).nextSibling);
+	EXPECT_EQ(TANK, m_sut.getParent(TURRET));
+	EXPECT_EQ(TANK, m_sut.getParent(HULL));
+	EXPECT_EQ(1u, m_sut.getDepth(TURRET));
+	EXPECT_EQ(2u, m_sut.getNrOfLevels());
+}
+
+TEST_F(TransformHierarchyTestSuite, childWorldShouldBeLocalTransformedByParentWorld)
+{
+	addTank();
+
+	m_sut.propagate();
+
+	expectWorld(TURRET, 100.0f, 60.0f, HALF_PI);
+	expectWorld(BARREL, 100.0f, 65.0f, 2.0f * HALF_PI);
+}
+
+TEST_F(TransformHierarchyTestSuite, changedLocalOfParentShouldMoveWholeSubtree)
+{
+	addTank();
+
+	m_sut.setLocal(TANK, Transform2D{0.0f, 0.0f, 0.0f});
+	m_sut.propagate();
+
+	expectWorld(TURRET, 10.0f, 0.0f, 0.0f);
+	expectWorld(BARREL, 15.0f, 0.0f, HALF_PI);
+}
+
+TEST_F(TransformHierarchyTestSuite, setParentShouldRejectCyclesAndUnknownEntities)
+{
+	addTank();
+
+	EXPECT_FALSE(m_sut.setParent(TANK, BARREL));
+	EXPECT_FALSE(m_sut.setParent(TANK, TANK));
+	EXPECT_FALSE(m_sut.setParent(TANK, ITEM));
+	EXPECT_FALSE(m_sut.setParent(ITEM, TANK));
+
+	EXPECT_EQ(UNDEFINED_ENTITY_ID, m_sut.getParent(TANK));
+	expectDepthOrder(m_sut);
+}
+
+TEST_F(TransformHierarchyTestSuite, detachedSubtreeShouldBeMovedToLowerLevels)
+{
+	addTank();
+	m_sut.add(ITEM);
+	m_sut.setParent(ITEM, BARREL);
+
+	EXPECT_TRUE(m_sut.setParent(TURRET, UNDEFINED_ENTITY_ID));
+
+	EXPECT_EQ(UNDEFINED_ENTITY_ID, m_sut.getLinks(TANK).firstChild);
+	EXPECT_EQ(ROOT_DEPTH, m_sut.getDepth(TURRET));
+	EXPECT_EQ(1u, m_sut.getDepth(BARREL));
+	EXPECT_EQ(2u, m_sut.getDepth(ITEM));
+	EXPECT_EQ(3u, m_sut.getNrOfLevels());
+	expectDepthOrder(m_sut);
+
+	m_sut.propagate();
+	expectWorld(BARREL, 15.0f, 0.0f, HALF_PI);
+}
+
+TEST_F(TransformHierarchyTestSuite, reparentedSubtreeShouldBeMovedToDeeperLevels)
+{
+	addTank();
+	m_sut.add(HULL, Transform2D{1.0f, 2.0f, 0.0f});
+	m_sut.add(ITEM);
+	m_sut.setParent(ITEM, TANK);
+
+	EXPECT_TRUE(m_sut.setParent(TANK, HULL));
+
+	EXPECT_EQ(1u, m_sut.getDepth(TANK));
+	EXPECT_EQ(2u, m_sut.getDepth(ITEM));
+	EXPECT_EQ(3u, m_sut.getDepth(BARREL));
+	expectDepthOrder(m_sut);
+
+	m_sut.propagate();
+	expectWorld(TURRET, 101.0f, 62.0f, HALF_PI);
+}
+
+TEST_F(TransformHierarchyTestSuite, childrenOfRemovedEntityShouldBecomeRoots)
+{
+	addTank();
+	m_sut.add(HULL);
+	m_sut.setParent(HULL, TANK);
+
+	EXPECT_TRUE(m_sut.remove(TANK));
+	EXPECT_FALSE(m_sut.remove(TANK));
+
+	EXPECT_FALSE(m_sut.has(TANK));
+	EXPECT_EQ(UNDEFINED_ENTITY_ID, m_sut.getParent(TURRET));
+	EXPECT_EQ(UNDEFINED_ENTITY_ID, m_sut.getParent(HULL));
+	EXPECT_EQ(TURRET, m_sut.getParent(BARREL));
+	EXPECT_EQ(3u, m_sut.size());
+	expectDepthOrder(m_sut);
+
+	EXPECT_TRUE(m_sut.remove(BARREL));
+	EXPECT_EQ(UNDEFINED_ENTITY_ID, m_sut.getLinks(TURRET).firstChild);
+	EXPECT_EQ(1u, m_sut.getNrOfLevels());
+}
+
+TEST_F(TransformHierarchyTestSuite, randomReparentingShouldKeepDepthOrderAndParallelResultEqualToSerial)
+{
+	TransformHierarchy l_serial(BIG_CAPACITY);
+	TransformHierarchy l_parallel(BIG_CAPACITY);
+	std::mt19937 l_random(7u);
+	std::uniform_int_distribution<EntityId> l_ids(1u, BIG_CAPACITY);
+	std::uniform_real_distribution<f32> l_values(-1.0f, 1.0f);
+
+	for (auto l_id = 1u; l_id <= BIG_CAPACITY; l_id++)
+	{
+		const Transform2D l_local{l_values(l_random), l_values(l_random), l_values(l_random)};
+		l_serial.add(l_id, l_local);
+		l_parallel.add(l_id, l_local);
+	}
+
+	for (auto i = 0u; i < NR_OF_REPARENTS; i++)
+	{
+		const auto l_child = l_ids(l_random);
+		const auto l_parent = i % 10u == 0u ? UNDEFINED_ENTITY_ID : l_ids(l_random);
+
+		ASSERT_EQ(l_serial.setParent(l_child, l_parent), l_parallel.setParent(l_child, l_parent));
+	}
+
+	expectDepthOrder(l_parallel);
+	EXPECT_GT(l_parallel.getNrOfLevels(), 2u);
+
+	l_serial.propagate();
+	ThreadPool l_threadPool(NR_OF_THREADS - 1u);
+	l_parallel.propagateParallel(l_threadPool);
+
+	for (auto l_id = 1u; l_id <= BIG_CAPACITY; l_id++)
+	{
+		EXPECT_EQ(l_serial.getWorld(l_id).x, l_parallel.getWorld(l_id).x);
+		EXPECT_EQ(l_serial.getWorld(l_id).y, l_parallel.getWorld(l_id).y);
+		EXPECT_EQ(l_serial.getWorld(l_id).rotation, l_parallel.getWorld(l_id).rotation);
+	}
+}
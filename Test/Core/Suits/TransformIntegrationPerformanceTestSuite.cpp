@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "Core.h"
+#include "Stopwatch.h"
+#include "PositionComponent.h"
+#include "MovableComponent.h"
+#include "TransformStore.h"
+#include "IntegrationKernels.h"
+
+using namespace testing;
+using namespace engine;
+
+namespace
+{
+	const bool ENABLED = true;
+	const bool DISABLED = false;
+
+	const PoolSize NR_OF_ENTITIES = 1000000u;
+	const u32 LOOPS = 100u;
+	const f32 DELTA_TIME = 1.0f / 60.0f;
+
+	//TESTS:
+	const bool compareComponentChainWithSoaKernels = DISABLED;
+}
+
+class TransformIntegrationPerformanceTestSuite : public Test
+{
+public:
+	TransformIntegrationPerformanceTestSuite() = default;
+
+	void startStopwatch()
+	{
+		m_stopwatch.start();
+	}
+
+	void stopStopwatch()
+	{
+		m_stopwatch.stop();
+		std::cout << "Measured time: " << m_stopwatch.getElapsedTime().count() << "ms \n\n";
+	}
+
+	void createEntitiesWithLinkedComponents(ContinuousPool<Entity>& p_entities,
+											ContinuousPool<PositionComponent>& p_positions,
+											ContinuousPool<MovableComponent>& p_movables)
+	{
+		for (auto i = 1u; i <= NR_OF_ENTITIES; i++)
+		{
+			auto& l_entity = p_entities.allocate(i);
+			auto& l_position = p_positions.allocate();
+			auto& l_movable = p_movables.allocate();
+
+			l_movable.velocityX = static_cast<f32>(i % 7);
+			l_movable.velocityY = static_cast<f32>(i % 5);
+
+			l_entity.components = &l_position;
+			l_position.nextComponent = &l_movable;
+		}
+	}
+
+	void integrateComponentChain(ContinuousPool<Entity>& p_entities)
+	{
+		for (auto& l_entity : p_entities)
+		{
+			PositionComponent* l_position = nullptr;
+			MovableComponent* l_movable = nullptr;
+
+			for (auto l_component = l_entity.components; l_component != nullptr; l_component = l_component->nextComponent)
+			{
+				if (l_component->type == ComponentType::POSITION)
+					l_position = static_cast<PositionComponent*>(l_component);
+				else if (l_component->type == ComponentType::MOVABLE)
+					l_movable = static_cast<MovableComponent*>(l_component);
+			}
+
+			if (l_position and l_movable)
+			{
+				l_position->x += l_movable->velocityX * DELTA_TIME;
+				l_position->y += l_movable->velocityY * DELTA_TIME;
+			}
+		}
+	}
+
+	void fillTransformStore(TransformStore& p_store)
+	{
+		for (auto i = 1u; i <= NR_OF_ENTITIES; i++)
+		{
+			p_store.add(i, 0.0f, 0.0f, static_cast<f32>(i % 7), static_cast<f32>(i % 5));
+		}
+	}
+
+	void measureKernel(TransformStore& p_store, SimdLevel p_level, const char* p_name)
+	{
+		if (not kernels::isSimdLevelSupported(p_level))
+		{
+			std::cout << p_name << " is not supported on this CPU \n\n";
+			return;
+		}
+
+		std::cout << "SoA store, " << p_name << " kernel: \n";
+		auto l_kernel = kernels::getIntegrationKernel(p_level);
+
+		startStopwatch();
+		for (auto i = 0u; i < LOOPS; i++)
+			p_store.integrate(DELTA_TIME, l_kernel);
+		stopStopwatch();
+	}
+
+protected:
+	testTool::Stopwatch m_stopwatch;
+};
+
+TEST_F(TransformIntegrationPerformanceTestSuite, compareComponentChainWithSoaKernels)
+{
+	if (not compareComponentChainWithSoaKernels)
+		return;
+
+	{
+		ContinuousPool<Entity> l_entities(NR_OF_ENTITIES);
+		ContinuousPool<PositionComponent> l_positions(NR_OF_ENTITIES);
+		ContinuousPool<MovableComponent> l_movables(NR_OF_ENTITIES);
+		createEntitiesWithLinkedComponents(l_entities, l_positions, l_movables);
+
+		std::cout << "Linked ComponentBase chain, scalar loop: \n";
+		startStopwatch();
+		for (auto i = 0u; i < LOOPS; i++)
+			integrateComponentChain(l_entities);
+		stopStopwatch();
+	}
+
+	TransformStore l_store(NR_OF_ENTITIES);
+	fillTransformStore(l_store);
+
+	measureKernel(l_store, SimdLevel::SCALAR, "scalar");
+	measureKernel(l_store, SimdLevel::SSE2, "SSE2");
+	measureKernel(l_store, SimdLevel::AVX2, "AVX2");
+}
@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "Core.h"
+#include "TransformStore.h"
+
+using namespace testing;
+using namespace engine;
+
+namespace
+{
+const PoolSize CAPACITY = 4u;
+
+const u32 EMPTY = 0u;
+const u32 ONE_ELEMENT = 1u;
+const u32 TWO_ELEMENTS = 2u;
+
+const EntityId ENTITY_ID_1 = 1u;
+const EntityId ENTITY_ID_2 = 2u;
+const EntityId ENTITY_ID_3 = 3u;
+const EntityId OUT_OF_RANGE_ID = CAPACITY + 1u;
+
+const f32 POSITION_X = 10.0f;
+const f32 POSITION_Y = -5.0f;
+const f32 VELOCITY_X = 2.0f;
+const f32 VELOCITY_Y = 4.0f;
+const f32 DELTA_TIME = 0.5f;
+}
+
+class TransformStoreTestSuite : public Test
+{
+public:
+	TransformStoreTestSuite()
+		:m_sut(CAPACITY)
+	{
+	}
+
+protected:
+	TransformStore m_sut;
+};
+
+TEST_F(TransformStoreTestSuite, storeIsEmptyAfterInitialization)
+{
+	EXPECT_EQ(EMPTY, m_sut.size());
+	EXPECT_EQ(CAPACITY, m_sut.capacity());
+	EXPECT_FALSE(m_sut.has(ENTITY_ID_1));
+}
+
+TEST_F(TransformStoreTestSuite, addedEntityShouldBeStored)
+{
+	EXPECT_TRUE(m_sut.add(ENTITY_ID_1, POSITION_X, POSITION_Y, VELOCITY_X, VELOCITY_Y));
+
+	EXPECT_EQ(ONE_ELEMENT, m_sut.size());
+	EXPECT_TRUE(m_sut.has(ENTITY_ID_1));
+
+	auto l_index = m_sut.getIndex(ENTITY_ID_1);
+	EXPECT_EQ(ENTITY_ID_1, m_sut.getEntityId(l_index));
+	EXPECT_EQ(POSITION_X, m_sut.positionsX()[l_index]);
+	EXPECT_EQ(POSITION_Y, m_sut.positionsY()[l_index]);
+	EXPECT_EQ(VELOCITY_X, m_sut.velocitiesX()[l_index]);
+	EXPECT_EQ(VELOCITY_Y, m_sut.velocitiesY()[l_index]);
+}
+
+TEST_F(TransformStoreTestSuite, addShouldFailForDuplicatedOrInvalidIds)
+{
+	ASSERT_TRUE(m_sut.add(ENTITY_ID_1, POSITION_X, POSITION_Y));
+
+	EXPECT_FALSE(m_sut.add(ENTITY_ID_1, POSITION_X, POSITION_Y));
+	EXPECT_FALSE(m_sut.add(UNDEFINED_ENTITY_ID, POSITION_X, POSITION_Y));
+	EXPECT_FALSE(m_sut.add(OUT_OF_RANGE_ID, POSITION_X, POSITION_Y));
+	EXPECT_EQ(ONE_ELEMENT, m_sut.size());
+}
+
+TEST_F(TransformStoreTestSuite, removeShouldMoveLastElementIntoFreedSlot)
+{
+	m_sut.add(ENTITY_ID_1, POSITION_X, POSITION_Y);
+	m_sut.add(ENTITY_ID_2, POSITION_Y, POSITION_X);
+	m_sut.add(ENTITY_ID_3, VELOCITY_X, VELOCITY_Y);
+
+	EXPECT_TRUE(m_sut.remove(ENTITY_ID_1));
+
+	EXPECT_EQ(TWO_ELEMENTS, m_sut.size());
+	EXPECT_FALSE(m_sut.has(ENTITY_ID_1));
+	EXPECT_EQ(TransformStore::INVALID_INDEX, m_sut.getIndex(ENTITY_ID_1));
+
+	auto l_movedIndex = m_sut.getIndex(ENTITY_ID_3);
+	EXPECT_EQ(0u, l_movedIndex);
+	EXPECT_EQ(ENTITY_ID_3, m_sut.getEntityId(l_movedIndex));
+	EXPECT_EQ(VELOCITY_X, m_sut.positionsX()[l_movedIndex]);
+	EXPECT_EQ(VELOCITY_Y, m_sut.positionsY()[l_movedIndex]);
+}
+
+TEST_F(TransformStoreTestSuite, removeShouldReturnFalseIfEntityWasNotStored)
+{
+	EXPECT_FALSE(m_sut.remove(ENTITY_ID_1));
+	EXPECT_FALSE(m_sut.remove(OUT_OF_RANGE_ID));
+}
+
+TEST_F(TransformStoreTestSuite, integrateShouldMoveEntitiesByVelocity)
+{
+	m_sut.add(ENTITY_ID_1, POSITION_X, POSITION_Y, VELOCITY_X, VELOCITY_Y);
+	m_sut.integrate(DELTA_TIME);
+
+	auto l_index = m_sut.getIndex(ENTITY_ID_1);
+	EXPECT_FLOAT_EQ(POSITION_X + VELOCITY_X * DELTA_TIME, m_sut.positionsX()[l_index]);
+	EXPECT_FLOAT_EQ(POSITION_Y + VELOCITY_Y * DELTA_TIME, m_sut.positionsY()[l_index]);
+}
+
+TEST_F(TransformStoreTestSuite, clearShouldRemoveAllEntities)
+{
+	m_sut.add(ENTITY_ID_1, POSITION_X, POSITION_Y);
+	m_sut.add(ENTITY_ID_2, POSITION_X, POSITION_Y);
+
+	m_sut.clear();
+
+	EXPECT_EQ(EMPTY, m_sut.size());
+	EXPECT_FALSE(m_sut.has(ENTITY_ID_1));
+	EXPECT_TRUE(m_sut.add(ENTITY_ID_2, POSITION_X, POSITION_Y));
+}
+
+TEST_F(TransformStoreTestSuite, EntityIdsCanBeRestoredAfterBulkFill)
+{
+	const EntityId l_ids[] = { ENTITY_ID_3, ENTITY_ID_1 };
+	m_sut.positionsX()[1] = POSITION_X;
+
+	EXPECT_TRUE(m_sut.restoreEntityIds(l_ids, TWO_ELEMENTS));
+
+	EXPECT_EQ(TWO_ELEMENTS, m_sut.size());
+	EXPECT_TRUE(m_sut.has(ENTITY_ID_3));
+	EXPECT_FALSE(m_sut.has(ENTITY_ID_2));
+	EXPECT_EQ(POSITION_X, m_sut.positionsX()[m_sut.getIndex(ENTITY_ID_1)]);
+}
+
+TEST_F(TransformStoreTestSuite, RestoringDuplicatedOrInvalidIdsFails)
+{
+	const EntityId l_duplicatedIds[] = { ENTITY_ID_1, ENTITY_ID_1 };
+	const EntityId l_invalidIds[] = { ENTITY_ID_1, OUT_OF_RANGE_ID };
+
+	EXPECT_FALSE(m_sut.restoreEntityIds(l_duplicatedIds, TWO_ELEMENTS));
+	EXPECT_FALSE(m_sut.restoreEntityIds(l_invalidIds, TWO_ELEMENTS));
+	EXPECT_EQ(EMPTY, m_sut.size());
+}
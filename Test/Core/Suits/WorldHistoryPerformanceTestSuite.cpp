@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "Core.h"
+#include "Stopwatch.h"
+#include "WorldHistory.h"
+#include "IdGuard.h"
+#include "MovableComponent.h"
+
+using namespace testing;
+using namespace engine;
+
+namespace
+{
+	const bool ENABLED = true;
+	const bool DISABLED = false;
+
+	const PoolSize NR_OF_ENTITIES = 10000u;
+	const u32 ROLLBACK_FRAMES = 8u;
+	const f32 DELTA_TIME = 1.0f / 60.0f;
+
+	//TESTS:
+	const bool rollbackAndResimulateEightFrames = DISABLED;
+}
+
+class WorldHistoryPerformanceTestSuite : public Test
+{
+public:
+	WorldHistoryPerformanceTestSuite()
+		:m_entities(NR_OF_ENTITIES, std::make_unique<IdGuard>(NR_OF_ENTITIES)),
+		 m_movables(NR_OF_ENTITIES),
+		 m_transforms(NR_OF_ENTITIES),
+		 m_sut(m_entities)
+	{
+		m_sut.registerComponentPool(m_movables);
+		m_sut.registerTransformStore(m_transforms);
+
+		for (auto i = 0u; i < NR_OF_ENTITIES; i++)
+		{
+			auto& l_entity = m_entities.create();
+			m_movables.allocate().connectedEntity = l_entity.id;
+			m_transforms.add(l_entity.id, 0.0f, 0.0f, static_cast<f32>(i % 7), static_cast<f32>(i % 5));
+		}
+	}
+
+	void startStopwatch()
+	{
+		m_stopwatch.start();
+	}
+
+	void stopStopwatch()
+	{
+		m_stopwatch.stop();
+		std::cout << "Measured time: " << m_stopwatch.getElapsedTime().count() << "ms \n\n";
+	}
+
+	void simulate(u32 p_nrOfFrames)
+	{
+		for (auto i = 0u; i < p_nrOfFrames; i++)
+		{
+			m_transforms.integrate(DELTA_TIME);
+			m_sut.saveFrame();
+		}
+	}
+
+protected:
+	EntityPool m_entities;
+	ContinuousPool<MovableComponent> m_movables;
+	TransformStore m_transforms;
+	WorldHistory m_sut;
+	testTool::Stopwatch m_stopwatch;
+};
+
+TEST_F(WorldHistoryPerformanceTestSuite, rollbackAndResimulateEightFrames)
+{
+	if (not rollbackAndResimulateEightFrames)
+		return;
+
+	m_sut.saveFrame();
+	simulate(delta::DEFAULT_HISTORY_SIZE);
+
+	std::cout << "Restore " << ROLLBACK_FRAMES << " frames and resimulate them, " << NR_OF_ENTITIES << " entities: \n";
+	startStopwatch();
+	EXPECT_TRUE(m_sut.restoreFrame(ROLLBACK_FRAMES));
+	simulate(ROLLBACK_FRAMES);
+	stopStopwatch();
+}
@@ -0,0 +1,186 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "Core.h"
+#include "WorldHistory.h"
+#include "IdGuard.h"
+#include "MovableComponent.h"
+#include "PositionComponent.h"
+#include "ComponentPool.h"
+
+using namespace testing;
+using namespace engine;
+
+namespace
+{
+const PoolSize CAPACITY = 100u;
+const u32 NR_OF_ENTITIES = 10u;
+const u32 NR_OF_FRAMES = 8u;
+const f32 DELTA_TIME = 0.5f;
+const f32 ATTACHED_POSITION = 42.0f;
+}
+
+class WorldHistoryTestSuite : public Test
+{
+public:
+	WorldHistoryTestSuite()
+		:m_entities(CAPACITY, std::make_unique<IdGuard>(CAPACITY)),
+		 m_movables(CAPACITY),
+		 m_positions(CAPACITY),
+		 m_transforms(CAPACITY),
+		 m_sut(m_entities, NR_OF_FRAMES)
+	{
+		m_sut.registerComponentPool(m_movables);
+		m_sut.registerComponentPool(m_positions);
+		m_sut.registerTransformStore(m_transforms);
+
+		for (auto i = 0u; i < NR_OF_ENTITIES; i++)
+		{
+			createEntity();
+		}
+	}
+
+	EntityId createEntity()
+	{
+		auto& l_entity = m_entities.create();
+		auto& l_movable = m_movables.allocate();
+		l_movable.connectedEntity = l_entity.id;
+		l_movable.velocityX = static_cast<f32>(l_entity.id);
+
+		l_entity.components = &l_movable;
+		m_transforms.add(l_entity.id, 0.0f, 0.0f, l_movable.velocityX, 0.0f);
+
+		return l_entity.id;
+	}
+
+	PositionComponent& attachPosition(EntityId p_id)
+	{
+		ComponentBase* l_position = nullptr;
+		m_positions.getComponents(1u, &l_position);
+		l_position->connectedEntity = p_id;
+
+		m_entities.getEntity(p_id).components->nextComponent = l_position;
+		return static_cast<PositionComponent&>(*l_position);
+	}
+
+	void detachPosition(EntityId p_id)
+	{
+		auto& l_movable = *m_entities.getEntity(p_id).components;
+		m_positions.returnComponent(*l_movable.nextComponent);
+		l_movable.nextComponent = nullptr;
+	}
+
+	void tick()
+	{
+		m_transforms.integrate(DELTA_TIME);
+		m_sut.saveFrame();
+	}
+
+protected:
+	EntityPool m_entities;
+	ContinuousPool<MovableComponent> m_movables;
+	ComponentPool<PositionComponent> m_positions;
+	TransformStore m_transforms;
+	WorldHistory m_sut;
+};
+
+TEST_F(WorldHistoryTestSuite, restoreShouldFailBeforeFirstFrameIsSaved)
+{
+	EXPECT_EQ(0u, m_sut.getNumOfStoredFrames());
+	EXPECT_FALSE(m_sut.restoreFrame(0u));
+}
+
+TEST_F(WorldHistoryTestSuite, restoreFrameShouldBringBackTransforms)
+{
+	m_sut.saveFrame();
+	tick();
+	const auto l_positionAfterFirstTick = m_transforms.positionsX()[1];
+	tick();
+
+	ASSERT_TRUE(m_sut.restoreFrame(1u));
+	EXPECT_EQ(l_positionAfterFirstTick, m_transforms.positionsX()[1]);
+	EXPECT_EQ(2u, m_sut.getNumOfStoredFrames());
+}
+
+TEST_F(WorldHistoryTestSuite, restoreFrameShouldBringBackRemovedEntityAndIdGuardState)
+{
+	m_sut.saveFrame();
+
+	const EntityId l_removedId = 3u;
+	m_entities.removeEntity(l_removedId);
+	const auto l_newId = createEntity();
+	ASSERT_EQ(l_removedId, l_newId);
+	m_sut.saveFrame();
+
+	ASSERT_TRUE(m_sut.restoreFrame(1u));
+
+	EXPECT_EQ(NR_OF_ENTITIES, m_entities.size());
+	EXPECT_EQ(NR_OF_ENTITIES, m_movables.size());
+	EXPECT_TRUE(m_entities.hasEntity(l_removedId));
+	EXPECT_EQ(NR_OF_ENTITIES + 1u, m_entities.create().id);
+}
+
+TEST_F(WorldHistoryTestSuite, restoredComponentLinksShouldStayValid)
+{
+	m_sut.saveFrame();
+	m_entities.removeEntity(1u);
+	m_sut.saveFrame();
+
+	ASSERT_TRUE(m_sut.restoreFrame(1u));
+
+	auto& l_entity = m_entities.getEntity(1u);
+	ASSERT_NE(nullptr, l_entity.components);
+	EXPECT_EQ(1u, l_entity.components->connectedEntity);
+}
+
+TEST_F(WorldHistoryTestSuite, restoreFrameZeroShouldDropUnsavedChanges)
+{
+	m_sut.saveFrame();
+	const auto l_savedPosition = m_transforms.positionsX()[1];
+
+	m_transforms.integrate(DELTA_TIME);
+	createEntity();
+
+	ASSERT_TRUE(m_sut.restoreFrame(0u));
+	EXPECT_EQ(l_savedPosition, m_transforms.positionsX()[1]);
+	EXPECT_EQ(NR_OF_ENTITIES, m_entities.size());
+}
+
+TEST_F(WorldHistoryTestSuite, resimulationShouldReproduceSameState)
+{
+	m_sut.saveFrame();
+	for (auto i = 0u; i < NR_OF_FRAMES; i++)
+		tick();
+
+	const std::vector<f32> l_expected(m_transforms.positionsX(), m_transforms.positionsX() + m_transforms.size());
+
+	ASSERT_TRUE(m_sut.restoreFrame(NR_OF_FRAMES));
+	for (auto i = 0u; i < NR_OF_FRAMES; i++)
+		tick();
+
+	EXPECT_EQ(l_expected, std::vector<f32>(m_transforms.positionsX(), m_transforms.positionsX() + m_transforms.size()));
+	EXPECT_FALSE(m_sut.restoreFrame(NR_OF_FRAMES + 1u));
+}
+
+TEST_F(WorldHistoryTestSuite, componentsAttachedAndDetachedAfterSaveShouldBeRestored)
+{
+	const EntityId l_keptId = 1u;
+	const EntityId l_otherId = 2u;
+	attachPosition(l_keptId).x = ATTACHED_POSITION;
+	m_sut.saveFrame();
+
+	detachPosition(l_keptId);
+	attachPosition(l_otherId);
+	attachPosition(3u);
+	m_sut.saveFrame();
+	ASSERT_EQ(2u, m_positions.size());
+
+	ASSERT_TRUE(m_sut.restoreFrame(1u));
+
+	EXPECT_EQ(1u, m_positions.size());
+	EXPECT_EQ(nullptr, m_entities.getEntity(l_otherId).components->nextComponent);
+
+	auto l_position = dynamic_cast<PositionComponent*>(m_entities.getEntity(l_keptId).components->nextComponent);
+	ASSERT_NE(nullptr, l_position);
+	EXPECT_EQ(l_keptId, l_position->connectedEntity);
+	EXPECT_EQ(ATTACHED_POSITION, l_position->x);
+}
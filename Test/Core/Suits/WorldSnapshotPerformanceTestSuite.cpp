@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <filesystem>
+#include <fstream>
+#include "Core.h"
+#include "Stopwatch.h"
+#include "WorldSnapshot.h"
+#include "EntityPool.h"
+#include "IdGuard.h"
+#include "PositionComponent.h"
+#include "MovableComponent.h"
+
+using namespace testing;
+using namespace engine;
+
+namespace
+{
+	const bool ENABLED = true;
+	const bool DISABLED = false;
+
+	const PoolSize NR_OF_ENTITIES = 1000000u;
+
+	//TESTS:
+	const bool loadMillionEntitiesFromFile = DISABLED;
+}
+
+class WorldSnapshotPerformanceTestSuite : public Test
+{
+public:
+	WorldSnapshotPerformanceTestSuite()
+		:m_entityPool(NR_OF_ENTITIES, std::make_unique<IdGuard>(NR_OF_ENTITIES)),
+		 m_entities(m_entityPool.getEntities()),
+		 m_positions(NR_OF_ENTITIES),
+		 m_movables(NR_OF_ENTITIES),
+		 m_transforms(NR_OF_ENTITIES),
+		 m_snapshot(m_entityPool, m_transforms)
+	{
+		m_snapshot.registerComponentPool(m_positions);
+		m_snapshot.registerComponentPool(m_movables);
+	}
+
+	void startStopwatch()
+	{
+		m_stopwatch.start();
+	}
+
+	void stopStopwatch()
+	{
+		m_stopwatch.stop();
+		std::cout << "Measured time: " << m_stopwatch.getElapsedTime().count() << "ms \n\n";
+	}
+
+	void populate()
+	{
+		for (auto i = 1u; i <= NR_OF_ENTITIES; i++)
+		{
+			auto& l_entity = m_entityPool.create();
+			auto& l_position = m_positions.allocate();
+			auto& l_movable = m_movables.allocate();
+
+			l_entity.components = &l_position;
+			l_position.nextComponent = &l_movable;
+			l_entity.attachedComponents.set(ComponentType::POSITION);
+			l_entity.attachedComponents.set(ComponentType::MOVABLE);
+
+			m_transforms.add(i, static_cast<f32>(i), 0.0f, 1.0f, 1.0f);
+		}
+	}
+
+protected:
+	testTool::Stopwatch m_stopwatch;
+
+	EntityPool m_entityPool;
+	ContinuousPool<Entity>& m_entities;
+	ContinuousPool<PositionComponent> m_positions;
+	ContinuousPool<MovableComponent> m_movables;
+	TransformStore m_transforms;
+	WorldSnapshot m_snapshot;
+};
+
+TEST_F(WorldSnapshotPerformanceTestSuite, loadMillionEntitiesFromFile)
+{
+	if (not loadMillionEntitiesFromFile)
+		return;
+
+	const auto l_path = std::filesystem::temp_directory_path() / "worldSnapshotPerformance.bin";
+	populate();
+
+	{
+		std::cout << "Save: \n";
+		std::ofstream l_file(l_path, std::ios::binary);
+
+		startStopwatch();
+		EXPECT_TRUE(m_snapshot.save(l_file));
+		stopStopwatch();
+	}
+
+	std::cout << "Snapshot size: " << std::filesystem::file_size(l_path) / (1024u * 1024u) << "MB \n";
+
+	{
+		std::cout << "Load: \n";
+		std::ifstream l_file(l_path, std::ios::binary);
+
+		startStopwatch();
+		EXPECT_TRUE(m_snapshot.load(l_file));
+		stopStopwatch();
+	}
+
+	EXPECT_EQ(NR_OF_ENTITIES, m_entities.size());
+
+	{
+		std::cout << "Map: \n";
+		MappedFile l_file;
+
+		startStopwatch();
+		EXPECT_TRUE(l_file.open(l_path.string()));
+		EXPECT_TRUE(m_snapshot.map(l_file));
+		stopStopwatch();
+
+		EXPECT_EQ(NR_OF_ENTITIES, m_entities.size());
+		m_entityPool.clear();
+		m_positions.clear();
+		m_movables.clear();
+	}
+
+	std::filesystem::remove(l_path);
+}
@@ -0,0 +1,348 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include "Core.h"
+#include "WorldSnapshot.h"
+#include "EntityPool.h"
+#include "IdGuard.h"
+#include "PositionComponent.h"
+#include "MovableComponent.h"
+#include "ComponentPool.h"
+
+using namespace testing;
+using namespace engine;
+
+namespace
+{
+const PoolSize CAPACITY = 10u;
+const u32 NR_OF_ENTITIES = 5u;
+const EntityId REMOVED_ENTITY_ID = 2u;
+const EntityId KEPT_ENTITY_ID = 3u;
+
+const f32 VELOCITY_X = 3.0f;
+const f32 VELOCITY_Y = -1.0f;
+const f32 CHANGED_POSITION = 100.0f;
+
+const std::string SNAPSHOT_FILE = "worldSnapshotTestSuite.bin";
+}
+
+struct TestWorld
+{
+	TestWorld(PoolSize p_capacity = CAPACITY)
+		:entityPool(p_capacity, std::make_unique<IdGuard>(p_capacity)),
+		 entities(entityPool.getEntities()),
+		 positions(CAPACITY),
+		 movables(CAPACITY),
+		 transforms(CAPACITY),
+		 snapshot(entityPool, transforms)
+	{
+		snapshot.registerComponentPool(positions);
+		snapshot.registerComponentPool(movables);
+	}
+
+	void populate()
+	{
+		for (auto i = 1u; i <= NR_OF_ENTITIES; i++)
+		{
+			auto& l_entity = entityPool.create();
+			auto& l_position = positions.allocate();
+			l_position.x = static_cast<f32>(i);
+			l_position.connectedEntity = i;
+
+			l_entity.components = &l_position;
+			l_entity.attachedComponents.set(ComponentType::POSITION);
+
+			if (i % 2u == 0u)
+			{
+				auto& l_movable = movables.allocate();
+				l_movable.velocityX = VELOCITY_X * i;
+				l_movable.connectedEntity = i;
+
+				l_position.nextComponent = &l_movable;
+				l_entity.attachedComponents.set(ComponentType::MOVABLE);
+			}
+
+			transforms.add(i, static_cast<f32>(i), -static_cast<f32>(i), VELOCITY_X, VELOCITY_Y);
+		}
+	}
+
+	EntityPool entityPool;
+	ContinuousPool<Entity>& entities;
+	ContinuousPool<PositionComponent> positions;
+	ContinuousPool<MovableComponent> movables;
+	TransformStore transforms;
+	WorldSnapshot snapshot;
+};
+
+class WorldSnapshotTestSuite : public Test
+{
+public:
+	WorldSnapshotTestSuite()
+	{
+		m_source.populate();
+	}
+
+	~WorldSnapshotTestSuite()
+	{
+		std::filesystem::remove(getSnapshotPath());
+	}
+
+	std::stringstream saveSource()
+	{
+		std::stringstream l_stream;
+		EXPECT_TRUE(m_source.snapshot.save(l_stream));
+		return l_stream;
+	}
+
+	std::string saveSourceToFile()
+	{
+		std::ofstream l_file(getSnapshotPath(), std::ios::binary);
+		EXPECT_TRUE(m_source.snapshot.save(l_file));
+		return getSnapshotPath();
+	}
+
+	std::string getSnapshotPath() const
+	{
+		return (std::filesystem::temp_directory_path() / SNAPSHOT_FILE).string();
+	}
+
+protected:
+	TestWorld m_source;
+	TestWorld m_target;
+};
+
+TEST_F(WorldSnapshotTestSuite, WorldIsRestoredWithComponentLinks)
+{
+	auto l_stream = saveSource();
+	ASSERT_TRUE(m_target.snapshot.load(l_stream));
+
+	ASSERT_EQ(NR_OF_ENTITIES, m_target.entities.size());
+	EXPECT_EQ(m_source.positions.size(), m_target.positions.size());
+	EXPECT_EQ(m_source.movables.size(), m_target.movables.size());
+
+	for (auto& l_entity : m_target.entities)
+	{
+		ASSERT_NE(nullptr, l_entity.components);
+		ASSERT_EQ(ComponentType::POSITION, l_entity.components->type);
+
+		auto l_position = static_cast<PositionComponent*>(l_entity.components);
+		EXPECT_TRUE(m_target.positions.isMyObject(*l_position));
+		EXPECT_EQ(static_cast<f32>(l_entity.id), l_position->x);
+		EXPECT_EQ(l_entity.id, l_position->connectedEntity);
+
+		if (l_entity.attachedComponents.isSet(ComponentType::MOVABLE))
+		{
+			ASSERT_NE(nullptr, l_position->nextComponent);
+			auto l_movable = dynamic_cast<MovableComponent*>(l_position->nextComponent);
+
+			ASSERT_NE(nullptr, l_movable);
+			EXPECT_TRUE(m_target.movables.isMyObject(*l_movable));
+			EXPECT_EQ(VELOCITY_X * l_entity.id, l_movable->velocityX);
+		}
+		else
+		{
+			EXPECT_EQ(nullptr, l_position->nextComponent);
+		}
+	}
+}
+
+TEST_F(WorldSnapshotTestSuite, EntityPoolAndIdGuardStateAreRestored)
+{
+	m_source.entityPool.removeEntity(REMOVED_ENTITY_ID);
+	m_target.populate();
+
+	auto l_stream = saveSource();
+	ASSERT_TRUE(m_target.snapshot.load(l_stream));
+
+	EXPECT_EQ(NR_OF_ENTITIES - 1u, m_target.entityPool.size());
+	EXPECT_FALSE(m_target.entityPool.hasEntity(REMOVED_ENTITY_ID));
+	EXPECT_TRUE(m_target.entityPool.hasEntity(KEPT_ENTITY_ID));
+	EXPECT_EQ(KEPT_ENTITY_ID, m_target.entityPool.getEntity(KEPT_ENTITY_ID).id);
+
+	EXPECT_EQ(REMOVED_ENTITY_ID, m_target.entityPool.create().id);
+	EXPECT_EQ(NR_OF_ENTITIES + 1u, m_target.entityPool.create().id);
+}
+
+TEST_F(WorldSnapshotTestSuite, TransformsAreRestored)
+{
+	auto l_stream = saveSource();
+	ASSERT_TRUE(m_target.snapshot.load(l_stream));
+
+	ASSERT_EQ(NR_OF_ENTITIES, m_target.transforms.size());
+
+	for (auto i = 1u; i <= NR_OF_ENTITIES; i++)
+	{
+		const auto l_index = m_target.transforms.getIndex(i);
+		ASSERT_NE(TransformStore::INVALID_INDEX, l_index);
+		EXPECT_EQ(-static_cast<f32>(i), m_target.transforms.positionsY()[l_index]);
+		EXPECT_EQ(VELOCITY_X, m_target.transforms.velocitiesX()[l_index]);
+	}
+}
+
+TEST_F(WorldSnapshotTestSuite, LoadingReplacesPreviousContent)
+{
+	m_target.populate();
+	m_target.populate();
+
+	auto l_stream = saveSource();
+	ASSERT_TRUE(m_target.snapshot.load(l_stream));
+
+	EXPECT_EQ(NR_OF_ENTITIES, m_target.entities.size());
+	EXPECT_EQ(m_source.positions.size(), m_target.positions.size());
+}
+
+TEST_F(WorldSnapshotTestSuite, NotRegisteredComponentBlockIsSkippedAndItsLinksAreDropped)
+{
+	EntityPool l_entityPool(CAPACITY, std::make_unique<IdGuard>(CAPACITY));
+	auto& l_entities = l_entityPool.getEntities();
+	ContinuousPool<PositionComponent> l_positions(CAPACITY);
+	TransformStore l_transforms(CAPACITY);
+	WorldSnapshot l_snapshot(l_entityPool, l_transforms);
+	l_snapshot.registerComponentPool(l_positions);
+
+	auto l_stream = saveSource();
+	ASSERT_TRUE(l_snapshot.load(l_stream));
+
+	EXPECT_EQ(NR_OF_ENTITIES, l_entities.size());
+	EXPECT_EQ(NR_OF_ENTITIES, l_transforms.size());
+
+	for (auto& l_position : l_positions)
+	{
+		EXPECT_EQ(nullptr, l_position.nextComponent);
+	}
+}
+
+TEST_F(WorldSnapshotTestSuite, InvalidDataIsRejected)
+{
+	std::stringstream l_garbage("not a snapshot at all");
+	EXPECT_FALSE(m_target.snapshot.load(l_garbage));
+
+	auto l_stream = saveSource();
+	auto l_truncated = l_stream.str();
+	l_truncated.resize(l_truncated.size() / 2u);
+
+	std::stringstream l_truncatedStream(l_truncated);
+	EXPECT_FALSE(m_target.snapshot.load(l_truncatedStream));
+}
+
+TEST_F(WorldSnapshotTestSuite, SnapshotBiggerThanPoolsIsRejected)
+{
+	TestWorld l_smallWorld(NR_OF_ENTITIES - 1u);
+
+	auto l_stream = saveSource();
+	EXPECT_FALSE(l_smallWorld.snapshot.load(l_stream));
+}
+
+TEST_F(WorldSnapshotTestSuite, MappedWorldUsesFileMemoryInPlace)
+{
+	MappedFile l_file;
+	ASSERT_TRUE(l_file.open(saveSourceToFile()));
+	ASSERT_TRUE(m_target.snapshot.map(l_file));
+
+	EXPECT_TRUE(m_target.entities.hasExternalStorage());
+	EXPECT_TRUE(m_target.positions.hasExternalStorage());
+	EXPECT_GE(reinterpret_cast<const u8*>(m_target.positions.data()), l_file.data());
+	EXPECT_LT(reinterpret_cast<const u8*>(m_target.positions.data()), l_file.data() + l_file.size());
+
+	ASSERT_EQ(NR_OF_ENTITIES, m_target.entities.size());
+	EXPECT_EQ(NR_OF_ENTITIES, m_target.transforms.size());
+	EXPECT_TRUE(m_target.entityPool.hasEntity(NR_OF_ENTITIES));
+
+	for (auto& l_entity : m_target.entities)
+	{
+		auto l_position = dynamic_cast<PositionComponent*>(l_entity.components);
+		ASSERT_NE(nullptr, l_position);
+		EXPECT_EQ(static_cast<f32>(l_entity.id), l_position->x);
+
+		if (l_entity.attachedComponents.isSet(ComponentType::MOVABLE))
+		{
+			auto l_movable = dynamic_cast<MovableComponent*>(l_position->nextComponent);
+			ASSERT_NE(nullptr, l_movable);
+			EXPECT_EQ(VELOCITY_X * l_entity.id, l_movable->velocityX);
+		}
+	}
+}
+
+TEST_F(WorldSnapshotTestSuite, ChangesOfMappedWorldDoNotReachFile)
+{
+	const auto l_path = saveSourceToFile();
+
+	{
+		MappedFile l_file;
+		ASSERT_TRUE(l_file.open(l_path));
+		ASSERT_TRUE(m_target.snapshot.map(l_file));
+
+		m_target.positions.begin()->x = CHANGED_POSITION;
+		m_target.entities.clear();
+		m_target.positions.clear();
+		m_target.movables.clear();
+	}
+
+	TestWorld l_restored;
+	std::ifstream l_stream(l_path, std::ios::binary);
+	ASSERT_TRUE(l_restored.snapshot.load(l_stream));
+
+	EXPECT_EQ(NR_OF_ENTITIES, l_restored.entities.size());
+	EXPECT_NE(CHANGED_POSITION, l_restored.positions.begin()->x);
+}
+
+TEST_F(WorldSnapshotTestSuite, MappedWorldGrowsIntoCapacityReservedInFile)
+{
+	const auto l_path = saveSourceToFile();
+
+	{
+		MappedFile l_file;
+		ASSERT_TRUE(l_file.open(l_path));
+		ASSERT_TRUE(m_target.snapshot.map(l_file));
+
+		EXPECT_EQ(CAPACITY, m_target.entities.maxSize());
+		EXPECT_EQ(CAPACITY, m_target.positions.maxSize());
+
+		for (auto i = NR_OF_ENTITIES; i < CAPACITY; i++)
+		{
+			auto& l_entity = m_target.entityPool.create();
+			auto& l_position = m_target.positions.allocate();
+			l_position.x = CHANGED_POSITION;
+			l_entity.components = &l_position;
+
+			EXPECT_LT(reinterpret_cast<const u8*>(&l_entity), l_file.data() + l_file.size());
+			EXPECT_LT(reinterpret_cast<const u8*>(&l_position), l_file.data() + l_file.size());
+		}
+
+		EXPECT_EQ(CAPACITY, m_target.entities.size());
+		EXPECT_EQ(static_cast<f32>(NR_OF_ENTITIES), m_target.positions.data()[NR_OF_ENTITIES - 1u].x);
+		m_target.entities.clear();
+		m_target.positions.clear();
+		m_target.movables.clear();
+	}
+
+	TestWorld l_restored;
+	std::ifstream l_stream(l_path, std::ios::binary);
+	ASSERT_TRUE(l_restored.snapshot.load(l_stream));
+
+	EXPECT_EQ(NR_OF_ENTITIES, l_restored.entities.size());
+	EXPECT_EQ(NR_OF_ENTITIES, l_restored.positions.size());
+}
+
+TEST_F(WorldSnapshotTestSuite, ComponentPoolCanBeRegistered)
+{
+	EntityPool l_entityPool(CAPACITY, std::make_unique<IdGuard>(CAPACITY));
+	ComponentPool<PositionComponent> l_positions(CAPACITY);
+	TransformStore l_transforms(CAPACITY);
+	WorldSnapshot l_snapshot(l_entityPool, l_transforms);
+	l_snapshot.registerComponentPool(l_positions);
+
+	ComponentBase* l_position = nullptr;
+	l_positions.getComponents(1u, &l_position);
+	static_cast<PositionComponent*>(l_position)->x = CHANGED_POSITION;
+
+	std::stringstream l_stream;
+	ASSERT_TRUE(l_snapshot.save(l_stream));
+	l_positions.returnComponent(*l_position);
+
+	ASSERT_TRUE(l_snapshot.load(l_stream));
+	ASSERT_EQ(1u, l_positions.size());
+	EXPECT_EQ(CHANGED_POSITION, l_positions.getPool().begin()->x);
+}
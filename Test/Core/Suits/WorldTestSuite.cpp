@@ -0,0 +1,304 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <memory>
+#include <memory_resource>
+#include <sstream>
+#include <thread>
+#include <vector>
+#include "Core.h"
+#include "AllocationHook.h"
+#include "World.h"
+#include "WorldSnapshot.h"
+#include "System.h"
+#include "PositionComponent.h"
+#include "ComponentProviderMock.h"
+#include "ComponentObserverMock.h"
+
+using namespace testing;
+using namespace testTool;
+using namespace engine;
+
+namespace
+{
+const PoolSize CAPACITY = 4u;
+const PoolSize BIG_CAPACITY = 1000u;
+const u32 NR_OF_WORLDS = 4u;
+const u32 NR_OF_STEPS = 200u;
+const f32 DELTA_TIME = 0.5f;
+const u32 EVENT_CAPACITY = 16u;
+const std::size_t UPSTREAM_BUFFER_SIZE = 1u << 20;
+
+const EntityId ENTITY_ID_1 = 1u;
+const EntityId ENTITY_ID_2 = 2u;
+const EntityId OUT_OF_RANGE_ID = CAPACITY + 1u;
+
+struct SpawnEvent
+{
+	EntityId entity;
+};
+
+struct MatchState
+{
+	f32 elapsed = 0.0f;
+	u32 nrOfSpawnsSeen = 0u;
+	u64 checksum = 0u;
+};
+
+//spawns one entity per step, links it to previous one and counts spawns published in previous step
+class SpawnSystem : public System
+{
+public:
+	SpawnSystem(World& p_world)
+		:m_world(p_world)
+	{
+	}
+
+	void update(f32 p_deltaTime) override
+	{
+		auto& l_state = m_world.getResources().get<MatchState>();
+		l_state.elapsed += p_deltaTime;
+
+		m_world.getEvents().forEach<SpawnEvent>([&l_state](const SpawnEvent& p_event)
+		{
+			++l_state.nrOfSpawnsSeen;
+			l_state.checksum = l_state.checksum * 31u + p_event.entity;
+		});
+
+		const auto l_id = m_world.getEntityController().createEntity();
+		if (m_previousId != UNDEFINED_ENTITY_ID)
+		{
+			m_world.getRelations().add(l_id, RelationType::TARGETS, m_previousId);
+		}
+
+		m_world.getEvents().publish(SpawnEvent{l_id});
+		m_previousId = l_id;
+	}
+
+	ResourceAccess getResourceAccess() const override
+	{
+		return ResourceAccess().write<MatchState>();
+	}
+
+	const char* getName() const override
+	{
+		return "SpawnSystem";
+	}
+
+private:
+	World& m_world;
+	EntityId m_previousId = UNDEFINED_ENTITY_ID;
+};
+
+class Match
+{
+public:
+	Match()
+		:m_world(std::make_unique<NiceMock<ComponentProviderMock>>(), WorldSettings{BIG_CAPACITY}),
+		 m_spawnSystem(m_world)
+	{
+		m_world.getResources().emplace<MatchState>();
+		m_world.getEvents().registerEvent<SpawnEvent>(EVENT_CAPACITY);
+		m_world.getSystems().addSystem(m_spawnSystem);
+	}
+
+	void run()
+	{
+		for (auto i = 0u; i < NR_OF_STEPS; i++)
+		{
+			m_world.step(DELTA_TIME);
+		}
+	}
+
+	World& getWorld()
+	{
+		return m_world;
+	}
+
+private:
+	World m_world;
+	SpawnSystem m_spawnSystem;
+};
+}
+
+class WorldTestSuite : public Test
+{
+public:
+	WorldTestSuite()
+		:m_sut(createProvider(), WorldSettings{CAPACITY})
+	{
+	}
+
+protected:
+	std::unique_ptr<ComponentProviderMock> createProvider()
+	{
+		auto l_provider = std::make_unique<NiceMock<ComponentProviderMock>>();
+		ON_CALL(*l_provider, createComponent(ComponentType::POSITION)).WillByDefault(ReturnRef(m_position));
+
+		return l_provider;
+	}
+
+	PositionComponent m_position;
+	World m_sut;
+};
+
+TEST_F(WorldTestSuite, poolsShouldBeSizedBySettings)
+{
+	for (auto i = 1u; i <= CAPACITY; i++)
+	{
+		EXPECT_EQ(i, m_sut.getEntityController().createEntity());
+	}
+
+	EXPECT_EQ(CAPACITY, m_sut.getSettings().maxNrOfEntities);
+	EXPECT_EQ(CAPACITY, m_sut.getEntityPool().size());
+	EXPECT_TRUE(m_sut.getRelations().add(ENTITY_ID_1, RelationType::OWNED_BY, CAPACITY));
+	EXPECT_FALSE(m_sut.getRelations().add(ENTITY_ID_1, RelationType::OWNED_BY, OUT_OF_RANGE_ID));
+}
+
+TEST_F(WorldTestSuite, worldsShouldNotShareEntitiesResourcesOrEvents)
+{
+	World l_other(std::make_unique<NiceMock<ComponentProviderMock>>(), WorldSettings{CAPACITY});
+	m_sut.getResources().emplace<MatchState>();
+	m_sut.getEvents().registerEvent<SpawnEvent>(EVENT_CAPACITY);
+
+	EXPECT_EQ(ENTITY_ID_1, m_sut.getEntityController().createEntity());
+	EXPECT_EQ(ENTITY_ID_1, l_other.getEntityController().createEntity());
+	EXPECT_EQ(ENTITY_ID_2, l_other.getEntityController().createEntity());
+
+	EXPECT_EQ(1u, m_sut.getEntityPool().size());
+	EXPECT_FALSE(l_other.getResources().has<MatchState>());
+	EXPECT_FALSE(l_other.getEvents().isRegistered<SpawnEvent>());
+}
+
+TEST_F(WorldTestSuite, entitiesOfWorldShouldBeRestoredFromSnapshotWithoutIdCollisions)
+{
+	World l_restored(std::make_unique<NiceMock<ComponentProviderMock>>(), WorldSettings{CAPACITY});
+	TransformStore l_transforms(CAPACITY);
+	WorldSnapshot l_source(m_sut.getEntityPool(), l_transforms);
+	WorldSnapshot l_target(l_restored.getEntityPool(), l_transforms);
+	std::stringstream l_stream;
+
+	m_sut.getEntityController().createEntity();
+	m_sut.getEntityController().createEntity();
+	m_sut.getEntityController().removeEntity(ENTITY_ID_1);
+
+	ASSERT_TRUE(l_source.save(l_stream));
+	ASSERT_TRUE(l_target.load(l_stream));
+
+	EXPECT_FALSE(l_restored.getEntityController().hasEntity(ENTITY_ID_1));
+	EXPECT_TRUE(l_restored.getEntityController().hasEntity(ENTITY_ID_2));
+	EXPECT_EQ(ENTITY_ID_1, l_restored.getEntityController().createEntity());
+	EXPECT_EQ(ENTITY_ID_2 + 1u, l_restored.getEntityController().createEntity());
+}
+
+TEST_F(WorldTestSuite, attachedMetricsShouldSampleEntityPoolAndIdGuard)
+{
+	MetricsRegistry l_registry;
+	World l_world(std::make_unique<NiceMock<ComponentProviderMock>>(), WorldSettings{CAPACITY});
+	l_world.attachMetrics(l_registry, "world");
+
+	l_world.getEntityController().createEntity();
+	l_world.getEntityController().createEntity();
+	l_world.getEntityController().removeEntity(ENTITY_ID_1);
+
+	metrics::MetricsSnapshot l_snapshot;
+	l_registry.takeSnapshot(l_snapshot);
+
+	ASSERT_NE(nullptr, l_snapshot.find("world.entityPool.size"));
+	EXPECT_EQ(1, l_snapshot.find("world.entityPool.size")->value);
+	EXPECT_EQ(static_cast<s64>(CAPACITY), l_snapshot.find("world.entityPool.capacity")->value);
+	EXPECT_EQ(1, l_snapshot.find("world.ids.freedIds")->value);
+	EXPECT_EQ(2, l_snapshot.find("world.entities.creates")->value);
+}
+
+TEST_F(WorldTestSuite, relationsResourcesEventsAndObserversShouldAllocateOnlyFromUpstreamOfWorld)
+{
+	std::vector<u8> l_buffer(UPSTREAM_BUFFER_SIZE);
+	std::pmr::monotonic_buffer_resource l_upstream(l_buffer.data(), l_buffer.size(), std::pmr::null_memory_resource());
+	World l_world(std::make_unique<NiceMock<ComponentProviderMock>>(), WorldSettings{CAPACITY}, l_upstream);
+	StrictMock<ComponentObserverMock> l_observer;
+	AllocationScope l_allocations;
+
+	l_world.getResources().emplace<MatchState>();
+	l_world.getEvents().registerEvent<SpawnEvent>(EVENT_CAPACITY);
+	l_world.getEvents().publish(SpawnEvent{ENTITY_ID_1});
+	l_world.getRelations().add(ENTITY_ID_1, RelationType::TARGETS, ENTITY_ID_2);
+	l_world.getObservers().onAdd<PositionComponent>(l_observer);
+	l_world.step(DELTA_TIME);
+
+	EXPECT_EQ(1u, l_world.getEvents().getQueue<SpawnEvent>().size());
+	EXPECT_TRUE(l_world.getResources().remove<MatchState>());
+	EXPECT_EQ(0u, l_allocations.getNumOfAllocations());
+}
+
+TEST_F(WorldTestSuite, removedEntityShouldDropItsRelations)
+{
+	const auto l_first = m_sut.getEntityController().createEntity();
+	const auto l_second = m_sut.getEntityController().createEntity();
+	m_sut.getRelations().add(l_first, RelationType::TARGETS, l_second);
+
+	EXPECT_TRUE(m_sut.getEntityController().removeEntity(l_second));
+
+	EXPECT_FALSE(m_sut.getRelations().has(l_first, RelationType::TARGETS, l_second));
+	EXPECT_EQ(0u, m_sut.getRelations().size());
+}
+
+TEST_F(WorldTestSuite, observersOfWorldShouldBeNotifiedAboutAttachedComponents)
+{
+	StrictMock<ComponentObserverMock> l_observer;
+	m_sut.getObservers().onAdd<PositionComponent>(l_observer);
+	const auto l_id = m_sut.getEntityController().createEntity();
+
+	EXPECT_CALL(l_observer, onComponentChange(Ref(m_sut.getEntityController().getEntity(l_id)), ComponentType::POSITION));
+
+	EXPECT_TRUE(m_sut.getEntityController().connectComponentToEntity(l_id, ComponentType::POSITION));
+}
+
+TEST_F(WorldTestSuite, eventsPublishedDuringStepShouldBeVisibleInNextStep)
+{
+	Match l_match;
+	auto& l_state = l_match.getWorld().getResources().get<MatchState>();
+
+	l_match.getWorld().step(DELTA_TIME);
+	EXPECT_EQ(0u, l_state.nrOfSpawnsSeen);
+
+	l_match.getWorld().step(DELTA_TIME);
+	EXPECT_EQ(1u, l_state.nrOfSpawnsSeen);
+	EXPECT_EQ(2.0f * DELTA_TIME, l_state.elapsed);
+	EXPECT_TRUE(l_match.getWorld().getRelations().has(ENTITY_ID_2, RelationType::TARGETS, ENTITY_ID_1));
+}
+
+TEST_F(WorldTestSuite, worldsSteppedOnSeparateThreadsShouldGiveSameResultsAsSteppedAlone)
+{
+	Match l_reference;
+	l_reference.run();
+	const auto& l_expected = l_reference.getWorld().getResources().get<MatchState>();
+
+	std::vector<std::unique_ptr<Match>> l_matches;
+	std::vector<std::thread> l_threads;
+
+	for (auto i = 0u; i < NR_OF_WORLDS; i++)
+	{
+		l_matches.push_back(std::make_unique<Match>());
+	}
+
+	for (auto& l_match : l_matches)
+	{
+		l_threads.emplace_back([&l_match]() { l_match->run(); });
+	}
+
+	for (auto& l_thread : l_threads)
+	{
+		l_thread.join();
+	}
+
+	for (auto& l_match : l_matches)
+	{
+		const auto& l_state = l_match->getWorld().getResources().get<MatchState>();
+
+		EXPECT_EQ(NR_OF_STEPS - 1u, l_state.nrOfSpawnsSeen);
+		EXPECT_EQ(l_expected.checksum, l_state.checksum);
+		EXPECT_EQ(l_expected.elapsed, l_state.elapsed);
+		EXPECT_EQ(NR_OF_STEPS, l_match->getWorld().getEntityPool().size());
+		EXPECT_EQ(NR_OF_STEPS - 1u, l_match->getWorld().getRelations().size());
+	}
+}
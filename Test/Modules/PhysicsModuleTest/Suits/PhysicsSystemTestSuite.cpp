@@ -0,0 +1,277 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "Core.h"
+#include "PositionComponent.h"
+#include "PhysicsSystem.hpp"
+#include "EntityControllerMock.h"
+
+using namespace testing;
+using namespace engine;
+
+namespace
+{
+const PoolSize CAPACITY = 10u;
+const EntityId ENTITY_ID_1 = 1u;
+const EntityId ENTITY_ID_2 = 2u;
+
+const u32 NO_BODIES = 0u;
+const u32 ONE_BODY = 1u;
+const u32 TWO_BODIES = 2u;
+
+const f32 STEP = 1.0f / 60.0f;
+const f32 START_Y = 100.0f;
+const f32 ALPHA_TOLERANCE = 1e-4f;
+}
+
+class PhysicsSystemTestSuite : public Test
+{
+public:
+	PhysicsSystemTestSuite()
+		:m_transforms(CAPACITY),
+		 m_sut(m_entityControllerMock, m_transforms, createSettings())
+	{
+		m_entities[ENTITY_ID_1] = Entity(ENTITY_ID_1);
+		m_entities[ENTITY_ID_2] = Entity(ENTITY_ID_2);
+
+		ON_CALL(m_entityControllerMock, hasEntity(_)).WillByDefault(Return(true));
+		ON_CALL(m_entityControllerMock, getEntity(ENTITY_ID_1)).WillByDefault(ReturnRef(m_entities[ENTITY_ID_1]));
+		ON_CALL(m_entityControllerMock, getEntity(ENTITY_ID_2)).WillByDefault(ReturnRef(m_entities[ENTITY_ID_2]));
+	}
+
+	static PhysicsSettings createSettings()
+	{
+		PhysicsSettings l_settings;
+		l_settings.fixedTimeStep = STEP;
+		l_settings.maxStepsPerUpdate = 3u;
+		return l_settings;
+	}
+
+	void attach(EntityId p_id, ComponentType p_type)
+	{
+		m_entities[p_id].attachedComponents.set(p_type);
+		m_sut.onEntityChange(p_id);
+	}
+
+	void detach(EntityId p_id, ComponentType p_type)
+	{
+		m_entities[p_id].attachedComponents.set(p_type, false);
+		m_sut.onEntityChange(p_id);
+	}
+
+	void createDynamicBody(EntityId p_id)
+	{
+		m_transforms.add(p_id, 0.0f, START_Y);
+		attach(p_id, ComponentType::POSITION);
+		attach(p_id, ComponentType::MOVABLE);
+		attach(p_id, ComponentType::PHYSICS);
+	}
+
+	f32 getPositionY(EntityId p_id)
+	{
+		return m_transforms.positionsY()[m_transforms.getIndex(p_id)];
+	}
+
+protected:
+	Entity m_entities[CAPACITY + 1u];
+	NiceMock<EntityControllerMock> m_entityControllerMock;
+	TransformStore m_transforms;
+	PhysicsSystem m_sut;
+};
+
+TEST_F(PhysicsSystemTestSuite, bodyShouldBeCreatedWhenPositionAndPhysicsAreAttached)
+{
+	attach(ENTITY_ID_1, ComponentType::POSITION);
+	EXPECT_FALSE(m_sut.hasBody(ENTITY_ID_1));
+
+	attach(ENTITY_ID_1, ComponentType::PHYSICS);
+	EXPECT_TRUE(m_sut.hasBody(ENTITY_ID_1));
+	EXPECT_EQ(ONE_BODY, m_sut.getNumOfBodies());
+	EXPECT_TRUE(m_transforms.has(ENTITY_ID_1));
+}
+
+TEST_F(PhysicsSystemTestSuite, bodyShouldStartAtStoredPosition)
+{
+	createDynamicBody(ENTITY_ID_1);
+
+	auto l_body = m_sut.getBody(ENTITY_ID_1);
+	ASSERT_THAT(l_body, NotNull());
+	EXPECT_FLOAT_EQ(START_Y, l_body->GetPosition().y);
+	EXPECT_EQ(b2_dynamicBody, l_body->GetType());
+}
+
+TEST_F(PhysicsSystemTestSuite, bodyShouldBeStaticWithoutMovable)
+{
+	attach(ENTITY_ID_1, ComponentType::POSITION);
+	attach(ENTITY_ID_1, ComponentType::PHYSICS);
+
+	EXPECT_EQ(b2_staticBody, m_sut.getBody(ENTITY_ID_1)->GetType());
+
+	attach(ENTITY_ID_1, ComponentType::MOVABLE);
+	EXPECT_EQ(b2_dynamicBody, m_sut.getBody(ENTITY_ID_1)->GetType());
+}
+
+TEST_F(PhysicsSystemTestSuite, bodyShouldBeDestroyedWhenPhysicsIsDetached)
+{
+	createDynamicBody(ENTITY_ID_1);
+	createDynamicBody(ENTITY_ID_2);
+
+	detach(ENTITY_ID_1, ComponentType::PHYSICS);
+
+	EXPECT_FALSE(m_sut.hasBody(ENTITY_ID_1));
+	EXPECT_TRUE(m_sut.hasBody(ENTITY_ID_2));
+	EXPECT_EQ(ONE_BODY, m_sut.getNumOfBodies());
+	EXPECT_EQ(ONE_BODY, static_cast<u32>(m_sut.getWorld().GetBodyCount()));
+}
+
+TEST_F(PhysicsSystemTestSuite, transformCreatedBySystemShouldBeReleasedWhenPositionIsDetached)
+{
+	attach(ENTITY_ID_1, ComponentType::POSITION);
+	attach(ENTITY_ID_1, ComponentType::PHYSICS);
+	ASSERT_TRUE(m_transforms.has(ENTITY_ID_1));
+
+	detach(ENTITY_ID_1, ComponentType::POSITION);
+
+	EXPECT_FALSE(m_sut.hasBody(ENTITY_ID_1));
+	EXPECT_FALSE(m_transforms.has(ENTITY_ID_1));
+}
+
+TEST_F(PhysicsSystemTestSuite, transformCreatedBySystemShouldBeReleasedWhenEntityIsRemoved)
+{
+	attach(ENTITY_ID_1, ComponentType::POSITION);
+	attach(ENTITY_ID_1, ComponentType::PHYSICS);
+
+	EXPECT_CALL(m_entityControllerMock, hasEntity(ENTITY_ID_1)).WillOnce(Return(false));
+	m_sut.onEntityChange(ENTITY_ID_1);
+
+	EXPECT_FALSE(m_transforms.has(ENTITY_ID_1));
+}
+
+TEST_F(PhysicsSystemTestSuite, transformNotCreatedBySystemShouldBeKept)
+{
+	createDynamicBody(ENTITY_ID_1);
+	m_transforms.add(ENTITY_ID_2, 0.0f, START_Y);
+	attach(ENTITY_ID_2, ComponentType::MOVABLE);
+
+	detach(ENTITY_ID_1, ComponentType::POSITION);
+
+	EXPECT_FALSE(m_sut.hasBody(ENTITY_ID_1));
+	EXPECT_TRUE(m_transforms.has(ENTITY_ID_1));
+	EXPECT_TRUE(m_transforms.has(ENTITY_ID_2));
+}
+
+TEST_F(PhysicsSystemTestSuite, bodyShouldBeDestroyedWhenEntityNoLongerExists)
+{
+	createDynamicBody(ENTITY_ID_1);
+
+	EXPECT_CALL(m_entityControllerMock, hasEntity(ENTITY_ID_1)).WillOnce(Return(false));
+	m_sut.onEntityChange(ENTITY_ID_1);
+
+	EXPECT_EQ(NO_BODIES, m_sut.getNumOfBodies());
+}
+
+TEST_F(PhysicsSystemTestSuite, worldShouldNotStepIfLessThanFixedStepElapsed)
+{
+	createDynamicBody(ENTITY_ID_1);
+
+	m_sut.update(STEP * 0.5f);
+
+	EXPECT_EQ(0u, m_sut.getNumOfStepsInLastUpdate());
+	EXPECT_NEAR(0.5f, m_sut.getInterpolationAlpha(), ALPHA_TOLERANCE);
+	EXPECT_FLOAT_EQ(START_Y, getPositionY(ENTITY_ID_1));
+}
+
+TEST_F(PhysicsSystemTestSuite, dynamicBodyShouldFallAndPositionShouldBeWrittenBack)
+{
+	createDynamicBody(ENTITY_ID_1);
+
+	m_sut.update(STEP);
+	const auto l_bodyYAfterFirstStep = m_sut.getBody(ENTITY_ID_1)->GetPosition().y;
+	m_sut.update(STEP);
+
+	//no time left in accumulator - written back position is the state from before last step
+	EXPECT_EQ(1u, m_sut.getNumOfStepsInLastUpdate());
+	EXPECT_LT(getPositionY(ENTITY_ID_1), START_Y);
+	EXPECT_FLOAT_EQ(l_bodyYAfterFirstStep, getPositionY(ENTITY_ID_1));
+}
+
+TEST_F(PhysicsSystemTestSuite, writtenBackPositionShouldBeInterpolatedBetweenSteps)
+{
+	createDynamicBody(ENTITY_ID_1);
+	m_sut.update(STEP);
+	const auto l_previousY = m_sut.getBody(ENTITY_ID_1)->GetPosition().y;
+
+	m_sut.update(STEP * 1.5f);
+	const auto l_currentY = m_sut.getBody(ENTITY_ID_1)->GetPosition().y;
+
+	const auto l_alpha = m_sut.getInterpolationAlpha();
+
+	EXPECT_NEAR(0.5f, l_alpha, ALPHA_TOLERANCE);
+	EXPECT_FLOAT_EQ(l_previousY + (l_currentY - l_previousY) * l_alpha, getPositionY(ENTITY_ID_1));
+}
+
+TEST_F(PhysicsSystemTestSuite, numberOfStepsPerUpdateShouldBeCapped)
+{
+	createDynamicBody(ENTITY_ID_1);
+
+	m_sut.update(STEP * 10.0f);
+
+	EXPECT_EQ(createSettings().maxStepsPerUpdate, m_sut.getNumOfStepsInLastUpdate());
+	EXPECT_LT(m_sut.getInterpolationAlpha(), 1.0f);
+}
+
+TEST_F(PhysicsSystemTestSuite, staticBodyShouldNotMove)
+{
+	m_transforms.add(ENTITY_ID_2, 0.0f, START_Y);
+	attach(ENTITY_ID_2, ComponentType::POSITION);
+	attach(ENTITY_ID_2, ComponentType::PHYSICS);
+
+	m_sut.update(STEP * 3.0f);
+
+	EXPECT_FLOAT_EQ(START_Y, getPositionY(ENTITY_ID_2));
+}
+
+TEST_F(PhysicsSystemTestSuite, writeBackShouldFollowBodiesAfterSwapRemove)
+{
+	createDynamicBody(ENTITY_ID_1);
+	m_transforms.add(ENTITY_ID_2, 0.0f, START_Y * 2.0f);
+	attach(ENTITY_ID_2, ComponentType::POSITION);
+	attach(ENTITY_ID_2, ComponentType::PHYSICS);
+	ASSERT_EQ(TWO_BODIES, m_sut.getNumOfBodies());
+
+	detach(ENTITY_ID_1, ComponentType::PHYSICS);
+	m_sut.update(STEP);
+
+	EXPECT_FLOAT_EQ(START_Y * 2.0f, getPositionY(ENTITY_ID_2));
+}
+
+TEST_F(PhysicsSystemTestSuite, positionComponentShouldStartBodyAndReceiveWrittenBackPosition)
+{
+	PositionComponent l_position;
+	l_position.y = START_Y;
+	m_entities[ENTITY_ID_1].components = &l_position;
+
+	attach(ENTITY_ID_1, ComponentType::POSITION);
+	attach(ENTITY_ID_1, ComponentType::MOVABLE);
+	attach(ENTITY_ID_1, ComponentType::PHYSICS);
+	EXPECT_FLOAT_EQ(START_Y, m_sut.getBody(ENTITY_ID_1)->GetPosition().y);
+
+	m_sut.update(STEP);
+	m_sut.update(STEP);
+
+	EXPECT_LT(l_position.y, START_Y);
+	EXPECT_FLOAT_EQ(getPositionY(ENTITY_ID_1), l_position.y);
+}
+
+TEST_F(PhysicsSystemTestSuite, writeBackShouldSkipTransformRemovedOutsideOfSystem)
+{
+	PositionComponent l_position;
+	m_entities[ENTITY_ID_1].components = &l_position;
+	createDynamicBody(ENTITY_ID_1);
+
+	m_transforms.remove(ENTITY_ID_1);
+	m_sut.update(STEP);
+	m_sut.update(STEP);
+
+	EXPECT_FALSE(m_transforms.has(ENTITY_ID_1));
+	EXPECT_LT(l_position.y, START_Y);
+}
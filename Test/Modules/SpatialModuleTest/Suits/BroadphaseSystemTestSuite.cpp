@@ -0,0 +1,277 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <algorithm>
+#include <random>
+#include <set>
+#include <utility>
+#include "Core.h"
+#include "EntityChangeDistributor.h"
+#include "BroadphaseSystem.hpp"
+#include "EntityControllerMock.h"
+
+using namespace testing;
+using namespace engine;
+
+namespace
+{
+const PoolSize CAPACITY = 300u;
+const u32 NR_OF_RANDOM_ENTITIES = 200u;
+const u32 NR_OF_RANDOM_FRAMES = 20u;
+const u32 NR_OF_REPLACED_PER_FRAME = 15u;
+const f32 WORLD_SIZE = 30.0f;
+const f32 MAX_STEP = 1.5f;
+const f32 DELTA_TIME = 1.0f / 60.0f;
+
+const EntityId ENTITY_ID_1 = 1u;
+const EntityId ENTITY_ID_2 = 2u;
+const EntityId ENTITY_ID_3 = 3u;
+}
+
+class BroadphaseSystemTestSuite : public Test
+{
+public:
+	BroadphaseSystemTestSuite()
+		:m_entities(CAPACITY + 1u),
+		 m_transforms(CAPACITY),
+		 m_sut(m_entityControllerMock, m_transforms)
+	{
+		ON_CALL(m_entityControllerMock, hasEntity(_)).WillByDefault(Invoke([this](EntityId p_id)
+		{
+			return m_entities[p_id].id != UNDEFINED_ENTITY_ID;
+		}));
+		ON_CALL(m_entityControllerMock, getEntity(_)).WillByDefault(Invoke([this](EntityId p_id) -> Entity&
+		{
+			return m_entities[p_id];
+		}));
+
+		m_distributor.registerListener(m_sut);
+	}
+
+	void addEntity(EntityId p_id, f32 p_x, f32 p_y)
+	{
+		m_entities[p_id] = Entity(p_id);
+		m_entities[p_id].attachedComponents.set(ComponentType::POSITION);
+		m_transforms.add(p_id, p_x, p_y);
+		m_distributor.distributeEntityChange(p_id);
+	}
+
+	void removeEntity(EntityId p_id)
+	{
+		m_entities[p_id].attachedComponents.reset();
+		m_transforms.remove(p_id);
+		m_distributor.distributeEntityChange(p_id);
+		m_entities[p_id] = Entity();
+	}
+
+	void moveEntity(EntityId p_id, f32 p_x, f32 p_y)
+	{
+		m_transforms.setPosition(p_id, p_x, p_y);
+	}
+
+	bool hasEvent(EntityId p_first, EntityId p_second, OverlapEventType p_type) const
+	{
+		const auto& l_events = m_sut.getEvents();
+
+		return std::any_of(l_events.begin(), l_events.end(), [&](const OverlapEvent& p_event)
+		{
+			return p_event.first == p_first and p_event.second == p_second and p_event.type == p_type;
+		});
+	}
+
+	std::set<std::pair<EntityId, EntityId>> bruteForcePairs(const std::vector<EntityId>& p_ids) const
+	{
+		std::set<std::pair<EntityId, EntityId>> l_pairs;
+		const auto l_extent = BroadphaseSettings().defaultHalfExtent * 2.0f;
+
+		for (auto i = 0u; i < p_ids.size(); i++)
+		{
+			for (auto j = i + 1u; j < p_ids.size(); j++)
+			{
+				const auto l_first = m_transforms.getIndex(p_ids[i]);
+				const auto l_second = m_transforms.getIndex(p_ids[j]);
+
+				if (std::abs(m_transforms.positionsX()[l_first] - m_transforms.positionsX()[l_second]) <= l_extent and
+					std::abs(m_transforms.positionsY()[l_first] - m_transforms.positionsY()[l_second]) <= l_extent)
+				{
+					l_pairs.insert(std::make_pair(std::min(p_ids[i], p_ids[j]), std::max(p_ids[i], p_ids[j])));
+				}
+			}
+		}
+
+		return l_pairs;
+	}
+
+	std::vector<Entity> m_entities;
+	TransformStore m_transforms;
+	NiceMock<EntityControllerMock> m_entityControllerMock;
+	EntityChangeDistributor m_distributor;
+	BroadphaseSystem m_sut;
+};
+
+TEST_F(BroadphaseSystemTestSuite, ProxyIsCreatedOnlyForEntityWithRequiredComponents)
+{
+	m_entities[ENTITY_ID_1] = Entity(ENTITY_ID_1);
+	m_distributor.distributeEntityChange(ENTITY_ID_1);
+	EXPECT_FALSE(m_sut.isTracked(ENTITY_ID_1));
+
+	addEntity(ENTITY_ID_2, 0.0f, 0.0f);
+	EXPECT_TRUE(m_sut.isTracked(ENTITY_ID_2));
+	EXPECT_EQ(1u, m_sut.getNumOfProxies());
+}
+
+TEST_F(BroadphaseSystemTestSuite, BeginEventIsEmittedOnceWhenEntitiesStartOverlapping)
+{
+	addEntity(ENTITY_ID_1, 0.0f, 0.0f);
+	addEntity(ENTITY_ID_2, 5.0f, 0.0f);
+
+	m_sut.update(DELTA_TIME);
+	EXPECT_TRUE(m_sut.getEvents().empty());
+
+	moveEntity(ENTITY_ID_2, 0.5f, 0.5f);
+	m_sut.update(DELTA_TIME);
+
+	ASSERT_EQ(1u, m_sut.getEvents().size());
+	EXPECT_TRUE(hasEvent(ENTITY_ID_1, ENTITY_ID_2, OverlapEventType::BEGIN));
+	EXPECT_EQ(1u, m_sut.getNumOfOverlappingPairs());
+
+	m_sut.update(DELTA_TIME);
+	EXPECT_TRUE(m_sut.getEvents().empty());
+	EXPECT_EQ(1u, m_sut.getNumOfOverlappingPairs());
+}
+
+TEST_F(BroadphaseSystemTestSuite, EndEventIsEmittedWhenEntitiesSeparate)
+{
+	addEntity(ENTITY_ID_1, 0.0f, 0.0f);
+	addEntity(ENTITY_ID_2, 0.0f, 0.5f);
+	m_sut.update(DELTA_TIME);
+
+	moveEntity(ENTITY_ID_2, 0.0f, 5.0f);
+	m_sut.update(DELTA_TIME);
+
+	ASSERT_EQ(1u, m_sut.getEvents().size());
+	EXPECT_TRUE(hasEvent(ENTITY_ID_1, ENTITY_ID_2, OverlapEventType::END));
+	EXPECT_EQ(0u, m_sut.getNumOfOverlappingPairs());
+}
+
+TEST_F(BroadphaseSystemTestSuite, EndEventIsEmittedWhenOverlappingEntityIsRemoved)
+{
+	addEntity(ENTITY_ID_1, 0.0f, 0.0f);
+	addEntity(ENTITY_ID_2, 0.5f, 0.0f);
+	addEntity(ENTITY_ID_3, 0.0f, 0.5f);
+	m_sut.update(DELTA_TIME);
+	EXPECT_EQ(3u, m_sut.getNumOfOverlappingPairs());
+
+	removeEntity(ENTITY_ID_1);
+	m_sut.update(DELTA_TIME);
+
+	EXPECT_FALSE(m_sut.isTracked(ENTITY_ID_1));
+	EXPECT_EQ(2u, m_sut.getNumOfProxies());
+	EXPECT_EQ(2u, m_sut.getEvents().size());
+	EXPECT_TRUE(hasEvent(ENTITY_ID_1, ENTITY_ID_2, OverlapEventType::END));
+	EXPECT_TRUE(hasEvent(ENTITY_ID_1, ENTITY_ID_3, OverlapEventType::END));
+	EXPECT_EQ(1u, m_sut.getNumOfOverlappingPairs());
+}
+
+TEST_F(BroadphaseSystemTestSuite, HalfExtentsCanBeChangedPerEntity)
+{
+	addEntity(ENTITY_ID_1, 0.0f, 0.0f);
+	addEntity(ENTITY_ID_2, 4.0f, 0.0f);
+	m_sut.update(DELTA_TIME);
+	EXPECT_EQ(0u, m_sut.getNumOfOverlappingPairs());
+
+	m_sut.setHalfExtents(ENTITY_ID_1, 4.0f, 1.0f);
+	m_sut.update(DELTA_TIME);
+
+	EXPECT_TRUE(hasEvent(ENTITY_ID_1, ENTITY_ID_2, OverlapEventType::BEGIN));
+}
+
+TEST_F(BroadphaseSystemTestSuite, OverlappingPairsMatchBruteForceWhileEntitiesMove)
+{
+	std::mt19937 l_generator(11u);
+	std::uniform_real_distribution<f32> l_position(-WORLD_SIZE, WORLD_SIZE);
+	std::uniform_real_distribution<f32> l_step(-MAX_STEP, MAX_STEP);
+
+	std::vector<EntityId> l_ids;
+	for (auto i = 1u; i <= NR_OF_RANDOM_ENTITIES; i++)
+	{
+		addEntity(i, l_position(l_generator), l_position(l_generator));
+		l_ids.push_back(i);
+	}
+
+	std::set<std::pair<EntityId, EntityId>> l_overlapping;
+
+	for (auto l_frame = 0u; l_frame < NR_OF_RANDOM_FRAMES; l_frame++)
+	{
+		for (const auto l_id : l_ids)
+		{
+			const auto l_index = m_transforms.getIndex(l_id);
+			moveEntity(l_id, m_transforms.positionsX()[l_index] + l_step(l_generator),
+							 m_transforms.positionsY()[l_index] + l_step(l_generator));
+		}
+
+		m_sut.update(DELTA_TIME);
+
+		for (const auto& l_event : m_sut.getEvents())
+		{
+			const auto l_pair = std::make_pair(l_event.first, l_event.second);
+
+			if (l_event.type == OverlapEventType::BEGIN)
+				EXPECT_TRUE(l_overlapping.insert(l_pair).second);
+			else
+				EXPECT_EQ(1u, l_overlapping.erase(l_pair));
+		}
+
+		EXPECT_EQ(bruteForcePairs(l_ids), l_overlapping);
+		EXPECT_EQ(l_overlapping.size(), m_sut.getNumOfOverlappingPairs());
+	}
+}
+
+TEST_F(BroadphaseSystemTestSuite, OverlappingPairsMatchBruteForceWhileEntitiesAreRemovedAndAdded)
+{
+	std::mt19937 l_generator(5u);
+	std::uniform_real_distribution<f32> l_position(-WORLD_SIZE * 0.5f, WORLD_SIZE * 0.5f);
+
+	std::vector<EntityId> l_ids;
+	std::vector<EntityId> l_removedIds;
+	for (auto i = 1u; i <= NR_OF_RANDOM_ENTITIES; i++)
+	{
+		addEntity(i, l_position(l_generator), l_position(l_generator));
+		l_ids.push_back(i);
+	}
+
+	std::set<std::pair<EntityId, EntityId>> l_overlapping;
+
+	for (auto l_frame = 0u; l_frame < NR_OF_RANDOM_FRAMES; l_frame++)
+	{
+		std::shuffle(l_ids.begin(), l_ids.end(), l_generator);
+
+		for (auto i = 0u; i < NR_OF_REPLACED_PER_FRAME; i++)
+		{
+			removeEntity(l_ids.back());
+			l_removedIds.push_back(l_ids.back());
+			l_ids.pop_back();
+		}
+
+		for (auto i = 0u; i < NR_OF_REPLACED_PER_FRAME; i++)
+		{
+			addEntity(l_removedIds.front(), l_position(l_generator), l_position(l_generator));
+			l_ids.push_back(l_removedIds.front());
+			l_removedIds.erase(l_removedIds.begin());
+		}
+
+		m_sut.update(DELTA_TIME);
+
+		for (const auto& l_event : m_sut.getEvents())
+		{
+			const auto l_pair = std::make_pair(l_event.first, l_event.second);
+
+			if (l_event.type == OverlapEventType::BEGIN)
+				EXPECT_TRUE(l_overlapping.insert(l_pair).second);
+			else
+				EXPECT_EQ(1u, l_overlapping.erase(l_pair));
+		}
+
+		EXPECT_EQ(bruteForcePairs(l_ids), l_overlapping);
+		EXPECT_EQ(NR_OF_RANDOM_ENTITIES, m_sut.getNumOfProxies());
+	}
+}
@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <random>
+#include "Core.h"
+#include "Stopwatch.h"
+#include "SpatialHashGrid.hpp"
+#include "EntityControllerMock.h"
+
+using namespace testing;
+using namespace engine;
+
+namespace
+{
+	const bool ENABLED = true;
+	const bool DISABLED = false;
+
+	const PoolSize NR_OF_ENTITIES = 100000u;
+	const u32 NR_OF_QUERIES = 1000000u;
+	const u32 K = 8u;
+	const f32 WORLD_SIZE = 1000.0f;
+	const f32 QUERY_RADIUS = 8.0f;
+	const u32 NR_OF_BUCKETS = 1u << 16;
+
+	//TESTS:
+	const bool radiusQueriesOnMovingEntities = DISABLED;
+	const bool kNearestQueriesOnMovingEntities = DISABLED;
+}
+
+class SpatialHashGridPerformanceTestSuite : public Test
+{
+public:
+	SpatialHashGridPerformanceTestSuite()
+		:m_entity(ENTITY_ID),
+		 m_transforms(NR_OF_ENTITIES),
+		 m_grid(m_entityControllerMock, m_transforms, createSettings()),
+		 m_queriesX(NR_OF_QUERIES),
+		 m_queriesY(NR_OF_QUERIES)
+	{
+		m_entity.attachedComponents.set(ComponentType::POSITION);
+		ON_CALL(m_entityControllerMock, hasEntity(_)).WillByDefault(Return(true));
+		ON_CALL(m_entityControllerMock, getEntity(_)).WillByDefault(ReturnRef(m_entity));
+
+		std::mt19937 l_generator(1u);
+		std::uniform_real_distribution<f32> l_position(0.0f, WORLD_SIZE);
+		std::uniform_real_distribution<f32> l_velocity(-5.0f, 5.0f);
+
+		for (auto i = 1u; i <= NR_OF_ENTITIES; i++)
+		{
+			m_transforms.add(i, l_position(l_generator), l_position(l_generator), l_velocity(l_generator), l_velocity(l_generator));
+			m_grid.onEntityChange(i);
+		}
+
+		for (auto i = 0u; i < NR_OF_QUERIES; i++)
+		{
+			m_queriesX[i] = l_position(l_generator);
+			m_queriesY[i] = l_position(l_generator);
+		}
+	}
+
+	static SpatialGridSettings createSettings()
+	{
+		SpatialGridSettings l_settings;
+		l_settings.cellSize = QUERY_RADIUS;
+		l_settings.nrOfBuckets = NR_OF_BUCKETS;
+		return l_settings;
+	}
+
+	void moveEntitiesAndRebuild()
+	{
+		std::cout << "Integrate + rebuild of " << NR_OF_ENTITIES << " entities: \n";
+		startStopwatch();
+		m_transforms.integrate(1.0f / 60.0f);
+		m_grid.rebuild();
+		stopStopwatch();
+	}
+
+	void startStopwatch()
+	{
+		m_stopwatch.start();
+	}
+
+	void stopStopwatch()
+	{
+		m_stopwatch.stop();
+		std::cout << "Measured time: " << m_stopwatch.getElapsedTime().count() << "ms \n\n";
+	}
+
+protected:
+	static constexpr EntityId ENTITY_ID = 1u;
+
+	Entity m_entity;
+	NiceMock<EntityControllerMock> m_entityControllerMock;
+	TransformStore m_transforms;
+	SpatialHashGrid m_grid;
+
+	std::vector<f32> m_queriesX;
+	std::vector<f32> m_queriesY;
+	testTool::Stopwatch m_stopwatch;
+};
+
+TEST_F(SpatialHashGridPerformanceTestSuite, radiusQueriesOnMovingEntities)
+{
+	if (not radiusQueriesOnMovingEntities)
+		return;
+
+	moveEntitiesAndRebuild();
+
+	std::vector<EntityId> l_result;
+	l_result.reserve(NR_OF_ENTITIES);
+	u32 l_nrOfHits = 0u;
+
+	std::cout << NR_OF_QUERIES << " radius queries: \n";
+	startStopwatch();
+	for (auto i = 0u; i < NR_OF_QUERIES; i++)
+	{
+		l_result.clear();
+		m_grid.queryRadius(m_queriesX[i], m_queriesY[i], QUERY_RADIUS, l_result);
+		l_nrOfHits += static_cast<u32>(l_result.size());
+	}
+	stopStopwatch();
+
+	std::cout << "Average hits per query: " << static_cast<f32>(l_nrOfHits) / NR_OF_QUERIES << "\n";
+}
+
+TEST_F(SpatialHashGridPerformanceTestSuite, kNearestQueriesOnMovingEntities)
+{
+	if (not kNearestQueriesOnMovingEntities)
+		return;
+
+	moveEntitiesAndRebuild();
+
+	std::vector<EntityId> l_result(NR_OF_QUERIES * K);
+
+	std::cout << NR_OF_QUERIES << " batched " << K << "-nearest queries: \n";
+	startStopwatch();
+	m_grid.queryKNearest(m_queriesX.data(), m_queriesY.data(), NR_OF_QUERIES, K, WORLD_SIZE, l_result.data());
+	stopStopwatch();
+}
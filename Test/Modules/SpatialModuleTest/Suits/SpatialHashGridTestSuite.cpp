@@ -0,0 +1,207 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <algorithm>
+#include <random>
+#include "Core.h"
+#include "SpatialHashGrid.hpp"
+#include "EntityControllerMock.h"
+
+using namespace testing;
+using namespace engine;
+
+namespace
+{
+const PoolSize CAPACITY = 500u;
+const u32 NR_OF_RANDOM_ENTITIES = 400u;
+const f32 WORLD_SIZE = 100.0f;
+
+const EntityId ENTITY_ID_1 = 1u;
+const EntityId ENTITY_ID_2 = 2u;
+const EntityId ENTITY_ID_3 = 3u;
+
+const u32 K = 5u;
+const f32 NO_LIMIT = 1000.0f;
+}
+
+class SpatialHashGridTestSuite : public Test
+{
+public:
+	SpatialHashGridTestSuite()
+		:m_entities(CAPACITY + 1u),
+		 m_transforms(CAPACITY),
+		 m_sut(m_entityControllerMock, m_transforms, createSettings())
+	{
+		ON_CALL(m_entityControllerMock, hasEntity(_)).WillByDefault(Return(true));
+		ON_CALL(m_entityControllerMock, getEntity(_)).WillByDefault(Invoke([this](EntityId p_id) -> Entity&
+		{
+			return m_entities[p_id];
+		}));
+	}
+
+	static SpatialGridSettings createSettings()
+	{
+		SpatialGridSettings l_settings;
+		l_settings.cellSize = 4.0f;
+		l_settings.nrOfBuckets = 64u;
+		return l_settings;
+	}
+
+	void addEntity(EntityId p_id, f32 p_x, f32 p_y)
+	{
+		m_entities[p_id] = Entity(p_id);
+		m_entities[p_id].attachedComponents.set(ComponentType::POSITION);
+		m_transforms.add(p_id, p_x, p_y);
+		m_sut.onEntityChange(p_id);
+	}
+
+	void addRandomEntities()
+	{
+		std::mt19937 l_generator(7u);
+		std::uniform_real_distribution<f32> l_distribution(-WORLD_SIZE, WORLD_SIZE);
+
+		for (auto i = 1u; i <= NR_OF_RANDOM_ENTITIES; i++)
+		{
+			addEntity(i, l_distribution(l_generator), l_distribution(l_generator));
+		}
+
+		m_sut.rebuild();
+	}
+
+	f32 distanceSquared(EntityId p_id, f32 p_x, f32 p_y)
+	{
+		const auto l_index = m_transforms.getIndex(p_id);
+		const auto l_dx = m_transforms.positionsX()[l_index] - p_x;
+		const auto l_dy = m_transforms.positionsY()[l_index] - p_y;
+		return l_dx * l_dx + l_dy * l_dy;
+	}
+
+	std::vector<EntityId> bruteForceRadius(f32 p_x, f32 p_y, f32 p_radius)
+	{
+		std::vector<EntityId> l_result;
+
+		for (auto i = 0u; i < m_transforms.size(); i++)
+		{
+			const auto l_id = m_transforms.getEntityId(i);
+			if (distanceSquared(l_id, p_x, p_y) <= p_radius * p_radius)
+				l_result.push_back(l_id);
+		}
+
+		return l_result;
+	}
+
+	std::vector<EntityId> bruteForceKNearest(f32 p_x, f32 p_y)
+	{
+		std::vector<EntityId> l_result(m_transforms.entityIds(), m_transforms.entityIds() + m_transforms.size());
+		std::sort(l_result.begin(), l_result.end(), [&](EntityId p_first, EntityId p_second)
+		{
+			return distanceSquared(p_first, p_x, p_y) < distanceSquared(p_second, p_x, p_y);
+		});
+		l_result.resize(K);
+
+		return l_result;
+	}
+
+protected:
+	std::vector<Entity> m_entities;
+	NiceMock<EntityControllerMock> m_entityControllerMock;
+	TransformStore m_transforms;
+	SpatialHashGrid m_sut;
+	std::vector<EntityId> m_result;
+};
+
+TEST_F(SpatialHashGridTestSuite, entityShouldBeTrackedOnlyWithPositionComponent)
+{
+	addEntity(ENTITY_ID_1, 0.0f, 0.0f);
+	EXPECT_TRUE(m_sut.isTracked(ENTITY_ID_1));
+
+	m_entities[ENTITY_ID_1].attachedComponents.set(ComponentType::POSITION, false);
+	m_sut.onEntityChange(ENTITY_ID_1);
+
+	EXPECT_FALSE(m_sut.isTracked(ENTITY_ID_1));
+	EXPECT_EQ(0u, m_sut.getNumOfTrackedEntities());
+}
+
+TEST_F(SpatialHashGridTestSuite, radiusQueryShouldReturnOnlyEntitiesInRange)
+{
+	addEntity(ENTITY_ID_1, 1.0f, 1.0f);
+	addEntity(ENTITY_ID_2, 3.0f, 1.0f);
+	addEntity(ENTITY_ID_3, 9.0f, 9.0f);
+	m_sut.rebuild();
+
+	m_sut.queryRadius(0.0f, 0.0f, 5.0f, m_result);
+
+	EXPECT_THAT(m_result, UnorderedElementsAre(ENTITY_ID_1, ENTITY_ID_2));
+}
+
+TEST_F(SpatialHashGridTestSuite, aabbQueryShouldHandleNegativeCoordinates)
+{
+	addEntity(ENTITY_ID_1, -7.5f, -0.5f);
+	addEntity(ENTITY_ID_2, 0.5f, 0.5f);
+	m_sut.rebuild();
+
+	m_sut.queryAabb(-8.0f, -1.0f, 0.0f, 0.0f, m_result);
+
+	EXPECT_THAT(m_result, ElementsAre(ENTITY_ID_1));
+}
+
+TEST_F(SpatialHashGridTestSuite, queriesShouldSeePositionsFromLastRebuild)
+{
+	addEntity(ENTITY_ID_1, 0.0f, 0.0f);
+	m_sut.rebuild();
+
+	m_transforms.setPosition(ENTITY_ID_1, 50.0f, 50.0f);
+	m_sut.queryRadius(50.0f, 50.0f, 1.0f, m_result);
+	EXPECT_TRUE(m_result.empty());
+
+	m_sut.update(0.0f);
+	m_sut.queryRadius(50.0f, 50.0f, 1.0f, m_result);
+	EXPECT_THAT(m_result, ElementsAre(ENTITY_ID_1));
+}
+
+TEST_F(SpatialHashGridTestSuite, radiusQueryShouldMatchBruteForce)
+{
+	addRandomEntities();
+	ASSERT_EQ(NR_OF_RANDOM_ENTITIES, m_sut.getNumOfIndexedEntities());
+
+	for (auto l_radius : { 0.5f, 3.0f, 10.0f, 25.0f })
+	{
+		m_result.clear();
+		m_sut.queryRadius(12.0f, -30.0f, l_radius, m_result);
+
+		EXPECT_THAT(m_result, UnorderedElementsAreArray(bruteForceRadius(12.0f, -30.0f, l_radius)));
+	}
+}
+
+TEST_F(SpatialHashGridTestSuite, kNearestShouldMatchBruteForceForBatchOfQueries)
+{
+	addRandomEntities();
+
+	const f32 l_queriesX[] = { 0.0f, -99.0f, 50.5f };
+	const f32 l_queriesY[] = { 0.0f, 99.0f, -13.25f };
+	EntityId l_result[3 * K];
+
+	m_sut.queryKNearest(l_queriesX, l_queriesY, 3u, K, NO_LIMIT, l_result);
+
+	for (auto i = 0u; i < 3u; i++)
+	{
+		std::vector<EntityId> l_found(l_result + i * K, l_result + (i + 1u) * K);
+		EXPECT_EQ(bruteForceKNearest(l_queriesX[i], l_queriesY[i]), l_found);
+	}
+}
+
+TEST_F(SpatialHashGridTestSuite, kNearestShouldFillMissingNeighboursWithUndefinedId)
+{
+	addEntity(ENTITY_ID_1, 1.0f, 0.0f);
+	addEntity(ENTITY_ID_2, 30.0f, 0.0f);
+	m_sut.rebuild();
+
+	const f32 l_queryX = 0.0f;
+	const f32 l_queryY = 0.0f;
+	EntityId l_result[K];
+
+	m_sut.queryKNearest(&l_queryX, &l_queryY, 1u, K, 10.0f, l_result);
+
+	EXPECT_EQ(ENTITY_ID_1, l_result[0]);
+	for (auto i = 1u; i < K; i++)
+		EXPECT_EQ(UNDEFINED_ENTITY_ID, l_result[i]);
+}
@@ -0,0 +1,139 @@
+#include "AllocationHook.h"
+#include <cstdlib>
+#include <new>
+#if defined(_MSC_VER)
+	#include <malloc.h>
+#endif
+
+namespace
+{
+	//trivial thread_local - usable from operator new at any point of thread lifetime
+	thread_local testTool::AllocationCounters s_counters;
+
+	void* countedAllocate(std::size_t p_size)
+	{
+		s_counters.nrOfAllocations++;
+		s_counters.allocatedBytes += p_size;
+
+		if (auto l_memory = std::malloc(p_size == 0u ? 1u : p_size))
+		{
+			return l_memory;
+		}
+
+		throw std::bad_alloc();
+	}
+
+	void countedFree(void* p_memory)
+	{
+		if (p_memory)
+		{
+			s_counters.nrOfDeallocations++;
+			std::free(p_memory);
+		}
+	}
+
+	//std::pmr::new_delete_resource (default pmr resource) goes through aligned overloads
+	void* countedAlignedAllocate(std::size_t p_size, std::align_val_t p_alignment)
+	{
+		s_counters.nrOfAllocations++;
+		s_counters.allocatedBytes += p_size;
+
+		const auto l_alignment = static_cast<std::size_t>(p_alignment);
+		const auto l_size = (p_size + l_alignment - 1u) / l_alignment * l_alignment;
+
+#if defined(_MSC_VER)
+		auto l_memory = _aligned_malloc(l_size == 0u ? l_alignment : l_size, l_alignment);
+#else
+		auto l_memory = std::aligned_alloc(l_alignment, l_size == 0u ? l_alignment : l_size);
+#endif
+		if (l_memory)
+		{
+			return l_memory;
+		}
+
+		throw std::bad_alloc();
+	}
+
+	void countedAlignedFree(void* p_memory)
+	{
+		if (p_memory)
+		{
+			s_counters.nrOfDeallocations++;
+#if defined(_MSC_VER)
+			_aligned_free(p_memory);
+#else
+			std::free(p_memory);
+#endif
+		}
+	}
+}
+
+void* operator new(std::size_t p_size)
+{
+	return countedAllocate(p_size);
+}
+
+void* operator new[](std::size_t p_size)
+{
+	return countedAllocate(p_size);
+}
+
+void operator delete(void* p_memory) noexcept
+{
+	countedFree(p_memory);
+}
+
+void operator delete[](void* p_memory) noexcept
+{
+	countedFree(p_memory);
+}
+
+void operator delete(void* p_memory, std::size_t) noexcept
+{
+	countedFree(p_memory);
+}
+
+void operator delete[](void* p_memory, std::size_t) noexcept
+{
+	countedFree(p_memory);
+}
+
+void* operator new(std::size_t p_size, std::align_val_t p_alignment)
+{
+	return countedAlignedAllocate(p_size, p_alignment);
+}
+
+void* operator new[](std::size_t p_size, std::align_val_t p_alignment)
+{
+	return countedAlignedAllocate(p_size, p_alignment);
+}
+
+void operator delete(void* p_memory, std::align_val_t) noexcept
+{
+	countedAlignedFree(p_memory);
+}
+
+void operator delete[](void* p_memory, std::align_val_t) noexcept
+{
+	countedAlignedFree(p_memory);
+}
+
+void operator delete(void* p_memory, std::size_t, std::align_val_t) noexcept
+{
+	countedAlignedFree(p_memory);
+}
+
+void operator delete[](void* p_memory, std::size_t, std::align_val_t) noexcept
+{
+	countedAlignedFree(p_memory);
+}
+
+namespace testTool
+{
+
+AllocationCounters getThreadAllocationCounters()
+{
+	return s_counters;
+}
+
+}
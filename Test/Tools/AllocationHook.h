@@ -0,0 +1,53 @@
+#pragma once
+#include "Core.h"
+
+namespace testTool
+{
+
+using namespace engine;
+
+/*
+	Test and benchmark binaries replace global operator new/delete (AllocationHook.cpp). Every allocation
+	is counted per thread, so AllocationScope sees only allocations of the thread which created it - gtest,
+	benchmark or other threads do not disturb it. Scopes can be nested.
+*/
+
+struct AllocationCounters
+{
+	u64 nrOfAllocations = 0u;
+	u64 nrOfDeallocations = 0u;
+	u64 allocatedBytes = 0u;
+};
+
+AllocationCounters getThreadAllocationCounters();
+
+class AllocationScope
+{
+public:
+	AllocationScope()
+		:m_start(getThreadAllocationCounters())
+	{
+	}
+
+	AllocationScope(const AllocationScope&) = delete;
+
+	u64 getNumOfAllocations() const
+	{
+		return getThreadAllocationCounters().nrOfAllocations - m_start.nrOfAllocations;
+	}
+
+	u64 getNumOfDeallocations() const
+	{
+		return getThreadAllocationCounters().nrOfDeallocations - m_start.nrOfDeallocations;
+	}
+
+	u64 getAllocatedBytes() const
+	{
+		return getThreadAllocationCounters().allocatedBytes - m_start.allocatedBytes;
+	}
+
+private:
+	const AllocationCounters m_start;
+};
+
+}
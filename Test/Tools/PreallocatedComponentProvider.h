@@ -0,0 +1,67 @@
+#pragma once
+#include <array>
+#include <vector>
+#include "Core.h"
+#include "IComponentProvider.h"
+
+namespace testTool
+{
+
+using namespace engine;
+
+/*
+	ComponentProvider from Core does not own real storage yet, tests and benchmarks need distinct objects.
+	Components of every type are taken from preallocated storage and returned to free list,
+	so attach/detach does not touch the heap.
+*/
+
+class PreallocatedComponentProvider : public IComponentProvider
+{
+public:
+	PreallocatedComponentProvider(u32 p_capacityPerType)
+	{
+		for (auto l_index = 0u; l_index < NR_OF_TYPES; l_index++)
+		{
+			m_components[l_index].reserve(p_capacityPerType);
+			m_freeComponents[l_index].reserve(p_capacityPerType);
+
+			for (auto i = 0u; i < p_capacityPerType; i++)
+			{
+				m_components[l_index].emplace_back(static_cast<ComponentType>(l_index));
+				m_freeComponents[l_index].push_back(&m_components[l_index].back());
+			}
+		}
+	}
+
+	ComponentBase& createComponent(ComponentType p_type) override
+	{
+		auto& l_freeComponents = m_freeComponents[static_cast<u32>(p_type)];
+		auto l_component = l_freeComponents.back();
+		l_freeComponents.pop_back();
+
+		l_component->nextComponent = nullptr;
+		return *l_component;
+	}
+
+	void createComponents(ComponentType p_type, u32 p_count, ComponentBase** p_components) override
+	{
+		for (auto i = 0u; i < p_count; i++)
+		{
+			p_components[i] = &createComponent(p_type);
+		}
+	}
+
+	bool removeComponent(ComponentBase& p_component) override
+	{
+		m_freeComponents[static_cast<u32>(p_component.type)].push_back(&p_component);
+		return true;
+	}
+
+private:
+	static constexpr u32 NR_OF_TYPES = LAST_VALID_COMPONENT_INDEX + 1u;
+
+	std::array<std::vector<ComponentBase>, NR_OF_TYPES> m_components;
+	std::array<std::vector<ComponentBase*>, NR_OF_TYPES> m_freeComponents;
+};
+
+}
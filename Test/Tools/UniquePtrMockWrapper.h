@@ -1,6 +1,6 @@
 #pragma once
 #include <memory>
-#include <gmock\gmock.h>
+#include <gmock/gmock.h>
 #include "assert.h"
 
 namespace testTool